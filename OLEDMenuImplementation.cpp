@@ -14,6 +14,8 @@ typedef TV5725<GBS_ADDR> GBS;
 extern void applyPresets(uint8_t videoMode);
 extern void setOutModeHdBypass(bool bypass);
 extern void saveUserPrefs();
+extern void flushUserPrefs();
+extern File slotDbOpen();
 extern float getOutputFrameRate();
 extern void loadDefaultUserOptions();
 extern uint8_t getVideoMode();
@@ -118,7 +120,7 @@ bool presetSelectionMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OL
     display->drawString(OLED_MENU_WIDTH / 2, 16, item->str);
     display->drawXbm((OLED_MENU_WIDTH - TEXT_LOADED_WIDTH) / 2, OLED_MENU_HEIGHT / 2, IMAGE_ITEM(TEXT_LOADED));
     display->display();
-    uopt->presetSlot = 'A' + item->tag; // ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~()!*:,
+    uopt->presetSlot = slotChar(item->tag);
     uopt->presetPreference = PresetPreference::OutputCustomized;
     saveUserPrefs();
     if (rto->videoStandardInput == 14) {
@@ -137,15 +139,17 @@ bool presetSelectionMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OL
 }
 bool presetsCreationMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OLEDMenuNav, bool)
 {
-    SlotMetaArray slotsObject;
-    File slotsBinaryFileRead = SPIFFS.open(SLOTS_FILE, "r");
+    static char slotNames[OLED_MENU_MAX_SUBITEMS_NUM][sizeof(SlotMeta::name)]; // the items keep pointers
+    File db = slotDbOpen();
     manager->clearSubItems(item);
     int curNumSlot = 0;
-    if (slotsBinaryFileRead) {
-        slotsBinaryFileRead.read((byte *)&slotsObject, sizeof(slotsObject));
-        slotsBinaryFileRead.close();
+    if (db) {
+        SlotMeta slot;
         for (int i = 0; i < SLOTS_TOTAL; ++i) {
-            const SlotMeta &slot = slotsObject.slot[i];
+            db.seek(slotDbEntryOffset(i));
+            if (db.read((uint8_t *)&slot, sizeof(slot)) != sizeof(slot)) {
+                break;
+            }
             if (strcmp(EMPTY_SLOT_NAME, slot.name) == 0 || !strlen(slot.name)) {
                 continue;
             }
@@ -153,8 +157,10 @@ bool presetsCreationMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OL
             if (curNumSlot > OLED_MENU_MAX_SUBITEMS_NUM) {
                 break;
             }
-            manager->registerItem(item, slot.slot, slot.name, presetSelectionMenuHandler);
+            memcpy(slotNames[curNumSlot - 1], slot.name, sizeof(slot.name));
+            manager->registerItem(item, i, slotNames[curNumSlot - 1], presetSelectionMenuHandler);
         }
+        db.close();
     }
 
     if (curNumSlot > OLED_MENU_MAX_SUBITEMS_NUM) {
@@ -172,6 +178,7 @@ bool resetMenuHandler(OLEDMenuManager *manager, OLEDMenuItem *item, OLEDMenuNav,
         // not precise
         if (millis() - oledMenuFreezeStartTime >= oledMenuFreezeTimeoutInMS) {
             manager->unfreeze();
+            flushUserPrefs();
             ESP.reset();
             return false;
         }
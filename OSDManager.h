@@ -189,6 +189,7 @@ public:
         uint8_t x = (x_start + width / 2 - (x_zoom * MENU_WIDTH) / 2) >> 3;
         uint8_t y = (y_stop - 64 - y_zoom * MENU_HEIGHT) >> 3;
 
+        GBS::Transaction t;
         GBS::OSD_MENU_DISP_STYLE::write(1);
         GBS::OSD_MENU_HORI_START::write(x);
         GBS::OSD_MENU_VER_START::write(y);
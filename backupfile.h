@@ -0,0 +1,42 @@
+#ifndef _BACKUPFILE_H_
+#define _BACKUPFILE_H_
+// BACKUP BUNDLE
+// Slots, their presets and the user preferences in one stream, as served by
+// /bin/backup.bin and taken by /bin/restore: a BackupHeader, then a
+// BackupEntry and the file contents for each file, then presetCrc32() of
+// everything before it (4 bytes, little endian).
+#define BACKUP_MAGIC 0x42534247 // "GBSB"
+#define BACKUP_VERSION 1
+#define BACKUP_FILES_MAX 4       // entries a bundle may have
+#define BACKUP_TMP_PREFIX "/restore." // restored files are complete here before they replace the old ones
+
+typedef struct
+{
+    uint32_t magic;
+    uint8_t version;
+    uint8_t files; // BackupEntry + contents following
+    uint16_t reserved;
+} BackupHeader;
+
+typedef struct
+{
+    char name[24]; // zero padded
+    uint32_t size;
+} BackupEntry;
+
+static_assert(sizeof(BackupHeader) == 8, "BackupHeader must not have padding");
+static_assert(sizeof(BackupEntry) == 28, "BackupEntry must not have padding");
+
+// Copies the part of a block at [start, start + size) of a stream that falls
+// into [pos, pos + len) to out. Returns the bytes copied.
+static inline size_t backupCopyPart(const uint8_t *block, uint32_t start, uint32_t size, uint32_t pos, uint8_t *out, size_t len)
+{
+    if (pos < start || pos >= start + size) {
+        return 0;
+    }
+    size_t n = start + size - pos;
+    n = n < len ? n : len;
+    memcpy(out, block + (pos - start), n);
+    return n;
+}
+#endif
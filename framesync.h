@@ -7,7 +7,7 @@
 #ifndef DEBUG_IN_PIN
 #define DEBUG_IN_PIN D6
 #endif
-#else // Arduino
+#elif !defined(FRAMESYNC_PLATFORM) // Arduino
 // fastest, but non portable (Uno pin 11 = PB3, Mega2560 pin 11 = PB5)
 //#define digitalRead(x) bitRead(PINB, 3)
 #include "fastpin.h"
@@ -15,8 +15,85 @@
 // no define for DEBUG_IN_PIN
 #endif
 
+// Builds without the ESP8266 core (e.g. a host simulation) define
+// FRAMESYNC_PLATFORM to a class with static functions matching
+// FrameSyncEsp below and provide rto and SerialM. Together with a TW_BUS
+// backing the GBS registers (tw.h) and a DEBUG_IN_PIN, that is all
+// FrameSyncManager and VsyncCapture need: edges go in by calling
+// VsyncCapture::_risingEdgeISR(), the clock gen comes out by setClock().
+#ifdef FRAMESYNC_PLATFORM
+#include <stdint.h>
+#include <math.h>
+#include <algorithm>
+#ifndef ICACHE_RAM_ATTR
+#define ICACHE_RAM_ATTR
+#endif
+#else
 #include <ESP8266WiFi.h>
 
+struct FrameSyncEsp
+{
+    // time stamps, in CPU cycles
+    static inline uint32_t ICACHE_RAM_ATTR cycles()
+    {
+        uint32_t now;
+        __asm__ __volatile__("rsr %0,ccount"
+                            : "=a"(now));
+        return now;
+    }
+
+    static uint32_t cyclesPerSecond()
+    {
+        return ESP.getCpuFreqMHz() * 1000000;
+    }
+
+    static uint32_t ms()
+    {
+        return millis();
+    }
+
+    // lets ISRs and WiFi run while waiting for edges
+    static void wait()
+    {
+        delay(1);
+    }
+
+    static void attachEdgeISR(void (*isr)())
+    {
+        attachInterrupt(DEBUG_IN_PIN, isr, RISING);
+    }
+
+    // masks the pin interrupt again, safe to call from the ISR
+    static inline void ICACHE_RAM_ATTR detachEdgeISR()
+    {
+        GPC(DEBUG_IN_PIN) &= ~(0xF << GPCI);
+        GPIEC = (1 << DEBUG_IN_PIN);
+    }
+
+    // ext. clock gen output 0, in Hz: PLL fraction only, keeping the output
+    // divider externalClockGenResetClock() set up for the display clock
+    static void setClock(uint32_t freq)
+    {
+        Si.updateFreq(0, freq);
+    }
+
+    // between the steps of a smooth clock change
+    static void idle()
+    {
+        handleWiFi(0);
+    }
+};
+
+#define FRAMESYNC_PLATFORM FrameSyncEsp
+#endif
+
+// frameTimeLockMethod values for runVsync() / reset()
+#define FRAMESYNC_METHOD_VTOTAL_VS 0 // vtotal, moving VS position along
+#define FRAMESYNC_METHOD_VTOTAL 1    // vtotal, VS position stays
+#define FRAMESYNC_METHOD_DITHER 2    // vtotal +- 1 on some frames, see runDither()
+#define FRAMESYNC_METHOD_HTOTAL 3    // htotal by 1 clock, the line count stays (integer scaling)
+#define FRAMESYNC_DITHER_LINES 2     // runDither() keeps vtotal within this many lines of the preset's
+
 // FS_DEBUG:      full verbose debug over serial
 // FS_DEBUG_LED:  just blink LED (off = adjust phase, on = normal phase)
 //#define FS_DEBUG
@@ -29,40 +106,121 @@
 #define fsDebugPrintf(...)
 #endif
 
-namespace MeasurePeriod {
-    volatile uint32_t stopTime, startTime;
-    volatile uint32_t armed;
+// VSYNC CAPTURE
+// The debug pin's ISR timestamps (ESP cycle count) every rising edge into
+// a ring, readers take the newest edges from it without stopping the loop.
+// The pin shows whatever the test bus routes to it: route() restarts the
+// capture when that changes, so no reader sees edges of two different
+// signals. A vsync route stays captured in the background, the ISR masks
+// itself should edges come faster than any vsync (someone else changed
+// the test bus). Other signals are only captured while a reader waits for
+// them, stop() ends that.
+#define VSYNC_CAPTURE_SIZE 16     // edges kept, a power of 2
+#define VSYNC_CAPTURE_TIMEOUT 150 // ms to wait for edges after a restart
+#define VSYNC_CAPTURE_CHECK 4     // edges runFrequency() compares the periods of, at least
+#define VSYNC_CAPTURE_INIT 6      // edges findBestHTotal() averages the input period over, at least
+#define VSYNC_CAPTURE_MAX_RATE 200 // Hz, faster edges aren't vsync
+
+namespace VsyncCapture {
+    volatile uint32_t ring[VSYNC_CAPTURE_SIZE];
+    volatile uint32_t count;  // edges so far, the next one goes to ring[count % VSYNC_CAPTURE_SIZE]
+    uint32_t firstValid;      // count at restart()
+    uint32_t currentRoute;
+    volatile bool attached;
+    bool vsyncOnly;           // the ISR masks itself on faster edges
+    uint32_t minPeriod;       // ESP cycles, VSYNC_CAPTURE_MAX_RATE
+
+    void ICACHE_RAM_ATTR _risingEdgeISR()
+    {
+        uint32_t now = FRAMESYNC_PLATFORM::cycles();
+        uint32_t c = count;
+        if (vsyncOnly && c != firstValid && now - ring[(c - 1) % VSYNC_CAPTURE_SIZE] < minPeriod) {
+            FRAMESYNC_PLATFORM::detachEdgeISR();
+            attached = false;
+            return;
+        }
+        ring[c % VSYNC_CAPTURE_SIZE] = now;
+        count = c + 1;
+    }
 
-    void _risingEdgeISR_prepare();
-    void _risingEdgeISR_measure();
+    void begin()
+    {
+        count = 0;
+        firstValid = 0;
+        currentRoute = 0xffffffff;
+        attached = false;
+        minPeriod = FRAMESYNC_PLATFORM::cyclesPerSecond() / VSYNC_CAPTURE_MAX_RATE;
+    }
 
-    void start() {
-        startTime = 0;
-        stopTime = 0;
-        armed = 0;
-        attachInterrupt(DEBUG_IN_PIN, _risingEdgeISR_prepare, RISING);
+    // forget the edges captured so far
+    void restart()
+    {
+        firstValid = count;
     }
 
-    void ICACHE_RAM_ATTR _risingEdgeISR_prepare()
+    // Captures the signal key stands for from now on, vsync tells whether
+    // it may go on in the background
+    void route(uint32_t key, bool vsync)
     {
-        noInterrupts();
-        //startTime = ESP.getCycleCount();
-        __asm__ __volatile__("rsr %0,ccount"
-                            : "=a"(startTime));
-        detachInterrupt(DEBUG_IN_PIN);
-        armed = 1;
-        attachInterrupt(DEBUG_IN_PIN, _risingEdgeISR_measure, RISING);
-        interrupts();
+        vsyncOnly = vsync;
+        if (!attached) {
+            restart();
+            currentRoute = key;
+            attached = true;
+            FRAMESYNC_PLATFORM::attachEdgeISR(_risingEdgeISR);
+        } else if (key != currentRoute) {
+            currentRoute = key;
+            restart();
+        }
     }
 
-    void ICACHE_RAM_ATTR _risingEdgeISR_measure()
+    void stop()
     {
-        noInterrupts();
-        //stopTime = ESP.getCycleCount();
-        __asm__ __volatile__("rsr %0,ccount"
-                            : "=a"(stopTime));
-        detachInterrupt(DEBUG_IN_PIN);
-        interrupts();
+        if (attached) {
+            FRAMESYNC_PLATFORM::detachEdgeISR();
+            attached = false;
+        }
+        currentRoute = 0xffffffff;
+    }
+
+    // Copies the newest (up to n) edges since restart() to out, oldest
+    // first. Returns how many.
+    uint8_t latest(uint32_t *out, uint8_t n)
+    {
+        for (;;) {
+            uint32_t c = count;
+            uint32_t available = c - firstValid;
+            uint8_t k = available < n ? available : n;
+            k = k < VSYNC_CAPTURE_SIZE ? k : VSYNC_CAPTURE_SIZE;
+            for (uint8_t i = 0; i < k; i++) {
+                out[i] = ring[(c - k + i) % VSYNC_CAPTURE_SIZE];
+            }
+            if (count - c <= (uint32_t)(VSYNC_CAPTURE_SIZE - k)) {
+                return k; // the ISR didn't overwrite any of them meanwhile
+            }
+        }
+    }
+
+    // Like latest(), but waits up to timeout ms until there are at least
+    // min (>= 2) edges and the newest isn't older than two periods (the
+    // signal stopped, start over). Returns 0 on timeout.
+    uint8_t edges(uint32_t *out, uint8_t n, uint8_t min, uint16_t timeout)
+    {
+        uint32_t begin = FRAMESYNC_PLATFORM::ms();
+        for (;;) {
+            uint8_t k = latest(out, n);
+            if (k >= min) {
+                uint32_t period = out[k - 1] - out[k - 2];
+                if (FRAMESYNC_PLATFORM::cycles() - out[k - 1] <= 2 * period) {
+                    return k;
+                }
+                restart();
+            }
+            if (FRAMESYNC_PLATFORM::ms() - begin > timeout) {
+                return 0;
+            }
+            FRAMESYNC_PLATFORM::wait(); // edges come in by ISR
+        }
     }
 }
 
@@ -71,34 +229,45 @@ void setExternalClockGenFrequencySmooth(uint32_t freq) {
 
     rto->freqExtClockGen = freq;
 
-    constexpr uint32_t STEP_SIZE_HZ = 1000;
+    // each step is one short PLL burst (Si5351mcu::updateFreq()), 4 kHz
+    // is at most 0.01% of a display clock, finer than the 0.06% one
+    // runFrequency() correction may move. WiFi only gets its turn every
+    // IDLE_INTERVAL_MS.
+    constexpr uint32_t STEP_SIZE_HZ = 4000;
+    constexpr uint32_t IDLE_INTERVAL_MS = 4;
+    uint32_t lastIdle = FRAMESYNC_PLATFORM::ms();
 
     if (current > rto->freqExtClockGen) {
         if ((current - rto->freqExtClockGen) < 750000) {
             while (current > (rto->freqExtClockGen + STEP_SIZE_HZ)) {
                 current -= STEP_SIZE_HZ;
-                Si.setFreq(0, current);
-                handleWiFi(0);
+                FRAMESYNC_PLATFORM::setClock(current);
+                if (FRAMESYNC_PLATFORM::ms() - lastIdle >= IDLE_INTERVAL_MS) {
+                    FRAMESYNC_PLATFORM::idle();
+                    lastIdle = FRAMESYNC_PLATFORM::ms();
+                }
             }
         }
     } else if (current < rto->freqExtClockGen) {
         if ((rto->freqExtClockGen - current) < 750000) {
             while ((current + STEP_SIZE_HZ) < rto->freqExtClockGen) {
                 current += STEP_SIZE_HZ;
-                Si.setFreq(0, current);
-                handleWiFi(0);
+                FRAMESYNC_PLATFORM::setClock(current);
+                if (FRAMESYNC_PLATFORM::ms() - lastIdle >= IDLE_INTERVAL_MS) {
+                    FRAMESYNC_PLATFORM::idle();
+                    lastIdle = FRAMESYNC_PLATFORM::ms();
+                }
             }
         }
     }
 
-    Si.setFreq(0, rto->freqExtClockGen);
+    FRAMESYNC_PLATFORM::setClock(rto->freqExtClockGen);
 }
 
 template <class GBS, class Attrs>
 class FrameSyncManager
 {
 private:
-    typedef typename GBS::STATUS_VDS_VERT_COUNT VERT_COUNT;
     typedef typename GBS::VDS_HSYNC_RST HSYNC_RST;
     typedef typename GBS::VDS_VSYNC_RST VSYNC_RST;
     typedef typename GBS::VDS_VS_ST VSST;
@@ -107,70 +276,133 @@ private:
     static const uint8_t debugInPin = Attrs::debugInPin;
     static const int16_t syncCorrection = Attrs::syncCorrection;
     static const int32_t syncTargetPhase = Attrs::syncTargetPhase;
+    static const uint32_t lockInterval = Attrs::lockInterval;
+    static constexpr float ditherKp = Attrs::ditherKp;
+    static constexpr float ditherKi = Attrs::ditherKi;
+    static constexpr float ditherBand = Attrs::ditherBand;
+    static constexpr float rateAlpha = Attrs::rateAlpha;
+    static constexpr float rateBeta = Attrs::rateBeta;
+    static constexpr float phaseKp = Attrs::phaseKp;
+    static constexpr float phaseKi = Attrs::phaseKi;
+    static const bool rateRecheck = Attrs::rateRecheck;
 
     static bool syncLockReady;
     static uint8_t delayLock;
     static int16_t syncLastCorrection;
+    static uint8_t syncLastMethod; // the frameTimeLockMethod syncLastCorrection was applied with
 
     /// Set to -1 if uninitialized.
     /// Reset with syncLastCorrection.
     static float maybeFreqExt_per_videoFps;
 
-    // Sample vsync start and stop times from debug pin.
-    static bool vsyncOutputSample(uint32_t *start, uint32_t *stop)
+    /// runFrequency() state: filtered input period (ESP cycles, 0 if
+    /// none yet), its change per run and the accumulated phase error
+    /// (frames). Reset with maybeFreqExt_per_videoFps.
+    static float ratePeriod;
+    static float rateTrend;
+    static float phaseIntegral;
+
+    /// FRAMESYNC_METHOD_DITHER state: extra lines per frame the output
+    /// needs to match the input (from findBestHTotal(), then integrated
+    /// phase error), the lines per frame runDither() adds on average,
+    /// the lines it owes the frames so far, runs the loop has been
+    /// settled for, and when runDither() steps next and the frame period
+    /// in between (ESP cycles).
+    static float ditherRate;
+    static float ditherLines;
+    static float ditherAccu;
+    static uint8_t ditherSettled;
+    static uint32_t ditherNext;
+    static uint32_t ditherPeriod;
+    static bool ditherActive;
+
+    /// Newest output vsync edge vsyncPeriodAndPhase() saw (ESP cycles)
+    static uint32_t lastOutputEdge;
+
+    static void clearController()
     {
-        yield();
-        ESP.wdtDisable();
-        MeasurePeriod::start();
+        ratePeriod = 0;
+        rateTrend = 0;
+        phaseIntegral = 0;
+    }
 
-        // typical: 300000 at 80MHz, 600000 at 160MHz
-        for (uint32_t i = 0; i < 3000000; i++) {
-            if (MeasurePeriod::armed) {
-                MeasurePeriod::armed = 0;
-                delay(7);
-                WiFi.setSleepMode(WIFI_LIGHT_SLEEP);
-            }
-            if (MeasurePeriod::stopTime > 0) {
-                break;
-            }
+    // what the test bus routes to the debug pin
+    static uint32_t debugBusRoute()
+    {
+        return GBS::TEST_BUS_SEL::read() | (GBS::TEST_BUS_SP_SEL::read() << 8) | ((uint32_t)GBS::IF_TEST_SEL::read() << 16);
+    }
+
+    // Routes with a vsync on the debug pin: IF vertical period, SP vsync
+    // in, VDS vblank
+    static bool vsyncRoute(uint32_t route)
+    {
+        uint8_t testBusSel = route & 0xff;
+        return (testBusSel == 0x0 && (route >> 16) == 3) ||
+               (testBusSel == 0xa && ((route >> 8) & 0xff) == 0x0f) || testBusSel == 0x2;
+    }
+
+    // Newest (up to n, at least min) edges of the debug pin signal, only
+    // waiting for them when the routing changed or the signal stalled
+    static uint8_t debugPinEdges(uint32_t *edges, uint8_t n, uint8_t min)
+    {
+        uint32_t route = debugBusRoute();
+        bool vsync = vsyncRoute(route);
+        VsyncCapture::route(route, vsync);
+        uint8_t k = VsyncCapture::edges(edges, n, min, VSYNC_CAPTURE_TIMEOUT);
+        if (!vsync) {
+            VsyncCapture::stop(); // faster signals only while measuring
         }
-        *start = MeasurePeriod::startTime;
-        *stop = MeasurePeriod::stopTime;
-        ESP.wdtEnable(0);
-        WiFi.setSleepMode(WIFI_NONE_SLEEP);
+        return k;
+    }
 
-        if ((*start >= *stop) || *stop == 0 || *start == 0) {
-            // ESP.getCycleCount() overflow oder no pulse, just fail this round
+    // Newest period of the debug pin signal, start and stop in ESP cycles
+    static bool debugPinPeriod(uint32_t *start, uint32_t *stop)
+    {
+        uint32_t edges[2];
+        if (!debugPinEdges(edges, 2, 2)) {
             return false;
         }
-
+        *start = edges[0];
+        *stop = edges[1];
         return true;
     }
 
+    // Sample vsync start and stop times from debug pin.
+    static bool vsyncOutputSample(uint32_t *start, uint32_t *stop)
+    {
+        return debugPinPeriod(start, stop);
+    }
+
     // Sample input and output vsync periods and their phase
-    // difference in microseconds
+    // difference in ESP cycles. The input period is the mean over the
+    // edges the capture has, the test bus is back on the input after.
     static bool vsyncPeriodAndPhase(int32_t *periodInput, int32_t *periodOutput, int32_t *phase)
     {
         fsDebugPrintf("vsyncPeriodAndPhase(), TEST_BUS_SEL=%d\n", GBS::TEST_BUS_SEL::read());
 
-        uint32_t inStart, inStop, outStart, outStop;
+        uint32_t in[VSYNC_CAPTURE_SIZE];
+        uint32_t outStart, outStop;
         uint32_t inPeriod, outPeriod, diff;
 
         // calling code needs to ensure debug bus is ready to sample vperiod
-
-        if (!vsyncInputSample(&inStart, &inStop)) {
+        uint8_t testBusSel = GBS::TEST_BUS_SEL::read();
+        uint8_t edges = debugPinEdges(in, VSYNC_CAPTURE_SIZE, 2);
+        if (!edges) {
             return false;
         }
+        inPeriod = (in[edges - 1] - in[0]) / (edges - 1);
 
         GBS::TEST_BUS_SEL::write(0x2); // 0x2 = VDS (t3t50t4) // measure VDS vblank (VB ST/SP)
-        inPeriod = (inStop - inStart); //>> 1;
-        if (!vsyncOutputSample(&outStart, &outStop)) {
+        bool ret = vsyncOutputSample(&outStart, &outStop);
+        GBS::TEST_BUS_SEL::write(testBusSel);
+        debugBusChanged(); // input edges collect again until the next call
+        if (!ret) {
             return false;
         }
-        outPeriod = (outStop - outStart); //>> 1;
+        outPeriod = (outStop - outStart);
+        lastOutputEdge = outStop;
 
-
-        diff = (outStart - inStart) % inPeriod;
+        diff = (outStart - in[edges - 1]) % inPeriod;
         if (periodInput)
             *periodInput = inPeriod;
         if (periodOutput)
@@ -181,10 +413,36 @@ private:
         return true;
     }
 
+    // Mean and spread (longest - shortest) of the input periods the
+    // capture has, from at least min edges, in ESP cycles. Doesn't wait
+    // if the input has been routed to the debug pin for that long.
+    static bool vsyncInputPeriods(uint32_t *mean, uint32_t *spread, uint8_t min)
+    {
+        uint32_t in[VSYNC_CAPTURE_SIZE];
+        uint8_t edges = debugPinEdges(in, VSYNC_CAPTURE_SIZE, min);
+        if (!edges) {
+            return false;
+        }
+        uint32_t shortest = 0xffffffff, longest = 0;
+        for (uint8_t i = 1; i < edges; i++) {
+            uint32_t period = in[i] - in[i - 1];
+            shortest = period < shortest ? period : shortest;
+            longest = period > longest ? period : longest;
+        }
+        *mean = (in[edges - 1] - in[0]) / (edges - 1);
+        *spread = longest - shortest;
+        return true;
+    }
+
     static bool sampleVsyncPeriods(uint32_t *input, uint32_t *output)
     {
         int32_t inPeriod, outPeriod;
+        uint32_t mean, spread;
 
+        // the input period is the mean over the captured edges, have a
+        // few of them for a source with jitter
+        if (!vsyncInputPeriods(&mean, &spread, VSYNC_CAPTURE_INIT))
+            return false;
         if (!vsyncPeriodAndPhase(&inPeriod, &outPeriod, NULL))
             return false;
 
@@ -194,8 +452,29 @@ private:
         return true;
     }
 
+    // The htotal up to reach away from around that leaves the output frame
+    // closest to a whole number of lines short of (or over) exactHtotal's,
+    // with a line to spare for runDither() to pull the phase. lines gets
+    // how many.
+    static uint16_t wholeLineHtotal(float exactHtotal, uint16_t around, uint8_t reach, float &lines)
+    {
+        uint16_t vtotal = VSYNC_RST::read() - syncLastCorrection;
+        uint16_t best = around;
+        float bestOff = 1.0f;
+        for (uint16_t htotal = around - reach; htotal <= around + reach; htotal++) {
+            float candidate = (exactHtotal - htotal) * vtotal / htotal;
+            float off = fabs(candidate - roundf(candidate));
+            if (fabs(candidate) <= FRAMESYNC_DITHER_LINES - 1 && off < bestOff) {
+                bestOff = off;
+                best = htotal;
+                lines = candidate;
+            }
+        }
+        return best;
+    }
+
     // Find appropriate htotal that makes output frame time slightly more than the input.
-    static bool findBestHTotal(uint32_t &bestHtotal)
+    static bool findBestHTotal(uint32_t &bestHtotal, uint8_t frameTimeLockMethod)
     {
         uint16_t inHtotal = HSYNC_RST::read();
         uint32_t inPeriod, outPeriod;
@@ -227,6 +506,16 @@ private:
             bestHtotal = (uint64_t)(inHtotal * (uint64_t)inPeriod) / (uint64_t)outPeriod;
         }
 
+        // FRAMESYNC_METHOD_DITHER starts from the lines the output frame
+        // is short of the input with an htotal that leaves few frames to
+        // change.
+        float exactHtotal = (float)inHtotal * inPeriod / outPeriod;
+        ditherRate = (exactHtotal - bestHtotal) * VSYNC_RST::read() / bestHtotal;
+        if (frameTimeLockMethod == FRAMESYNC_METHOD_DITHER) {
+            bestHtotal = wholeLineHtotal(exactHtotal, bestHtotal, 2, ditherRate);
+        }
+        ditherRate = ditherRate < 1 - FRAMESYNC_DITHER_LINES ? 1 - FRAMESYNC_DITHER_LINES : (ditherRate > FRAMESYNC_DITHER_LINES - 1 ? FRAMESYNC_DITHER_LINES - 1 : ditherRate);
+
         // new 08.11.19: skip this step, IF period measurement should be stable enough to give repeatable results
         //if (bestHtotal == (inHtotal + 1)) { bestHtotal -= 1; } // works well
         //if (bestHtotal == (inHtotal - 1)) { bestHtotal += 1; } // check with SNES + vtotal = 1000 (1280x960)
@@ -254,7 +543,12 @@ public:
 #ifdef FS_DEBUG
         Serial.print("FS reset(), with correction: ");
 #endif
-        if (syncLastCorrection != 0) {
+        if (syncLastCorrection != 0 && syncLastMethod == FRAMESYNC_METHOD_HTOTAL) {
+#ifdef FS_DEBUG
+            Serial.println("Yes");
+#endif
+            HSYNC_RST::write(HSYNC_RST::read() - syncLastCorrection);
+        } else if (syncLastCorrection != 0) {
 #ifdef FS_DEBUG
             Serial.println("Yes");
 #endif
@@ -262,7 +556,7 @@ public:
             VRST_SST::read(vtotal, vsst);
             uint16_t timeout = 0;
             vtotal -= syncLastCorrection;
-            if (frameTimeLockMethod == 0) { // moves VS position
+            if (frameTimeLockMethod == 0 && syncLastMethod != FRAMESYNC_METHOD_DITHER) { // moves VS position
                 vsst -= syncLastCorrection;
             }
 
@@ -284,6 +578,7 @@ public:
         syncLockReady = false;
         syncLastCorrection = 0;
         delayLock = 0;
+        ditherActive = false;
         // Don't clear maybeFreqExt_per_videoFps.
         //
         // Clearing is unsafe, since many callers call reset(), don't
@@ -303,7 +598,7 @@ public:
         delayLock = 0;
     }
 
-    static uint16_t init()
+    static uint16_t init(uint8_t frameTimeLockMethod)
     {
         uint32_t bestHTotal = 0;
 
@@ -312,7 +607,7 @@ public:
         // being less.  Increasing the vertical frame size slightly
         // should then push the output frame time to being larger than
         // the input.
-        if (!findBestHTotal(bestHTotal)) {
+        if (!findBestHTotal(bestHTotal, frameTimeLockMethod)) {
             return 0;
         }
 
@@ -321,13 +616,26 @@ public:
         return (uint16_t)bestHTotal;
     }
 
+    // Call after writing the test bus outside of FrameSyncManager: the
+    // capture goes on for a vsync, otherwise the ISR is detached.
+    static void debugBusChanged()
+    {
+        uint32_t route = debugBusRoute();
+        if (vsyncRoute(route)) {
+            VsyncCapture::route(route, true);
+        } else {
+            VsyncCapture::stop();
+        }
+    }
+
+    // Mean period of the debug pin signal in ESP cycles, 0 if there is none
     static uint32_t getPulseTicks()
     {
-        uint32_t inStart, inStop;
-        if (!vsyncInputSample(&inStart, &inStop)) {
+        uint32_t mean, spread;
+        if (!vsyncInputPeriods(&mean, &spread, 2)) {
             return 0;
         }
-        return inStop - inStart;
+        return mean;
     }
 
     static bool ready(void)
@@ -340,6 +648,12 @@ public:
         return syncLastCorrection;
     }
 
+    // lines VDS_VSYNC_RST is off from its uncorrected value
+    static int16_t getSyncLastVtotalCorrection()
+    {
+        return syncLastMethod == FRAMESYNC_METHOD_HTOTAL ? 0 : syncLastCorrection;
+    }
+
     static void cleanup()
     {
         fsDebugPrintf("FrameSyncManager::cleanup(), resetting video frequency\n");
@@ -347,6 +661,7 @@ public:
         syncLastCorrection = 0; // the important bit
         syncLockReady = 0;
         delayLock = 0;
+        ditherActive = false;
 
         // Should we clear maybeFreqExt_per_videoFps?
         //
@@ -362,37 +677,13 @@ public:
         // Not clearing is hopefully safe. See reset() for an
         // explanation.
         maybeFreqExt_per_videoFps = -1;
+        clearController();
     }
 
     // Sample vsync start and stop times from debug pin.
     static bool vsyncInputSample(uint32_t *start, uint32_t *stop)
     {
-        yield();
-        ESP.wdtDisable();
-        MeasurePeriod::start();
-
-        // typical: 300000 at 80MHz, 600000 at 160MHz
-        for (uint32_t i = 0; i < 3000000; i++) {
-            if (MeasurePeriod::armed) {
-                MeasurePeriod::armed = 0;
-                delay(7);
-                WiFi.setSleepMode(WIFI_LIGHT_SLEEP);
-            }
-            if (MeasurePeriod::stopTime > 0) {
-                break;
-            }
-        }
-        *start = MeasurePeriod::startTime;
-        *stop = MeasurePeriod::stopTime;
-        ESP.wdtEnable(0);
-        WiFi.setSleepMode(WIFI_NONE_SLEEP);
-
-        if ((*start >= *stop) || *stop == 0 || *start == 0) {
-            // ESP.getCycleCount() overflow oder no pulse, just fail this round
-            return false;
-        }
-
-        return true;
+        return debugPinPeriod(start, stop);
     }
 
     // Perform vsync phase locking.  This is accomplished by measuring
@@ -402,6 +693,7 @@ public:
     // value.
     static bool runVsync(uint8_t frameTimeLockMethod)
     {
+        TW_PROFILE_TAG("frameSync");
         int32_t period;
         int32_t phase;
         int32_t target;
@@ -420,8 +712,90 @@ public:
 
         target = (syncTargetPhase * period) / 360;
 
+        if (frameTimeLockMethod == FRAMESYNC_METHOD_DITHER) {
+            // Lines per frame that would take the phase error out until
+            // the next run. Lagging behind target means shorter frames.
+            // The lines runDither() still owes count as already there,
+            // its swing within ditherBand isn't for the loop to correct.
+            float frames = (float)lockInterval * (FRAMESYNC_PLATFORM::cyclesPerSecond() / 1000) / period;
+            float error = (float)(phase - target) / period * (VSYNC_RST::read() - syncLastCorrection);
+            float lines = (error + (ditherActive ? ditherAccu : 0.0f)) / frames;
+            // Pulling the phase in, frames stay within a line of the whole
+            // number of lines nearest to the input's (see runDither()).
+            // The integral stops while the pull is held there and for the
+            // run after, a new source's phase says nothing about its rate.
+            float pull = -ditherKp * lines;
+            const float rateLimit = FRAMESYNC_DITHER_LINES - 0.75f; // corrections stay within FRAMESYNC_DITHER_LINES
+            float nearest = roundf(ditherRate);
+            bool held = fabs(ditherLines - nearest) >= 1 || ditherRate + pull <= nearest - 1 || ditherRate + pull >= nearest + 1;
+            bool stuck = false;
+            if (!held) {
+                ditherRate -= ditherKi * lines;
+                stuck = ditherRate < -rateLimit || ditherRate > rateLimit;
+                ditherRate = ditherRate < -rateLimit ? -rateLimit : (ditherRate > rateLimit ? rateLimit : ditherRate);
+                nearest = roundf(ditherRate);
+            }
+            ditherLines = ditherRate + pull;
+            ditherLines = ditherLines < nearest - 1 ? nearest - 1 : (ditherLines > nearest + 1 ? nearest + 1 : ditherLines);
+
+            // Once the loop has settled for a few runs, ditherRate knows
+            // the input better than findBestHTotal()'s measurement did.
+            // Move htotal by one if that leaves clearly fewer frames to
+            // change, or if the input needs more lines than ditherRate
+            // may have.
+            ditherSettled = fabs(lines) < 0.05f ? (ditherSettled < 255 ? ditherSettled + 1 : 255) : 0;
+            if (ditherSettled >= 5 || stuck) {
+                uint16_t htotal = HSYNC_RST::read();
+                uint16_t vtotal = VSYNC_RST::read() - syncLastCorrection;
+                float exactHtotal = htotal * (1.0f + ditherRate / vtotal);
+                float rate = ditherRate;
+                uint16_t best = wholeLineHtotal(exactHtotal, htotal, 1, rate);
+                if (stuck) {
+                    best = ditherRate < 0 ? htotal - 1 : htotal + 1; // shorter lines take lines off
+                    rate = (exactHtotal - best) * vtotal / best;
+                }
+                if (stuck || (best != htotal && fabs(rate - roundf(rate)) < fabs(ditherRate - roundf(ditherRate)) - 0.1f)) {
+                    // the correction follows, the frame stays within a
+                    // fraction of a line of what it was
+                    int16_t shift = (int16_t)roundf(rate - ditherRate);
+                    HSYNC_RST::write(best);
+                    if (shift != 0) {
+                        VSYNC_RST::write(VSYNC_RST::read() + shift);
+                        syncLastCorrection += shift;
+                    }
+                    ditherLines += rate - ditherRate;
+                    ditherRate = rate;
+                    ditherSettled = 0;
+                }
+            }
+
+            // runDither() steps half a frame after the output vblank, well
+            // away from the frame's end where VSYNC_RST takes effect. Align
+            // to the vblank just seen without losing or repeating a frame.
+            uint32_t middle = lastOutputEdge + period / 2;
+            if (ditherActive) {
+                int32_t frames = lroundf((float)(int32_t)(ditherNext - middle) / period);
+                ditherNext = middle + frames * period;
+            } else {
+                ditherNext = middle;
+                while ((int32_t)(FRAMESYNC_PLATFORM::cycles() - ditherNext) > 0) {
+                    ditherNext += period;
+                }
+                ditherAccu = 0;
+                ditherSettled = 0;
+            }
+            ditherPeriod = period;
+            ditherActive = true;
+#ifdef FS_DEBUG
+            Serial.printf("phase: %7d target: %7d  lines/frame: %f\n", phase, target, ditherLines);
+#endif
+            return true;
+        }
+
         if (phase > target)
             correction = 0;
+        else if (frameTimeLockMethod == FRAMESYNC_METHOD_HTOTAL)
+            correction = 1; // findBestHTotal() rounded down, 1 clock makes the frame longer
         else
             correction = syncCorrection;
 
@@ -446,6 +820,17 @@ public:
         }
 
         int16_t delta = correction - syncLastCorrection;
+        if (frameTimeLockMethod == FRAMESYNC_METHOD_HTOTAL) {
+            // line length can change anywhere in the frame
+            HSYNC_RST::write(HSYNC_RST::read() + delta);
+            syncLastCorrection = correction;
+            syncLastMethod = frameTimeLockMethod;
+#ifdef FS_DEBUG
+            Serial.printf("  htotal: %4d\n", HSYNC_RST::read());
+#endif
+            return true;
+        }
+
         uint16_t vtotal = 0, vsst = 0;
         uint16_t timeout = 0;
         VRST_SST::read(vtotal, vsst);
@@ -464,6 +849,7 @@ public:
         GBS::VDS_VSYNC_RST::write(vtotal);
 
         syncLastCorrection = correction;
+        syncLastMethod = frameTimeLockMethod;
 
 #ifdef FS_DEBUG
         Serial.printf("  vtotal: %4d\n", vtotal);
@@ -472,8 +858,47 @@ public:
         return true;
     }
 
+    // FRAMESYNC_METHOD_DITHER, call from loop(). Once per output frame
+    // (timed from the output vsync runVsync() measured, no bus traffic
+    // in between) the frame under way gets the whole number of lines
+    // below or above ditherLines added to vtotal, so on average the
+    // frames carry ditherLines extra lines. The correction only moves by
+    // one line, once the frames owe or are ahead by ditherBand lines: a
+    // slow pulse width modulation rather than a change every other frame.
+    static void runDither()
+    {
+        if (!syncLockReady || !ditherActive) {
+            return;
+        }
+        uint32_t late = FRAMESYNC_PLATFORM::cycles() - ditherNext;
+        if ((int32_t)late < 0) {
+            return;
+        }
+        // the frames since the last step (more than one if loop() was
+        // too busy) ran with the last correction
+        uint32_t frames = late / ditherPeriod + 1;
+        ditherNext += frames * ditherPeriod;
+        ditherAccu += frames * (ditherLines - syncLastCorrection);
+        // ditherLines is within a line of nearest, so are the corrections
+        int16_t nearest = (int16_t)roundf(ditherRate);
+        int16_t below = (int16_t)floorf(ditherLines);
+        below = below < nearest - 1 ? nearest - 1 : (below > nearest ? nearest : below);
+        int16_t correction = syncLastCorrection;
+        if (correction < nearest - 1 || (ditherAccu >= ditherBand && correction <= below)) {
+            correction++;
+        } else if (correction > nearest + 1 || (ditherAccu <= -ditherBand && correction > below)) {
+            correction--;
+        }
+        if (correction != syncLastCorrection) {
+            VSYNC_RST::write(VSYNC_RST::read() + correction - syncLastCorrection);
+            syncLastCorrection = correction;
+            syncLastMethod = FRAMESYNC_METHOD_DITHER;
+        }
+    }
+
     static void clearFrequency() {
         maybeFreqExt_per_videoFps = -1;
+        clearController();
     }
 
     static void initFrequency(float outFramesPerS, uint32_t freqExtClockGen) {
@@ -486,6 +911,7 @@ public:
           proportional to the input FPS.
         */
         maybeFreqExt_per_videoFps = (float)freqExtClockGen / outFramesPerS;
+        clearController();
     }
 
     // Perform vsync phase locking.  This is accomplished by measuring
@@ -494,6 +920,7 @@ public:
     // offset closer to the desired value.
     static bool runFrequency()
     {
+        TW_PROFILE_TAG("frameSyncFreq");
         if (maybeFreqExt_per_videoFps < 0) {
             SerialM.printf(
                 "Error: trying to tune external clock frequency while clock frequency uninitialized!\n");
@@ -532,7 +959,7 @@ public:
         // https://esp32.com/viewtopic.php?p=82090#p82090
 
         // ESP CPU cycles/s
-        const float esp8266_clock_freq = ESP.getCpuFreqMHz() * 1000000;
+        const float esp8266_clock_freq = FRAMESYNC_PLATFORM::cyclesPerSecond();
 
         // ESP CPU cycles
         int32_t periodInput;  // int32_t periodOutput;
@@ -541,65 +968,77 @@ public:
         // Frame/s
         float fpsInput;
 
-        // Measure input period until we get two consistent measurements. This
+        // The input periods the capture has must agree with each other. This
         // substantially reduces the chance of incorrectly guessing FPS when
         // input sync changes (but does not eliminate it, eg. when resetting a
         // SNES).
-        bool success = false;
-        for (int attempt = 0; attempt < 2; attempt++) {
-            // Measure input period and output latency.
-            bool ret = vsyncPeriodAndPhase(&periodInput, nullptr, &phase);
-            // TODO make vsyncPeriodAndPhase() restore TEST_BUS_SEL, not the caller?
-            GBS::TEST_BUS_SEL::write(0x0);
-            if (!ret) {
-                SerialM.printf("runFrequency(): vsyncPeriodAndPhase failed, retrying...\n");
+        uint32_t periodMean, periodSpread;
+        if (!vsyncInputPeriods(&periodMean, &periodSpread, VSYNC_CAPTURE_CHECK)) {
+            SerialM.printf("FrameSyncManager::runFrequency(): no input periods, failed!\n");
+            return false;
+        }
+        float relSpread = (float)periodSpread / (float)periodMean;
+        if (relSpread > 0.00833f) {
+            SerialM.printf(
+                "FrameSyncManager::runFrequency() measured inconsistent periods, spread %f, failed!\n",
+                relSpread);
+            return false;
+        }
+
+        // Measure input period and output latency. With rateRecheck, measure
+        // the input period again and take the pair only if they agree, one
+        // retry, like before the spread check above.
+        bool sampled = false;
+        for (uint8_t attempt = 0; attempt < (rateRecheck ? 2 : 1) && !sampled; attempt++) {
+            if (!vsyncPeriodAndPhase(&periodInput, nullptr, &phase)) {
+                SerialM.printf("FrameSyncManager::runFrequency(): vsyncPeriodAndPhase failed!\n");
                 continue;
             }
-
             fpsInput = esp8266_clock_freq / (float)periodInput;
             if (fpsInput < 47.0f || fpsInput > 86.0f) {
-                SerialM.printf(
-                    "runFrequency(): fpsInput wrong: %f, retrying...\n",
-                    fpsInput);
+                SerialM.printf("FrameSyncManager::runFrequency(): fpsInput wrong: %f, failed!\n", fpsInput);
                 continue;
             }
-
-            // Measure input period again. vsyncPeriodAndPhase()/getPulseTicks()
-            // -> vsyncInputSample() depend on GBS::TEST_BUS_SEL = 0, but
-            // vsyncPeriodAndPhase() sets it to 2.
-            GBS::TEST_BUS_SEL::write(0x0);
+            if (!rateRecheck) {
+                sampled = true;
+                break;
+            }
             uint32_t periodInput2 = getPulseTicks();
             if (periodInput2 == 0) {
-                SerialM.printf("runFrequency(): getPulseTicks failed, retrying...\n");
+                SerialM.printf("FrameSyncManager::runFrequency(): getPulseTicks failed!\n");
                 continue;
             }
             float fpsInput2 = esp8266_clock_freq / (float)periodInput2;
-            if (fpsInput2 < 47.0f || fpsInput2 > 86.0f) {
-                SerialM.printf(
-                    "runFrequency(): fpsInput2 wrong: %f, retrying...\n",
-                    fpsInput2);
-                continue;
-            }
-
-            // Check that the two FPS measurements are sufficiently close.
             float diff = fabs(fpsInput2 - fpsInput);
             float relDiff = diff / std::min(fpsInput, fpsInput2);
             if (relDiff != relDiff || diff > 0.5f || relDiff > 0.00833f) {
                 SerialM.printf(
-                    "FrameSyncManager::runFrequency() measured inconsistent FPS %f and %f, retrying...\n",
-                    fpsInput,
-                    fpsInput2);
+                    "FrameSyncManager::runFrequency() measured inconsistent FPS %f and %f!\n",
+                    fpsInput, fpsInput2);
                 continue;
             }
-
-            success = true;
-            break;
+            sampled = true;
         }
-        if (!success) {
-            SerialM.printf("FrameSyncManager::runFrequency() failed!\n");
+        if (!sampled) {
             return false;
         }
 
+        // Alpha-beta filter over the input period. A measurement too far
+        // off the estimate means the source changed, the filter starts over
+        // from it (the phase integral stays, it holds the clock's offset).
+        constexpr float RATE_RESTART = 0.001f;
+        const float measured = (float)periodInput;
+        if (ratePeriod <= 0 || fabs(measured - ratePeriod) > ratePeriod * RATE_RESTART) {
+            ratePeriod = measured;
+            rateTrend = 0;
+        } else {
+            const float predicted = ratePeriod + rateTrend;
+            const float residual = measured - predicted;
+            ratePeriod = predicted + rateAlpha * residual;
+            rateTrend += rateBeta * residual;
+        }
+        fpsInput = esp8266_clock_freq / ratePeriod;
+
         // ESP CPU cycles
         int32_t target = (syncTargetPhase * periodInput) / 360;
 
@@ -610,10 +1049,12 @@ public:
             / esp8266_clock_freq // s
             * fpsInput; // frames
 
-        // 0.0038f is 2/525, the difference between SNES and Wii 240p.
-        // This number is somewhat arbitrary, but works well in
-        // practice.
-        float correction = 0.0038f * latency_err_frames;
+        // PI on the latency error. The integral takes out what the
+        // proportional part alone leaves, mostly the clock gen's crystal
+        // being off from the ESP's.
+        const float integral = phaseIntegral + latency_err_frames;
+        float correction = phaseKp * latency_err_frames + phaseKi * integral;
+        const float unclampedCorrection = correction;
 
         // Some LCD displays (eg. Dell U2312HM) lose sync when changing
         // frequency by 0.1% (switching between 59.94 and 60 FPS).
@@ -641,6 +1082,13 @@ public:
         fpsOutput = std::min(fpsOutput, prevFpsOutput * (1 + MAX_FPS_CHANGE));
         fpsOutput = std::max(fpsOutput, prevFpsOutput * (1 - MAX_FPS_CHANGE));
 
+        // Anti-windup: while a clamp holds the output, the integral only
+        // takes errors that move it off the clamp.
+        if ((correction == unclampedCorrection && fpsOutput == rawFpsOutput) ||
+            latency_err_frames * unclampedCorrection < 0) {
+            phaseIntegral = integral;
+        }
+
         if (fabs(rawFpsOutput - prevFpsOutput) >= 1.f) {
             SerialM.printf(
                 "FPS excursion detected! Measured input FPS %f, previous output FPS %f",
@@ -669,9 +1117,44 @@ public:
 template <class GBS, class Attrs>
 int16_t FrameSyncManager<GBS, Attrs>::syncLastCorrection;
 
+template <class GBS, class Attrs>
+uint8_t FrameSyncManager<GBS, Attrs>::syncLastMethod;
+
 template <class GBS, class Attrs>
 float FrameSyncManager<GBS, Attrs>::maybeFreqExt_per_videoFps;
 
+template <class GBS, class Attrs>
+float FrameSyncManager<GBS, Attrs>::ratePeriod;
+
+template <class GBS, class Attrs>
+float FrameSyncManager<GBS, Attrs>::rateTrend;
+
+template <class GBS, class Attrs>
+float FrameSyncManager<GBS, Attrs>::phaseIntegral;
+
+template <class GBS, class Attrs>
+float FrameSyncManager<GBS, Attrs>::ditherRate;
+
+template <class GBS, class Attrs>
+float FrameSyncManager<GBS, Attrs>::ditherLines;
+
+template <class GBS, class Attrs>
+float FrameSyncManager<GBS, Attrs>::ditherAccu;
+template <class GBS, class Attrs>
+uint8_t FrameSyncManager<GBS, Attrs>::ditherSettled;
+
+template <class GBS, class Attrs>
+uint32_t FrameSyncManager<GBS, Attrs>::ditherNext;
+
+template <class GBS, class Attrs>
+uint32_t FrameSyncManager<GBS, Attrs>::ditherPeriod;
+
+template <class GBS, class Attrs>
+uint32_t FrameSyncManager<GBS, Attrs>::lastOutputEdge;
+
+template <class GBS, class Attrs>
+bool FrameSyncManager<GBS, Attrs>::ditherActive;
+
 template <class GBS, class Attrs>
 uint8_t FrameSyncManager<GBS, Attrs>::delayLock;
 
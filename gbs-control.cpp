@@ -17,6 +17,10 @@
 #include "ofw_RGBS.h"
 #include "options.h"
 #include "slot.h"
+#include "presetfile.h"
+#include "prefsfile.h"
+#include "backupfile.h"
+#include "modeline.h"
 
 #include <Wire.h>
 #include "tv5725.h"
@@ -165,6 +169,7 @@ void externalClockGenSyncInOutRate();
 void externalClockGenDetectAndInitialize();
 static inline void writeOneByte(uint8_t slaveRegister, uint8_t value);
 static inline void writeBytes(uint8_t slaveRegister, uint8_t *values, uint8_t numValues);
+static inline void writeBytesChanged(uint8_t slaveRegister, uint8_t *values, uint8_t numValues);
 void copyBank(uint8_t *bank, const uint8_t *programArray, uint16_t *index);
 boolean videoStandardInputIsPalNtscSd();
 void zeroAll();
@@ -238,6 +243,10 @@ void setCsVsStop(uint16_t stop);
 void printVideoTimings();
 void set_htotal(uint16_t htotal);
 void set_vtotal(uint16_t vtotal);
+boolean modelineTarget(Modeline *mode);
+const uint8_t *modelineBasePreset(boolean pal);
+boolean applyModeline();
+boolean applyIntegerScale();
 void resetDebugPort();
 void readEeprom();
 void setIfHblankParameters();
@@ -276,6 +285,9 @@ boolean snapToIntegralFrameRate(void);
 void printInfo();
 void stopWire();
 void startWire();
+void calibrateWireClock();
+void saveWireClock();
+void checkWireErrors();
 void fastSogAdjust();
 void runSyncWatcher();
 boolean checkBoardPower();
@@ -292,6 +304,7 @@ void handleButtons(void);
 void discardSerialRxData();
 void updateWebSocketData();
 void handleWiFi(boolean instant);
+void busIdle();
 void myLog(char const* type, char command);
 void loop();
 void handleType2Command(char argument);
@@ -300,7 +313,25 @@ void initUpdateOTA();
 void StrClear(char *str, uint16_t length);
 const uint8_t *loadPresetFromSPIFFS(byte forVideoMode);
 void savePresetToSPIFFS();
+uint8_t slotDbMode(uint8_t videoMode);
+String presetFileName(uint8_t videoMode, Ascii8 slot);
+boolean readPresetRecord(File &f, uint8_t *payload, boolean *outdated);
+boolean readPresetFile(File &f, uint8_t *payload);
+uint16_t encodePresetRecord(const uint8_t *payload, uint8_t videoMode, uint8_t *record);
+void slotMetaDefault(SlotMeta *meta, uint8_t index);
+File slotDbOpen();
+boolean slotDbReadMeta(uint8_t index, SlotMeta *meta);
+boolean slotDbWriteMeta(uint8_t index, const SlotMeta *meta);
+boolean slotDbRemove(uint8_t index);
+boolean slotDbSwap(uint8_t a, uint8_t b);
+boolean slotDbImportFile(const String &name);
+boolean slotDbLoadPreset(Ascii8 slot, uint8_t videoMode, uint8_t *payload);
+boolean slotDbSavePreset(Ascii8 slot, uint8_t videoMode, const uint8_t *payload);
+void presetCacheInvalidate();
+boolean loadUserPrefs();
 void saveUserPrefs();
+void flushUserPrefs();
+void checkUserPrefs();
 void settingsMenuOLED();
 void pointerfunction();
 void subpointerfunction();
@@ -350,11 +381,16 @@ struct userOptions *uopt = &uopts;
 struct adcOptions adcopts;
 struct adcOptions *adco = &adcopts;
 
-String slotIndexMap = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~()!*:,";
-
 char serialCommand;               // Serial / Web Server commands
 char userCommand;               // Serial / Web Server commands
-static uint8_t lastSegment = 0xFF; // GBS segment for direct access
+static uint8_t lastSegment = 0xFF; // GBS segment for direct access (only a target, GBS:: tracks the chip's segment)
+static uint16_t presetBytesTotal = 0;   // preset bytes looked at by writeBytesChanged
+static uint16_t presetBytesWritten = 0; // and how many of them actually had to be sent
+static uint32_t wireClock = 700000;      // I2C clock, from calibrateWireClock() / "/i2cclock.txt"
+static const uint32_t wireClockMax = 700000; // the OLED is set up for this, the Si5351 known to cope
+static uint16_t wireErrorsSeen = 0;      // tw::busErrors() at the last checkWireErrors()
+static boolean userPrefsDirty = false;    // saveUserPrefs() since the last flushUserPrefs()
+static unsigned long userPrefsChanged = 0; // millis() of the last saveUserPrefs()
 //uint8_t globalDelay; // used for dev / debug
 
 #if defined(ESP8266)
@@ -437,6 +473,16 @@ struct FrameSyncAttrs
     static const int16_t syncCorrection = 2;          // Sync correction in scanlines to apply when phase lags target
     static const int32_t syncTargetPhase = 90;        // Target vsync phase offset (output trails input) in degrees
                                                       // to debug: syncTargetPhase = 343 lockInterval = 15 * 16
+    // runFrequency() (ext. clock gen) controller
+    static constexpr float rateAlpha = 0.3f;  // alpha-beta filter on the input period: weight of a new measurement
+    static constexpr float rateBeta = 0.02f;  // and of its trend
+    static constexpr float phaseKp = 0.0038f; // fps correction per frame of phase error, 2/525 (SNES vs. Wii 240p)
+    static constexpr float phaseKi = 0.001f;  // fps correction per frame of accumulated phase error
+    static const bool rateRecheck = false;    // measure the input period twice per run, the spread check covers it
+    // runVsync() FRAMESYNC_METHOD_DITHER gains, on the lines per frame that take the phase error out in one interval
+    static constexpr float ditherKp = 0.5f;
+    static constexpr float ditherKi = 0.1f;
+    static constexpr float ditherBand = 30.0f; // lines the frames may owe before the correction moves
 };
 typedef FrameSyncManager<GBS, FrameSyncAttrs> FrameSync;
 
@@ -598,12 +644,20 @@ static inline void writeOneByte(uint8_t slaveRegister, uint8_t value)
 
 static inline void writeBytes(uint8_t slaveRegister, uint8_t *values, uint8_t numValues)
 {
+    TW_PROFILE_WEAK_TAG("writeBytes");
     if (slaveRegister == 0xF0 && numValues == 1) {
         lastSegment = *values;
     } else
         GBS::write(lastSegment, slaveRegister, values, numValues);
 }
 
+// preset loading: only send what differs from the register shadow copy
+static inline void writeBytesChanged(uint8_t slaveRegister, uint8_t *values, uint8_t numValues)
+{
+    presetBytesWritten += GBS::writeChanged(lastSegment, slaveRegister, values, numValues);
+    presetBytesTotal += numValues;
+}
+
 void copyBank(uint8_t *bank, const uint8_t *programArray, uint16_t *index)
 {
     for (uint8_t x = 0; x < 16; ++x) {
@@ -622,10 +676,15 @@ boolean videoStandardInputIsPalNtscSd()
 
 void zeroAll()
 {
+    // everything gets written below, which seeds the register shadow copy
+    GBS::shadowEnable(true);
+    GBS::Transaction t; // sent as a few large bursts
+
     // turn processing units off first
     writeOneByte(0xF0, 0);
     writeOneByte(0x46, 0x00); // reset controls 1
     writeOneByte(0x47, 0x00); // reset controls 2
+    GBS::flush();             // before anything else changes
 
     // zero out entire register space
     for (int y = 0; y < 6; y++) {
@@ -657,7 +716,7 @@ void loadHdBypassSection()
     writeOneByte(0xF0, 1);
     for (int j = 3; j <= 5; j++) { // start at 0x30
         copyBank(bank, presetHdBypassSection, &index);
-        writeBytes(j * 16, bank, 16);
+        writeBytesChanged(j * 16, bank, 16);
     }
 }
 
@@ -668,7 +727,7 @@ void loadPresetDeinterlacerSection()
     writeOneByte(0xF0, 2);
     for (int j = 0; j <= 3; j++) { // start at 0x00
         copyBank(bank, presetDeinterlacerSection, &index);
-        writeBytes(j * 16, bank, 16);
+        writeBytesChanged(j * 16, bank, 16);
     }
 }
 
@@ -679,13 +738,13 @@ void loadPresetMdSection()
     writeOneByte(0xF0, 1);
     for (int j = 6; j <= 7; j++) { // start at 0x60
         copyBank(bank, presetMdSection, &index);
-        writeBytes(j * 16, bank, 16);
+        writeBytesChanged(j * 16, bank, 16);
     }
     bank[0] = pgm_read_byte(presetMdSection + index);
     bank[1] = pgm_read_byte(presetMdSection + index + 1);
     bank[2] = pgm_read_byte(presetMdSection + index + 2);
     bank[3] = pgm_read_byte(presetMdSection + index + 3);
-    writeBytes(8 * 16, bank, 4); // MD section ends at 0x83, not 0x90
+    writeBytesChanged(8 * 16, bank, 4); // MD section ends at 0x83, not 0x90
 }
 
 // programs all valid registers (the register map has holes in it, so it's not straight forward)
@@ -719,137 +778,153 @@ void writeProgramArrayNew(const uint8_t *programArray, boolean skipMDSection)
     uint8_t reset46 = GBS::RESET_CONTROL_0x46::read(); // for keeping these as they are now
     uint8_t reset47 = GBS::RESET_CONTROL_0x47::read();
 
-    for (; y < 6; y++) {
-        writeOneByte(0xF0, (uint8_t)y);
-        switch (y) {
-            case 0:
-                for (int j = 0; j <= 1; j++) { // 2 times
-                    for (int x = 0; x <= 15; x++) {
-                        if (j == 0 && x == 4) {
-                            // keep DAC off
-                            if (rto->useHdmiSyncFix) {
-                                bank[x] = pgm_read_byte(programArray + index) & ~(1 << 0);
-                            } else {
-                                bank[x] = pgm_read_byte(programArray + index);
-                            }
-                        } else if (j == 0 && x == 6) {
-                            bank[x] = reset46;
-                        } else if (j == 0 && x == 7) {
-                            bank[x] = reset47;
-                        } else if (j == 0 && x == 9) {
-                            // keep sync output off
-                            if (rto->useHdmiSyncFix) {
-                                bank[x] = pgm_read_byte(programArray + index) | (1 << 2);
+    presetBytesTotal = 0;
+    presetBytesWritten = 0;
+    uint32_t segmentSwitches = GBS::segmentSwitches();
+
+    // The banks are only staged in the shadow copy and go out below as a
+    // few long bursts. busIdle() keeps the web ui serviced in between.
+    {
+        GBS::Deferred program;
+        for (; y < 6; y++) {
+            writeOneByte(0xF0, (uint8_t)y);
+            switch (y) {
+                case 0:
+                    for (int j = 0; j <= 1; j++) { // 2 times
+                        for (int x = 0; x <= 15; x++) {
+                            if (j == 0 && x == 4) {
+                                // keep DAC off
+                                if (rto->useHdmiSyncFix) {
+                                    bank[x] = pgm_read_byte(programArray + index) & ~(1 << 0);
+                                } else {
+                                    bank[x] = pgm_read_byte(programArray + index);
+                                }
+                            } else if (j == 0 && x == 6) {
+                                bank[x] = reset46;
+                            } else if (j == 0 && x == 7) {
+                                bank[x] = reset47;
+                            } else if (j == 0 && x == 9) {
+                                // keep sync output off
+                                if (rto->useHdmiSyncFix) {
+                                    bank[x] = pgm_read_byte(programArray + index) | (1 << 2);
+                                } else {
+                                    bank[x] = pgm_read_byte(programArray + index);
+                                }
                             } else {
+                                // use preset values
                                 bank[x] = pgm_read_byte(programArray + index);
                             }
-                        } else {
-                            // use preset values
-                            bank[x] = pgm_read_byte(programArray + index);
-                        }
 
-                        index++;
-                    }
-                    writeBytes(0x40 + (j * 16), bank, 16);
-                }
-                copyBank(bank, programArray, &index);
-                writeBytes(0x90, bank, 16);
-                break;
-            case 1:
-                for (int j = 0; j <= 2; j++) { // 3 times
-                    copyBank(bank, programArray, &index);
-                    if (j == 0) {
-                        bank[0] = bank[0] & ~(1 << 5); // clear 1_00 5
-                        bank[1] = bank[1] | (1 << 0);  // set 1_01 0
-                        bank[12] = bank[12] & 0x0f;    // clear 1_0c upper bits
-                        bank[13] = 0;                  // clear 1_0d
+                            index++;
+                        }
+                        writeBytesChanged(0x40 + (j * 16), bank, 16);
                     }
-                    writeBytes(j * 16, bank, 16);
-                }
-                if (!skipMDSection) {
-                    loadPresetMdSection();
-                    if (rto->syncTypeCsync)
-                        GBS::MD_SEL_VGA60::write(0); // EDTV possible
-                    else
-                        GBS::MD_SEL_VGA60::write(1); // VGA 640x480 more likely
-
-                    GBS::MD_HD1250P_CNTRL::write(rto->medResLineCount); // patch med res support
-                }
-                break;
-            case 2:
-                loadPresetDeinterlacerSection();
-                break;
-            case 3:
-                for (int j = 0; j <= 7; j++) { // 8 times
-                    copyBank(bank, programArray, &index);
-                    //if (rto->useHdmiSyncFix) {
-                    //  if (j == 0) {
-                    //    bank[0] = bank[0] | (1 << 0); // 3_00 0 sync lock
-                    //  }
-                    //  if (j == 1) {
-                    //    bank[10] = bank[10] | (1 << 4); // 3_1a 4 frame lock
-                    //  }
-                    //}
-                    writeBytes(j * 16, bank, 16);
-                }
-                // blank out VDS PIP registers, otherwise they can end up uninitialized
-                for (int x = 0; x <= 15; x++) {
-                    writeOneByte(0x80 + x, 0x00);
-                }
-                break;
-            case 4:
-                for (int j = 0; j <= 5; j++) { // 6 times
                     copyBank(bank, programArray, &index);
-                    writeBytes(j * 16, bank, 16);
-                }
-                break;
-            case 5:
-                for (int j = 0; j <= 6; j++) { // 7 times
-                    for (int x = 0; x <= 15; x++) {
-                        bank[x] = pgm_read_byte(programArray + index);
-                        if (index == 322) { // s5_02 bit 6+7 = input selector (only bit 6 is relevant)
-                            if (rto->inputIsYpBpR)
-                                bitClear(bank[x], 6);
-                            else
-                                bitSet(bank[x], 6);
-                        }
-                        if (index == 323) { // s5_03 set clamps according to input channel
-                            if (rto->inputIsYpBpR) {
-                                bitClear(bank[x], 2); // G bottom clamp
-                                bitSet(bank[x], 1);   // R mid clamp
-                                bitSet(bank[x], 3);   // B mid clamp
-                            } else {
-                                bitClear(bank[x], 2); // G bottom clamp
-                                bitClear(bank[x], 1); // R bottom clamp
-                                bitClear(bank[x], 3); // B bottom clamp
-                            }
+                    writeBytesChanged(0x90, bank, 16);
+                    break;
+                case 1:
+                    for (int j = 0; j <= 2; j++) { // 3 times
+                        copyBank(bank, programArray, &index);
+                        if (j == 0) {
+                            bank[0] = bank[0] & ~(1 << 5); // clear 1_00 5
+                            bank[1] = bank[1] | (1 << 0);  // set 1_01 0
+                            bank[12] = bank[12] & 0x0f;    // clear 1_0c upper bits
+                            bank[13] = 0;                  // clear 1_0d
                         }
-                        //if (index == 324) { // s5_04 reset(0) for ADC REF init
-                        //  bank[x] = 0x00;
+                        writeBytesChanged(j * 16, bank, 16);
+                    }
+                    if (!skipMDSection) {
+                        loadPresetMdSection();
+                        if (rto->syncTypeCsync)
+                            GBS::MD_SEL_VGA60::write(0); // EDTV possible
+                        else
+                            GBS::MD_SEL_VGA60::write(1); // VGA 640x480 more likely
+
+                        GBS::MD_HD1250P_CNTRL::write(rto->medResLineCount); // patch med res support
+                    }
+                    break;
+                case 2:
+                    loadPresetDeinterlacerSection();
+                    break;
+                case 3:
+                    for (int j = 0; j <= 7; j++) { // 8 times
+                        copyBank(bank, programArray, &index);
+                        //if (rto->useHdmiSyncFix) {
+                        //  if (j == 0) {
+                        //    bank[0] = bank[0] | (1 << 0); // 3_00 0 sync lock
+                        //  }
+                        //  if (j == 1) {
+                        //    bank[10] = bank[10] | (1 << 4); // 3_1a 4 frame lock
+                        //  }
                         //}
-                        if (index == 352) { // s5_20 always force to 0x02 (only SP_SOG_P_ATO)
-                            bank[x] = 0x02;
-                        }
-                        if (index == 375) { // s5_37
-                            if (videoStandardInputIsPalNtscSd()) {
-                                bank[x] = 0x6b;
-                            } else {
+                        writeBytesChanged(j * 16, bank, 16);
+                    }
+                    // blank out VDS PIP registers, otherwise they can end up uninitialized
+                    memset(bank, 0, sizeof(bank));
+                    writeBytesChanged(0x80, bank, 16);
+                    break;
+                case 4:
+                    for (int j = 0; j <= 5; j++) { // 6 times
+                        copyBank(bank, programArray, &index);
+                        writeBytesChanged(j * 16, bank, 16);
+                    }
+                    break;
+                case 5:
+                    for (int j = 0; j <= 6; j++) { // 7 times
+                        for (int x = 0; x <= 15; x++) {
+                            bank[x] = pgm_read_byte(programArray + index);
+                            if (index == 322) { // s5_02 bit 6+7 = input selector (only bit 6 is relevant)
+                                if (rto->inputIsYpBpR)
+                                    bitClear(bank[x], 6);
+                                else
+                                    bitSet(bank[x], 6);
+                            }
+                            if (index == 323) { // s5_03 set clamps according to input channel
+                                if (rto->inputIsYpBpR) {
+                                    bitClear(bank[x], 2); // G bottom clamp
+                                    bitSet(bank[x], 1);   // R mid clamp
+                                    bitSet(bank[x], 3);   // B mid clamp
+                                } else {
+                                    bitClear(bank[x], 2); // G bottom clamp
+                                    bitClear(bank[x], 1); // R bottom clamp
+                                    bitClear(bank[x], 3); // B bottom clamp
+                                }
+                            }
+                            //if (index == 324) { // s5_04 reset(0) for ADC REF init
+                            //  bank[x] = 0x00;
+                            //}
+                            if (index == 352) { // s5_20 always force to 0x02 (only SP_SOG_P_ATO)
                                 bank[x] = 0x02;
                             }
+                            if (index == 375) { // s5_37
+                                if (videoStandardInputIsPalNtscSd()) {
+                                    bank[x] = 0x6b;
+                                } else {
+                                    bank[x] = 0x02;
+                                }
+                            }
+                            if (index == 382) {     // s5_3e
+                                bitSet(bank[x], 5); // SP_DIS_SUB_COAST = 1
+                            }
+                            if (index == 407) {     // s5_57
+                                bitSet(bank[x], 0); // SP_NO_CLAMP_REG = 1
+                            }
+                            index++;
                         }
-                        if (index == 382) {     // s5_3e
-                            bitSet(bank[x], 5); // SP_DIS_SUB_COAST = 1
-                        }
-                        if (index == 407) {     // s5_57
-                            bitSet(bank[x], 0); // SP_NO_CLAMP_REG = 1
-                        }
-                        index++;
+                        writeBytesChanged(j * 16, bank, 16);
                     }
-                    writeBytes(j * 16, bank, 16);
-                }
-                break;
+                    break;
+            }
         }
     }
+    GBS::flush();
+
+    SerialM.print(F("preset: wrote "));
+    SerialM.print(presetBytesWritten);
+    SerialM.print(F(" of "));
+    SerialM.print(presetBytesTotal);
+    SerialM.print(F(" bytes, segment switches: "));
+    SerialM.println(GBS::segmentSwitches() - segmentSwitches);
 
     // scaling RGBHV mode
     if (uopt->preferScalingRgbhv && rto->isValidForScalingRGBHV) {
@@ -874,6 +949,9 @@ void activeFrameTimeLockInitialSteps()
         if (uopt->frameTimeLockMethod == 1) {
             SerialM.println(F("1 (vtotal only)"));
         }
+        if (uopt->frameTimeLockMethod == FRAMESYNC_METHOD_DITHER) {
+            SerialM.println(F("2 (vtotal dithered)"));
+        }
         if (GBS::VDS_VS_ST::read() == 0) {
             // VS_ST needs to be at least 1, so method 1 can decrease it when needed (but currently only increases VS_ST)
             // don't force this here, instead make sure to have all presets follow the rule (easier dev)
@@ -927,6 +1005,7 @@ void setResetParameters()
     rto->osr = 0;
     rto->useHdmiSyncFix = 0;
     rto->notRecognizedCounter = 0;
+    rto->integerScale = 0;
 
     adco->r_gain = 0;
     adco->g_gain = 0;
@@ -1853,6 +1932,7 @@ uint8_t getSingleByteFromPreset(const uint8_t *programArray, unsigned int offset
 
 static inline void readFromRegister(uint8_t reg, int bytesToRead, uint8_t *output)
 {
+    TW_PROFILE_WEAK_TAG("readFromRegister");
     return GBS::read(lastSegment, reg, output, bytesToRead);
 }
 
@@ -2399,7 +2479,7 @@ void scaleVertical(uint16_t amountToScale, bool subtracting)
 void shiftVertical(uint16_t amountToAdd, bool subtracting)
 {
     typedef GBS::Tie<GBS::VDS_VB_ST, GBS::VDS_VB_SP> Regs;
-    uint16_t vrst = GBS::VDS_VSYNC_RST::read() - FrameSync::getSyncLastCorrection();
+    uint16_t vrst = GBS::VDS_VSYNC_RST::read() - FrameSync::getSyncLastVtotalCorrection();
     uint16_t vbst = 0, vbsp = 0;
     int16_t newVbst = 0, newVbsp = 0;
 
@@ -2726,6 +2806,196 @@ void set_vtotal(uint16_t vtotal)
     GBS::VDS_VSYN_SIZE2::write(GBS::VDS_VSYNC_RST::read() + 2);
 }
 
+// the display mode OutputModeline is for, from uopt
+boolean modelineTarget(Modeline *mode)
+{
+    boolean ok = uopt->modelineId == MODELINE_ID_CVT_RB
+                     ? modelineCvtRb(uopt->modelineWidth, uopt->modelineHeight, uopt->modelineRefresh, mode)
+                     : modelineFromTable(uopt->modelineId, mode);
+    if (ok && uopt->modelineSync != 0xff) {
+        mode->flags = uopt->modelineSync & (MODELINE_HSYNC_POS | MODELINE_VSYNC_POS);
+    }
+    return ok;
+}
+
+// The built-in preset OutputModeline starts from: the one with the next
+// larger output height, so the source is scaled about as much already
+const uint8_t *modelineBasePreset(boolean pal)
+{
+    Modeline mode;
+    uint16_t height = modelineTarget(&mode) ? mode.vActive : 960;
+    if (height <= 576) {
+        return pal ? pal_768x576 : ntsc_720x480;
+    } else if (height <= 720) {
+        return pal ? pal_1280x720 : ntsc_1280x720;
+    } else if (height <= 960) {
+        return pal ? pal_240p : ntsc_240p;
+    } else if (height <= 1024) {
+        return pal ? pal_1280x1024 : ntsc_1280x1024;
+    }
+    return pal ? pal_1920x1080 : ntsc_1920x1080;
+}
+
+// Retimes the output of the loaded base preset to the OutputModeline
+// target. What the preset's scaling showed over its active area is
+// scaled to the new one, the memory blanking keeps its lead on the
+// display blanking.
+boolean applyModeline()
+{
+    Modeline mode;
+    VdsTiming vds;
+    if (!modelineTarget(&mode) || !modelineToVds(mode, &vds)) {
+        SerialM.println(F("modeline not possible, keeping preset timing"));
+        return false;
+    }
+
+    uint16_t htotal = GBS::VDS_HSYNC_RST::read();
+    uint16_t vtotal = GBS::VDS_VSYNC_RST::read();
+    uint16_t width = (GBS::VDS_DIS_HB_ST::read() + htotal - GBS::VDS_DIS_HB_SP::read()) % htotal;
+    uint16_t height = (GBS::VDS_DIS_VB_ST::read() + vtotal - GBS::VDS_DIS_VB_SP::read()) % vtotal;
+    uint16_t hbStartLead = (GBS::VDS_DIS_HB_ST::read() + htotal - GBS::VDS_HB_ST::read()) % htotal;
+    uint16_t hbStopLead = (GBS::VDS_DIS_HB_SP::read() + htotal - GBS::VDS_HB_SP::read()) % htotal;
+    uint16_t vbStartLead = (GBS::VDS_DIS_VB_SP::read() + vtotal - GBS::VDS_VB_ST::read()) % vtotal;
+    uint16_t vbStopLead = (GBS::VDS_DIS_VB_SP::read() + vtotal - GBS::VDS_VB_SP::read()) % vtotal;
+    uint16_t newWidth = (vds.hblankStart + vds.htotal - vds.hblankStop) % vds.htotal;
+    uint16_t newHeight = (vds.vblankStart + vds.vtotal - vds.vblankStop) % vds.vtotal;
+
+    GBS::PLL648_CONTROL_01::write(vds.displayClock);
+    set_htotal(vds.htotal);
+    set_vtotal(vds.vtotal);
+    setHSyncStartPosition(vds.hsyncStart);
+    setHSyncStopPosition(vds.hsyncStop);
+    setDisplayHblankStartPosition(vds.hblankStart);
+    setDisplayHblankStopPosition(vds.hblankStop);
+    setMemoryHblankStartPosition((vds.hblankStart + vds.htotal - hbStartLead) % vds.htotal);
+    setMemoryHblankStopPosition((vds.hblankStop + vds.htotal - hbStopLead) % vds.htotal);
+    setVSyncStartPosition(vds.vsyncStart);
+    setVSyncStopPosition(vds.vsyncStop);
+    setDisplayVblankStartPosition(vds.vblankStart);
+    setDisplayVblankStopPosition(vds.vblankStop);
+    setMemoryVblankStartPosition((vds.vblankStop + vds.vtotal - vbStartLead) % vds.vtotal);
+    setMemoryVblankStopPosition((vds.vblankStop + vds.vtotal - vbStopLead) % vds.vtotal);
+    if (GBS::VDS_HSCALE_BYPS::read() == 0 && width > 0 && newWidth > 0) {
+        GBS::VDS_HSCALE::write(modelineScale(GBS::VDS_HSCALE::read(), width, newWidth));
+    }
+    if (GBS::VDS_VSCALE_BYPS::read() == 0 && height > 0 && newHeight > 0) {
+        GBS::VDS_VSCALE::write(modelineScale(GBS::VDS_VSCALE::read(), height, newHeight));
+    }
+
+    SerialM.print(F("modeline "));
+    SerialM.print(mode.hActive);
+    SerialM.print("x");
+    SerialM.print(mode.vActive);
+    SerialM.print(F(" clock: "));
+    SerialM.print(vds.clock);
+    SerialM.print(F(" total: "));
+    SerialM.print(vds.htotal);
+    SerialM.print("x");
+    SerialM.println(vds.vtotal);
+    return true;
+}
+
+// For 240p / 288p sources: every source line becomes N output lines and
+// every VDS input pixel M display clocks, N and M as large as the loaded
+// preset's active area allows. The output frame is N source frames' worth
+// of lines, so a frame lock that only changes the clock (ext. clock gen)
+// or the line length (FRAMESYNC_METHOD_HTOTAL) keeps the ratio.
+boolean applyIntegerScale()
+{
+    if (rto->videoStandardInput != 1 && rto->videoStandardInput != 2) {
+        return false;
+    }
+    boolean pal = rto->videoStandardInput == 2;
+    uint16_t srcLines = pal ? 288 : 240;
+    uint16_t srcVtotal = GBS::STATUS_SYNC_PROC_VTOTAL::read();
+    if (srcVtotal < 250 || srcVtotal > 330) {
+        srcVtotal = pal ? 312 : 262;
+    }
+
+    uint16_t htotal = GBS::VDS_HSYNC_RST::read();
+    uint16_t vtotal = GBS::VDS_VSYNC_RST::read();
+    uint16_t hbStart = GBS::VDS_DIS_HB_ST::read();
+    uint16_t hbStop = GBS::VDS_DIS_HB_SP::read();
+    uint16_t vbStart = GBS::VDS_DIS_VB_ST::read();
+    uint16_t vbStop = GBS::VDS_DIS_VB_SP::read();
+    uint16_t width = (hbStart + htotal - hbStop) % htotal;
+    uint16_t height = (vbStart + vtotal - vbStop) % vtotal;
+    uint16_t hbStartLead = (hbStart + htotal - GBS::VDS_HB_ST::read()) % htotal;
+    uint16_t hbStopLead = (hbStop + htotal - GBS::VDS_HB_SP::read()) % htotal;
+    uint16_t vbStartLead = (vbStop + vtotal - GBS::VDS_VB_ST::read()) % vtotal;
+    uint16_t vbStopLead = (vbStop + vtotal - GBS::VDS_VB_SP::read()) % vtotal;
+
+    uint8_t lines = height / srcLines;
+    uint16_t newVtotal = lines * srcVtotal;
+    if (lines < 2 || newVtotal > 2047) {
+        SerialM.println(F("integer scale not possible, keeping preset scaling"));
+        return false;
+    }
+    uint16_t newHeight = lines * srcLines;
+
+    // the line rate of the new frame picks the display clock, htotal gets
+    // tuned to the source later (FrameSync::init())
+    VdsTiming vds;
+    if (!modelineDisplayClock((uint64_t)(pal ? 50 : 60) * 1000 * newVtotal, &vds)) {
+        return false;
+    }
+    boolean hBypass = GBS::VDS_HSCALE_BYPS::read();
+    uint16_t hscale = hBypass ? 1024 : GBS::VDS_HSCALE::read();
+    uint16_t pixels = (uint32_t)width * hscale / 1024;
+    uint8_t clocks = integerScaleClocksPerPixel(hscale);
+    while (clocks > 1 && (uint32_t)pixels * clocks > vds.htotal - INTEGER_SCALE_MIN_BLANK) {
+        clocks--;
+    }
+    uint16_t newWidth = pixels * clocks;
+    if (newWidth == 0 || newWidth > vds.htotal - INTEGER_SCALE_MIN_BLANK) {
+        SerialM.println(F("integer scale not possible, keeping preset scaling"));
+        return false;
+    }
+
+    uint16_t newHbStop = integerScalePlace(hbStop, width, htotal, newWidth, vds.htotal);
+    uint16_t newHbStart = (newHbStop + newWidth) % vds.htotal;
+    uint16_t newVbStop = integerScalePlace(vbStop, height, vtotal, newHeight, newVtotal);
+    uint16_t newVbStart = (newVbStop + newHeight) % newVtotal;
+
+    GBS::PLL648_CONTROL_01::write(vds.displayClock);
+    GBS::VDS_HSYNC_RST::write(vds.htotal);
+    setHSyncStartPosition((uint32_t)GBS::VDS_HS_ST::read() * vds.htotal / htotal);
+    setHSyncStopPosition((uint32_t)GBS::VDS_HS_SP::read() * vds.htotal / htotal);
+    setDisplayHblankStartPosition(newHbStart);
+    setDisplayHblankStopPosition(newHbStop);
+    setMemoryHblankStartPosition((newHbStart + vds.htotal - hbStartLead) % vds.htotal);
+    setMemoryHblankStopPosition((newHbStop + vds.htotal - hbStopLead) % vds.htotal);
+    GBS::VDS_VSYNC_RST::write(newVtotal);
+    GBS::VDS_VSYN_SIZE1::write(newVtotal + 2);
+    GBS::VDS_VSYN_SIZE2::write(newVtotal + 2);
+    setDisplayVblankStartPosition(newVbStart);
+    setDisplayVblankStopPosition(newVbStop);
+    setMemoryVblankStartPosition((newVbStop + newVtotal - vbStartLead) % newVtotal);
+    setMemoryVblankStopPosition((newVbStop + newVtotal - vbStopLead) % newVtotal);
+    // SD sources reach the VDS line doubled, 2 lines per source line is 1:1
+    GBS::VDS_VSCALE_BYPS::write(lines == 2);
+    if (lines > 2) {
+        GBS::VDS_VSCALE::write(integerScaleVscale(lines));
+    }
+    GBS::VDS_HSCALE_BYPS::write(clocks == 1);
+    if (clocks > 1) {
+        GBS::VDS_HSCALE::write(integerScaleHscale(clocks));
+    }
+    rto->integerScale = lines;
+
+    SerialM.print(F("integer scale "));
+    SerialM.print(lines);
+    SerialM.print("x");
+    SerialM.print(clocks);
+    SerialM.print(F(" clock: "));
+    SerialM.print(vds.clock);
+    SerialM.print(F(" total: "));
+    SerialM.print(vds.htotal);
+    SerialM.print("x");
+    SerialM.println(newVtotal);
+    return true;
+}
+
 void resetDebugPort()
 {
     GBS::PAD_BOUT_EN::write(1); // output to pad enabled
@@ -2887,7 +3157,7 @@ boolean runAutoBestHTotal()
                     GBS::IF_TEST_SEL::write(3); // IF averaged frame time
 
                 yield();
-                uint16_t bestHTotal = FrameSync::init(); // critical task
+                uint16_t bestHTotal = FrameSync::init(rto->integerScale ? FRAMESYNC_METHOD_HTOTAL : uopt->frameTimeLockMethod); // critical task
                 yield();
 
                 GBS::TEST_BUS_SEL::write(testBusSelBackup); // always restore from backup (TB has changed)
@@ -3277,6 +3547,7 @@ float getSourceFieldRate(boolean useSPBus)
         GBS::TEST_BUS_SP_SEL::write(spBusSelBackup);
     if (ifBusSelBackup != 3)
         GBS::IF_TEST_SEL::write(ifBusSelBackup);
+    FrameSync::debugBusChanged();
 
     return retVal;
 }
@@ -3314,6 +3585,7 @@ float getOutputFrameRate()
 
     GBS::TEST_BUS_SEL::write(testBusSelBackup);
     GBS::PAD_BOUT_EN::write(debugPinBackup);
+    FrameSync::debugBusChanged();
 
     return retVal;
 }
@@ -3337,6 +3609,7 @@ uint32_t getPllRate()
             GBS::TEST_BUS_SP_SEL::write(0x09);
     }
     GBS::PAD_BOUT_EN::write(1); // enable output to pin for test
+    GBS::flush();               // may be called inside a transaction
     yield();                    // BOUT signal and wifi
     delayMicroseconds(200);
     uint32_t ticks = FrameSync::getPulseTicks();
@@ -3347,6 +3620,7 @@ uint32_t getPllRate()
         GBS::TEST_BUS_SEL::write(testBusSelBackup);
     }
     GBS::TEST_BUS_SP_SEL::write(spBusSelBackup);
+    FrameSync::debugBusChanged();
 
     uint32_t retVal = 0;
     if (ticks > 0) {
@@ -3504,6 +3778,7 @@ void doPostPresetLoadSteps()
     }
 
     if (!rto->isCustomPreset) {
+        GBS::Transaction t; // format specific patches go out in a few bursts
         if (rto->videoStandardInput == 3 || rto->videoStandardInput == 4 ||
             rto->videoStandardInput == 8 || rto->videoStandardInput == 9) {
             GBS::IF_LD_RAM_BYPS::write(1); // 1_0c 0 no LD, do this before setIfHblankParameters
@@ -3654,6 +3929,7 @@ void doPostPresetLoadSteps()
                 GBS::MADPT_PD_RAM_BYPS::write(0);       // 2_24 2 one line fifo for line phase adjust
                 GBS::MADPT_VSCALE_DEC_FACTOR::write(1); // 2_31 0..1
                 GBS::MADPT_SEL_PHASE_INI::write(1);     // 2_31 2 enable
+                GBS::flush();                           // a pulse, don't let the writes merge
                 GBS::MADPT_SEL_PHASE_INI::write(0);     // 2_31 2 disable
             }
         }
@@ -3885,6 +4161,14 @@ void doPostPresetLoadSteps()
         GBS::VDS_UV_STEP_BYPS::write(1);
     }
 
+    if (uopt->presetPreference == OutputModeline && !rto->isCustomPreset && !rto->outModeHdBypass) {
+        applyModeline(); // before the display clock goes to the ext. gen and htotal gets tuned
+    }
+    rto->integerScale = 0;
+    if (uopt->wantIntegerScale && !rto->isCustomPreset && !rto->outModeHdBypass) {
+        applyIntegerScale();
+    }
+
     // transfer preset's display clock to ext. gen
     externalClockGenResetClock();
 
@@ -4412,6 +4696,8 @@ void applyPresets(uint8_t result)
             writeProgramArrayNew(ntsc_1920x1080, false);
         } else if (uopt->presetPreference == 6) {
             writeProgramArrayNew(ntsc_downscale, false);
+        } else if (uopt->presetPreference == OutputModeline) {
+            writeProgramArrayNew(modelineBasePreset(false), false);
         }
     } else if (result == 2 || result == 4) {
         // PAL input
@@ -4442,6 +4728,8 @@ void applyPresets(uint8_t result)
             writeProgramArrayNew(pal_1920x1080, false);
         } else if (uopt->presetPreference == 6) {
             writeProgramArrayNew(pal_downscale, false);
+        } else if (uopt->presetPreference == OutputModeline) {
+            writeProgramArrayNew(modelineBasePreset(true), false);
         }
     } else if (result == 5 || result == 6 || result == 7 || result == 13) {
         // use bypass mode for these HD sources
@@ -5204,232 +5492,237 @@ void setOutModeHdBypass(bool regsInitialized)
     resetDebugPort();
 
     rto->autoBestHtotalEnabled = false; // need to re-set this
-    GBS::OUT_SYNC_SEL::write(1);        // 0_4f 1=sync from HDBypass, 2=sync from SP, 0 = sync from VDS
-
-    GBS::PLL_CKIS::write(0);    // 0_40 0 //  0: PLL uses OSC clock | 1: PLL uses input clock
-    GBS::PLL_DIVBY2Z::write(0); // 0_40 1 // 1= no divider (full clock, ie 27Mhz) 0 = halved
-    //GBS::PLL_ADS::write(0); // 0_40 3 test:  input clock is from PCLKIN (disconnected, not ADC clock)
-    GBS::PAD_OSC_CNTRL::write(1); // test: noticed some wave pattern in 720p source, this fixed it
-    GBS::PLL648_CONTROL_01::write(0x35);
-    GBS::PLL648_CONTROL_03::write(0x00);
-    GBS::PLL_LEN::write(1); // 0_43
-    GBS::DAC_RGBS_R0ENZ::write(1);
-    GBS::DAC_RGBS_G0ENZ::write(1); // 0_44
-    GBS::DAC_RGBS_B0ENZ::write(1);
-    GBS::DAC_RGBS_S1EN::write(1); // 0_45
-    // from RGBHV tests: the memory bus can be tri stated for noise reduction
-    GBS::PAD_TRI_ENZ::write(1);        // enable tri state
-    GBS::PLL_MS::write(2);             // select feedback clock (but need to enable tri state!)
-    GBS::MEM_PAD_CLK_INVERT::write(0); // helps also
-    GBS::RESET_CONTROL_0x47::write(0x1f);
-
-    // update: found the real use of HDBypass :D
-    GBS::DAC_RGBS_BYPS2DAC::write(1);
-    GBS::SP_HS_LOOP_SEL::write(1);
-    GBS::SP_HS_PROC_INV_REG::write(0); // (5_56_5) do not invert HS
-    GBS::SP_CS_P_SWAP::write(0);       // old default, set here to reset between HDBypass formats
-    GBS::SP_HS2PLL_INV_REG::write(0);  // same
-
-    GBS::PB_BYPASS::write(1);
-    GBS::PLLAD_MD::write(2345); // 2326 looks "better" on my LCD but 2345 looks just correct on scope
-    GBS::PLLAD_KS::write(2);    // 5_16 post divider 0 : FCKO1 > 87MHz, 3 : FCKO1<23MHz
-    setOverSampleRatio(2, true);
-    GBS::PLLAD_ICP::write(5);
-    GBS::PLLAD_FS::write(1);
+    {
+        GBS::Transaction t;
+        GBS::OUT_SYNC_SEL::write(1);        // 0_4f 1=sync from HDBypass, 2=sync from SP, 0 = sync from VDS
+
+        GBS::PLL_CKIS::write(0);    // 0_40 0 //  0: PLL uses OSC clock | 1: PLL uses input clock
+        GBS::PLL_DIVBY2Z::write(0); // 0_40 1 // 1= no divider (full clock, ie 27Mhz) 0 = halved
+        //GBS::PLL_ADS::write(0); // 0_40 3 test:  input clock is from PCLKIN (disconnected, not ADC clock)
+        GBS::PAD_OSC_CNTRL::write(1); // test: noticed some wave pattern in 720p source, this fixed it
+        GBS::PLL648_CONTROL_01::write(0x35);
+        GBS::PLL648_CONTROL_03::write(0x00);
+        GBS::PLL_LEN::write(1); // 0_43
+        GBS::DAC_RGBS_R0ENZ::write(1);
+        GBS::DAC_RGBS_G0ENZ::write(1); // 0_44
+        GBS::DAC_RGBS_B0ENZ::write(1);
+        GBS::DAC_RGBS_S1EN::write(1); // 0_45
+        // from RGBHV tests: the memory bus can be tri stated for noise reduction
+        GBS::PAD_TRI_ENZ::write(1);        // enable tri state
+        GBS::PLL_MS::write(2);             // select feedback clock (but need to enable tri state!)
+        GBS::MEM_PAD_CLK_INVERT::write(0); // helps also
+        GBS::flush(); // release the resets with pll and pads already set up
+        GBS::RESET_CONTROL_0x47::write(0x1f);
+        GBS::flush();
+
+        // update: found the real use of HDBypass :D
+        GBS::DAC_RGBS_BYPS2DAC::write(1);
+        GBS::SP_HS_LOOP_SEL::write(1);
+        GBS::SP_HS_PROC_INV_REG::write(0); // (5_56_5) do not invert HS
+        GBS::SP_CS_P_SWAP::write(0);       // old default, set here to reset between HDBypass formats
+        GBS::SP_HS2PLL_INV_REG::write(0);  // same
+
+        GBS::PB_BYPASS::write(1);
+        GBS::PLLAD_MD::write(2345); // 2326 looks "better" on my LCD but 2345 looks just correct on scope
+        GBS::PLLAD_KS::write(2);    // 5_16 post divider 0 : FCKO1 > 87MHz, 3 : FCKO1<23MHz
+        setOverSampleRatio(2, true);
+        GBS::PLLAD_ICP::write(5);
+        GBS::PLLAD_FS::write(1);
+
+        if (rto->inputIsYpBpR) {
+            GBS::DEC_MATRIX_BYPS::write(1); // 5_1f 2 = 1 for YUV / 0 for RGB
+            GBS::HD_MATRIX_BYPS::write(0);  // 1_30 1 / input to jacks is yuv, adc leaves it as yuv > convert to rgb for output here
+            GBS::HD_DYN_BYPS::write(0);     // don't bypass color expansion
+                                            //GBS::HD_U_OFFSET::write(3);     // color adjust via scope
+                                            //GBS::HD_V_OFFSET::write(3);     // color adjust via scope
+        } else {
+            GBS::DEC_MATRIX_BYPS::write(1); // this is normally RGB input for HDBYPASS out > no color matrix at all
+            GBS::HD_MATRIX_BYPS::write(1);  // 1_30 1 / input is rgb, adc leaves it as rgb > bypass matrix
+            GBS::HD_DYN_BYPS::write(1);     // bypass as well
+        }
+
+        GBS::HD_SEL_BLK_IN::write(0); // 0 enables HDB blank timing (1 would be DVI, not working atm)
+
+        GBS::SP_SDCS_VSST_REG_H::write(0); // S5_3B
+        GBS::SP_SDCS_VSSP_REG_H::write(0); // S5_3B
+        GBS::SP_SDCS_VSST_REG_L::write(0); // S5_3F // 3 for SP sync
+        GBS::SP_SDCS_VSSP_REG_L::write(2); // S5_40 // 10 for SP sync // check with interlaced sources
+
+        GBS::HD_HSYNC_RST::write(0x3ff); // max 0x7ff
+        GBS::HD_INI_ST::write(0);        // todo: test this at 0 / was 0x298
+        // timing into HDB is PLLAD_MD with PLLAD_KS divider: KS = 0 > full PLLAD_MD
+        if (rto->videoStandardInput <= 2) {
+            // PAL and NTSC are rewrites, the rest is still handled normally
+            // These 2 formats now have SP_HS2PLL_INV_REG set. That's the only way I know so far that
+            // produces recovered HSyncs that align to the falling edge of the input
+            // ToDo: find reliable input active flank detect to then set SP_HS2PLL_INV_REG correctly
+            // (for PAL/NTSC polarity is known to be active low, but other formats are variable)
+            GBS::SP_HS2PLL_INV_REG::write(1);  //5_56 1 lock to falling HS edge // check > sync issues with MD
+            GBS::SP_CS_P_SWAP::write(1);       //5_3e 0 new: this should negate the problem with inverting HS2PLL
+            GBS::SP_HS_PROC_INV_REG::write(1); // (5_56_5) invert HS to DEC
+            // invert mode detect HS/VS triggers, helps PSX NTSC detection. required with 5_3e 0 set
+            GBS::MD_HS_FLIP::write(1);
+            GBS::MD_VS_FLIP::write(1);
+            GBS::OUT_SYNC_SEL::write(2);   // new: 0_4f 1=sync from HDBypass, 2=sync from SP, 0 = sync from VDS
+            GBS::SP_HS_LOOP_SEL::write(0); // 5_57 6 new: use full SP sync, enable HS positioning and pulse length control
+            GBS::ADC_FLTR::write(3);       // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
+            //GBS::HD_INI_ST::write(0x76); // 1_39
+
+            GBS::HD_HSYNC_RST::write((GBS::PLLAD_MD::read() / 2) + 8); // ADC output pixel count determined
+            GBS::HD_HB_ST::write(GBS::PLLAD_MD::read() * 0.945f);      // 1_3B  // no idea why it's not coupled to HD_RST
+            GBS::HD_HB_SP::write(0x90);                                // 1_3D
+            GBS::HD_HS_ST::write(0x80);                                // 1_3F  // but better to use SP sync directly (OUT_SYNC_SEL = 2)
+            GBS::HD_HS_SP::write(0x00);                                // 1_41  //
+            // to use SP sync directly; prepare reasonable out HS length
+            GBS::SP_CS_HS_ST::write(0xA0);
+            GBS::SP_CS_HS_SP::write(0x00);
+
+            if (rto->videoStandardInput == 1) {
+                setCsVsStart(250);         // don't invert VS with direct SP sync mode
+                setCsVsStop(1);            // stop relates to HS pulses from CS decoder directly, so mind EQ pulses
+                GBS::HD_VB_ST::write(500); // 1_43
+                GBS::HD_VS_ST::write(3);   // 1_47 // but better to use SP sync directly (OUT_SYNC_SEL = 2)
+                GBS::HD_VS_SP::write(522); // 1_49 //
+                GBS::HD_VB_SP::write(16);  // 1_45
+            }
+            if (rto->videoStandardInput == 2) {
+                setCsVsStart(301);         // don't invert
+                setCsVsStop(5);            // stop past EQ pulses (6 on psx) normally, but HDMI adapter works with -=1 (5)
+                GBS::HD_VB_ST::write(605); // 1_43
+                GBS::HD_VS_ST::write(1);   // 1_47
+                GBS::HD_VS_SP::write(621); // 1_49
+                GBS::HD_VB_SP::write(16);  // 1_45
+            }
+        } else if (rto->videoStandardInput == 3 || rto->videoStandardInput == 4) { // 480p, 576p
+            GBS::ADC_FLTR::write(2);                                               // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
+            GBS::PLLAD_KS::write(1);                                               // 5_16 post divider
+            GBS::PLLAD_CKOS::write(0);                                             // 5_16 2x OS (with KS=1)
+            //GBS::HD_INI_ST::write(0x76); // 1_39
+            GBS::HD_HB_ST::write(0x864); // 1_3B
+                // you *must* begin hblank before hsync.
+            GBS::HD_HB_SP::write(0xa0);  // 1_3D
+            GBS::HD_VB_ST::write(0x00);  // 1_43
+            GBS::HD_VB_SP::write(0x40);  // 1_45
+            if (rto->videoStandardInput == 3) {
+                GBS::HD_HS_ST::write(0x54);  // 1_3F
+                GBS::HD_HS_SP::write(0x864); // 1_41
+                GBS::HD_VS_ST::write(0x06);  // 1_47 // VS neg
+                GBS::HD_VS_SP::write(0x00);  // 1_49
+                setCsVsStart(525 - 5);
+                setCsVsStop(525 - 3);
+            }
+            if (rto->videoStandardInput == 4) {
+                GBS::HD_HS_ST::write(0x10);  // 1_3F
+                GBS::HD_HS_SP::write(0x880); // 1_41
+                GBS::HD_VS_ST::write(0x06);  // 1_47 // VS neg
+                GBS::HD_VS_SP::write(0x00);  // 1_49
+                setCsVsStart(48);
+                setCsVsStop(46);
+            }
+        } else if (rto->videoStandardInput <= 7 || rto->videoStandardInput == 13) {
+            //GBS::SP_HS2PLL_INV_REG::write(0); // 5_56 1 use rising edge of tri-level sync // always 0 now
+            if (rto->videoStandardInput == 5) { // 720p
+                GBS::PLLAD_MD::write(2474);     // override from 2345
+                GBS::HD_HSYNC_RST::write(550);  // 1_37
+                //GBS::HD_INI_ST::write(78);     // 1_39
+                // 720p has high pllad vco output clock, so don't do oversampling
+                GBS::PLLAD_KS::write(0);       // 5_16 post divider 0 : FCKO1 > 87MHz, 3 : FCKO1<23MHz
+                GBS::PLLAD_CKOS::write(0);     // 5_16 1x OS (with KS=CKOS=0)
+                GBS::ADC_FLTR::write(0);       // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
+                GBS::ADC_CLK_ICLK1X::write(0); // 5_00 4 (OS=1)
+                GBS::DEC2_BYPS::write(1);      // 5_1f 1 // dec2 disabled (OS=1)
+                GBS::PLLAD_ICP::write(6);      // fine at 6 only, FS is 1
+                GBS::PLLAD_FS::write(1);
+                GBS::HD_HB_ST::write(0);     // 1_3B
+                GBS::HD_HB_SP::write(0x140); // 1_3D
+                GBS::HD_HS_ST::write(0x20);  // 1_3F
+                GBS::HD_HS_SP::write(0x80);  // 1_41
+                GBS::HD_VB_ST::write(0x00);  // 1_43
+                GBS::HD_VB_SP::write(0x6c);  // 1_45 // ps3 720p tested
+                GBS::HD_VS_ST::write(0x00);  // 1_47
+                GBS::HD_VS_SP::write(0x05);  // 1_49
+                setCsVsStart(2);
+                setCsVsStop(0);
+            }
+            if (rto->videoStandardInput == 6) { // 1080i
+                // interl. source
+                GBS::HD_HSYNC_RST::write(0x710); // 1_37
+                //GBS::HD_INI_ST::write(2);    // 1_39
+                GBS::PLLAD_KS::write(1);    // 5_16 post divider
+                GBS::PLLAD_CKOS::write(0);  // 5_16 2x OS (with KS=1)
+                GBS::ADC_FLTR::write(1);    // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
+                GBS::HD_HB_ST::write(0);    // 1_3B
+                GBS::HD_HB_SP::write(0xb8); // 1_3D
+                GBS::HD_HS_ST::write(0x04); // 1_3F
+                GBS::HD_HS_SP::write(0x50); // 1_41
+                GBS::HD_VB_ST::write(0x00); // 1_43
+                GBS::HD_VB_SP::write(0x1e); // 1_45
+                GBS::HD_VS_ST::write(0x04); // 1_47
+                GBS::HD_VS_SP::write(0x09); // 1_49
+                setCsVsStart(8);
+                setCsVsStop(6);
+            }
+            if (rto->videoStandardInput == 7) {  // 1080p
+                GBS::PLLAD_MD::write(2749);      // override from 2345
+                GBS::HD_HSYNC_RST::write(0x710); // 1_37
+                //GBS::HD_INI_ST::write(0xf0);     // 1_39
+                // 1080p has highest pllad vco output clock, so don't do oversampling
+                GBS::PLLAD_KS::write(0);       // 5_16 post divider 0 : FCKO1 > 87MHz, 3 : FCKO1<23MHz
+                GBS::PLLAD_CKOS::write(0);     // 5_16 1x OS (with KS=CKOS=0)
+                GBS::ADC_FLTR::write(0);       // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
+                GBS::ADC_CLK_ICLK1X::write(0); // 5_00 4 (OS=1)
+                GBS::DEC2_BYPS::write(1);      // 5_1f 1 // dec2 disabled (OS=1)
+                GBS::PLLAD_ICP::write(6);      // was 5, fine at 6 as well, FS is 1
+                GBS::PLLAD_FS::write(1);
+                GBS::HD_HB_ST::write(0x00); // 1_3B
+                GBS::HD_HB_SP::write(0xb0); // 1_3D // d0
+                GBS::HD_HS_ST::write(0x20); // 1_3F
+                GBS::HD_HS_SP::write(0x70); // 1_41
+                GBS::HD_VB_ST::write(0x00); // 1_43
+                GBS::HD_VB_SP::write(0x2f); // 1_45
+                GBS::HD_VS_ST::write(0x04); // 1_47
+                GBS::HD_VS_SP::write(0x0A); // 1_49
+            }
+            if (rto->videoStandardInput == 13) { // odd HD mode (PS2 "VGA" over Component)
+                applyRGBPatches();               // treat mostly as RGB, clamp R/B to gnd
+                rto->syncTypeCsync = true;       // used in loop to set clamps and SP dynamic
+                GBS::DEC_MATRIX_BYPS::write(1);  // overwrite for this mode
+                GBS::SP_PRE_COAST::write(4);
+                GBS::SP_POST_COAST::write(4);
+                GBS::SP_DLT_REG::write(0x70);
+                GBS::HD_MATRIX_BYPS::write(1);     // bypass since we'll treat source as RGB
+                GBS::HD_DYN_BYPS::write(1);        // bypass since we'll treat source as RGB
+                GBS::SP_VS_PROC_INV_REG::write(0); // don't invert
+                // same as with RGBHV, the ps2 resolution can vary widely
+                GBS::PLLAD_KS::write(0);       // 5_16 post divider 0 : FCKO1 > 87MHz, 3 : FCKO1<23MHz
+                GBS::PLLAD_CKOS::write(0);     // 5_16 1x OS (with KS=CKOS=0)
+                GBS::ADC_CLK_ICLK1X::write(0); // 5_00 4 (OS=1)
+                GBS::ADC_CLK_ICLK2X::write(0); // 5_00 3 (OS=1)
+                GBS::DEC1_BYPS::write(1);      // 5_1f 1 // dec1 disabled (OS=1)
+                GBS::DEC2_BYPS::write(1);      // 5_1f 1 // dec2 disabled (OS=1)
+                GBS::PLLAD_MD::write(512);     // could try 856
+            }
+        }
+
+        if (rto->videoStandardInput == 13) {
+            // section is missing HD_HSYNC_RST and HD_INI_ST adjusts
+            uint16_t vtotal = GBS::STATUS_SYNC_PROC_VTOTAL::read();
+            if (vtotal < 532) { // 640x480 or less
+                GBS::PLLAD_KS::write(3);
+                GBS::PLLAD_FS::write(1);
+            } else if (vtotal >= 532 && vtotal < 810) { // 800x600, 1024x768
+                //GBS::PLLAD_KS::write(3); // just a little too much at 1024x768
+                GBS::PLLAD_FS::write(0);
+                GBS::PLLAD_KS::write(2);
+            } else { //if (vtotal > 1058 && vtotal < 1074) { // 1280x1024
+                GBS::PLLAD_KS::write(2);
+                GBS::PLLAD_FS::write(1);
+            }
+        }
 
-    if (rto->inputIsYpBpR) {
-        GBS::DEC_MATRIX_BYPS::write(1); // 5_1f 2 = 1 for YUV / 0 for RGB
-        GBS::HD_MATRIX_BYPS::write(0);  // 1_30 1 / input to jacks is yuv, adc leaves it as yuv > convert to rgb for output here
-        GBS::HD_DYN_BYPS::write(0);     // don't bypass color expansion
-                                        //GBS::HD_U_OFFSET::write(3);     // color adjust via scope
-                                        //GBS::HD_V_OFFSET::write(3);     // color adjust via scope
-    } else {
-        GBS::DEC_MATRIX_BYPS::write(1); // this is normally RGB input for HDBYPASS out > no color matrix at all
-        GBS::HD_MATRIX_BYPS::write(1);  // 1_30 1 / input is rgb, adc leaves it as rgb > bypass matrix
-        GBS::HD_DYN_BYPS::write(1);     // bypass as well
+        GBS::DEC_IDREG_EN::write(1); // 5_1f 7
+        GBS::DEC_WEN_MODE::write(1); // 5_1e 7 // 1 keeps ADC phase consistent. around 4 lock positions vs totally random
     }
-
-    GBS::HD_SEL_BLK_IN::write(0); // 0 enables HDB blank timing (1 would be DVI, not working atm)
-
-    GBS::SP_SDCS_VSST_REG_H::write(0); // S5_3B
-    GBS::SP_SDCS_VSSP_REG_H::write(0); // S5_3B
-    GBS::SP_SDCS_VSST_REG_L::write(0); // S5_3F // 3 for SP sync
-    GBS::SP_SDCS_VSSP_REG_L::write(2); // S5_40 // 10 for SP sync // check with interlaced sources
-
-    GBS::HD_HSYNC_RST::write(0x3ff); // max 0x7ff
-    GBS::HD_INI_ST::write(0);        // todo: test this at 0 / was 0x298
-    // timing into HDB is PLLAD_MD with PLLAD_KS divider: KS = 0 > full PLLAD_MD
-    if (rto->videoStandardInput <= 2) {
-        // PAL and NTSC are rewrites, the rest is still handled normally
-        // These 2 formats now have SP_HS2PLL_INV_REG set. That's the only way I know so far that
-        // produces recovered HSyncs that align to the falling edge of the input
-        // ToDo: find reliable input active flank detect to then set SP_HS2PLL_INV_REG correctly
-        // (for PAL/NTSC polarity is known to be active low, but other formats are variable)
-        GBS::SP_HS2PLL_INV_REG::write(1);  //5_56 1 lock to falling HS edge // check > sync issues with MD
-        GBS::SP_CS_P_SWAP::write(1);       //5_3e 0 new: this should negate the problem with inverting HS2PLL
-        GBS::SP_HS_PROC_INV_REG::write(1); // (5_56_5) invert HS to DEC
-        // invert mode detect HS/VS triggers, helps PSX NTSC detection. required with 5_3e 0 set
-        GBS::MD_HS_FLIP::write(1);
-        GBS::MD_VS_FLIP::write(1);
-        GBS::OUT_SYNC_SEL::write(2);   // new: 0_4f 1=sync from HDBypass, 2=sync from SP, 0 = sync from VDS
-        GBS::SP_HS_LOOP_SEL::write(0); // 5_57 6 new: use full SP sync, enable HS positioning and pulse length control
-        GBS::ADC_FLTR::write(3);       // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
-        //GBS::HD_INI_ST::write(0x76); // 1_39
-
-        GBS::HD_HSYNC_RST::write((GBS::PLLAD_MD::read() / 2) + 8); // ADC output pixel count determined
-        GBS::HD_HB_ST::write(GBS::PLLAD_MD::read() * 0.945f);      // 1_3B  // no idea why it's not coupled to HD_RST
-        GBS::HD_HB_SP::write(0x90);                                // 1_3D
-        GBS::HD_HS_ST::write(0x80);                                // 1_3F  // but better to use SP sync directly (OUT_SYNC_SEL = 2)
-        GBS::HD_HS_SP::write(0x00);                                // 1_41  //
-        // to use SP sync directly; prepare reasonable out HS length
-        GBS::SP_CS_HS_ST::write(0xA0);
-        GBS::SP_CS_HS_SP::write(0x00);
-
-        if (rto->videoStandardInput == 1) {
-            setCsVsStart(250);         // don't invert VS with direct SP sync mode
-            setCsVsStop(1);            // stop relates to HS pulses from CS decoder directly, so mind EQ pulses
-            GBS::HD_VB_ST::write(500); // 1_43
-            GBS::HD_VS_ST::write(3);   // 1_47 // but better to use SP sync directly (OUT_SYNC_SEL = 2)
-            GBS::HD_VS_SP::write(522); // 1_49 //
-            GBS::HD_VB_SP::write(16);  // 1_45
-        }
-        if (rto->videoStandardInput == 2) {
-            setCsVsStart(301);         // don't invert
-            setCsVsStop(5);            // stop past EQ pulses (6 on psx) normally, but HDMI adapter works with -=1 (5)
-            GBS::HD_VB_ST::write(605); // 1_43
-            GBS::HD_VS_ST::write(1);   // 1_47
-            GBS::HD_VS_SP::write(621); // 1_49
-            GBS::HD_VB_SP::write(16);  // 1_45
-        }
-    } else if (rto->videoStandardInput == 3 || rto->videoStandardInput == 4) { // 480p, 576p
-        GBS::ADC_FLTR::write(2);                                               // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
-        GBS::PLLAD_KS::write(1);                                               // 5_16 post divider
-        GBS::PLLAD_CKOS::write(0);                                             // 5_16 2x OS (with KS=1)
-        //GBS::HD_INI_ST::write(0x76); // 1_39
-        GBS::HD_HB_ST::write(0x864); // 1_3B
-            // you *must* begin hblank before hsync.
-        GBS::HD_HB_SP::write(0xa0);  // 1_3D
-        GBS::HD_VB_ST::write(0x00);  // 1_43
-        GBS::HD_VB_SP::write(0x40);  // 1_45
-        if (rto->videoStandardInput == 3) {
-            GBS::HD_HS_ST::write(0x54);  // 1_3F
-            GBS::HD_HS_SP::write(0x864); // 1_41
-            GBS::HD_VS_ST::write(0x06);  // 1_47 // VS neg
-            GBS::HD_VS_SP::write(0x00);  // 1_49
-            setCsVsStart(525 - 5);
-            setCsVsStop(525 - 3);
-        }
-        if (rto->videoStandardInput == 4) {
-            GBS::HD_HS_ST::write(0x10);  // 1_3F
-            GBS::HD_HS_SP::write(0x880); // 1_41
-            GBS::HD_VS_ST::write(0x06);  // 1_47 // VS neg
-            GBS::HD_VS_SP::write(0x00);  // 1_49
-            setCsVsStart(48);
-            setCsVsStop(46);
-        }
-    } else if (rto->videoStandardInput <= 7 || rto->videoStandardInput == 13) {
-        //GBS::SP_HS2PLL_INV_REG::write(0); // 5_56 1 use rising edge of tri-level sync // always 0 now
-        if (rto->videoStandardInput == 5) { // 720p
-            GBS::PLLAD_MD::write(2474);     // override from 2345
-            GBS::HD_HSYNC_RST::write(550);  // 1_37
-            //GBS::HD_INI_ST::write(78);     // 1_39
-            // 720p has high pllad vco output clock, so don't do oversampling
-            GBS::PLLAD_KS::write(0);       // 5_16 post divider 0 : FCKO1 > 87MHz, 3 : FCKO1<23MHz
-            GBS::PLLAD_CKOS::write(0);     // 5_16 1x OS (with KS=CKOS=0)
-            GBS::ADC_FLTR::write(0);       // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
-            GBS::ADC_CLK_ICLK1X::write(0); // 5_00 4 (OS=1)
-            GBS::DEC2_BYPS::write(1);      // 5_1f 1 // dec2 disabled (OS=1)
-            GBS::PLLAD_ICP::write(6);      // fine at 6 only, FS is 1
-            GBS::PLLAD_FS::write(1);
-            GBS::HD_HB_ST::write(0);     // 1_3B
-            GBS::HD_HB_SP::write(0x140); // 1_3D
-            GBS::HD_HS_ST::write(0x20);  // 1_3F
-            GBS::HD_HS_SP::write(0x80);  // 1_41
-            GBS::HD_VB_ST::write(0x00);  // 1_43
-            GBS::HD_VB_SP::write(0x6c);  // 1_45 // ps3 720p tested
-            GBS::HD_VS_ST::write(0x00);  // 1_47
-            GBS::HD_VS_SP::write(0x05);  // 1_49
-            setCsVsStart(2);
-            setCsVsStop(0);
-        }
-        if (rto->videoStandardInput == 6) { // 1080i
-            // interl. source
-            GBS::HD_HSYNC_RST::write(0x710); // 1_37
-            //GBS::HD_INI_ST::write(2);    // 1_39
-            GBS::PLLAD_KS::write(1);    // 5_16 post divider
-            GBS::PLLAD_CKOS::write(0);  // 5_16 2x OS (with KS=1)
-            GBS::ADC_FLTR::write(1);    // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
-            GBS::HD_HB_ST::write(0);    // 1_3B
-            GBS::HD_HB_SP::write(0xb8); // 1_3D
-            GBS::HD_HS_ST::write(0x04); // 1_3F
-            GBS::HD_HS_SP::write(0x50); // 1_41
-            GBS::HD_VB_ST::write(0x00); // 1_43
-            GBS::HD_VB_SP::write(0x1e); // 1_45
-            GBS::HD_VS_ST::write(0x04); // 1_47
-            GBS::HD_VS_SP::write(0x09); // 1_49
-            setCsVsStart(8);
-            setCsVsStop(6);
-        }
-        if (rto->videoStandardInput == 7) {  // 1080p
-            GBS::PLLAD_MD::write(2749);      // override from 2345
-            GBS::HD_HSYNC_RST::write(0x710); // 1_37
-            //GBS::HD_INI_ST::write(0xf0);     // 1_39
-            // 1080p has highest pllad vco output clock, so don't do oversampling
-            GBS::PLLAD_KS::write(0);       // 5_16 post divider 0 : FCKO1 > 87MHz, 3 : FCKO1<23MHz
-            GBS::PLLAD_CKOS::write(0);     // 5_16 1x OS (with KS=CKOS=0)
-            GBS::ADC_FLTR::write(0);       // 5_03 4/5 ADC filter 3=40, 2=70, 1=110, 0=150 Mhz
-            GBS::ADC_CLK_ICLK1X::write(0); // 5_00 4 (OS=1)
-            GBS::DEC2_BYPS::write(1);      // 5_1f 1 // dec2 disabled (OS=1)
-            GBS::PLLAD_ICP::write(6);      // was 5, fine at 6 as well, FS is 1
-            GBS::PLLAD_FS::write(1);
-            GBS::HD_HB_ST::write(0x00); // 1_3B
-            GBS::HD_HB_SP::write(0xb0); // 1_3D // d0
-            GBS::HD_HS_ST::write(0x20); // 1_3F
-            GBS::HD_HS_SP::write(0x70); // 1_41
-            GBS::HD_VB_ST::write(0x00); // 1_43
-            GBS::HD_VB_SP::write(0x2f); // 1_45
-            GBS::HD_VS_ST::write(0x04); // 1_47
-            GBS::HD_VS_SP::write(0x0A); // 1_49
-        }
-        if (rto->videoStandardInput == 13) { // odd HD mode (PS2 "VGA" over Component)
-            applyRGBPatches();               // treat mostly as RGB, clamp R/B to gnd
-            rto->syncTypeCsync = true;       // used in loop to set clamps and SP dynamic
-            GBS::DEC_MATRIX_BYPS::write(1);  // overwrite for this mode
-            GBS::SP_PRE_COAST::write(4);
-            GBS::SP_POST_COAST::write(4);
-            GBS::SP_DLT_REG::write(0x70);
-            GBS::HD_MATRIX_BYPS::write(1);     // bypass since we'll treat source as RGB
-            GBS::HD_DYN_BYPS::write(1);        // bypass since we'll treat source as RGB
-            GBS::SP_VS_PROC_INV_REG::write(0); // don't invert
-            // same as with RGBHV, the ps2 resolution can vary widely
-            GBS::PLLAD_KS::write(0);       // 5_16 post divider 0 : FCKO1 > 87MHz, 3 : FCKO1<23MHz
-            GBS::PLLAD_CKOS::write(0);     // 5_16 1x OS (with KS=CKOS=0)
-            GBS::ADC_CLK_ICLK1X::write(0); // 5_00 4 (OS=1)
-            GBS::ADC_CLK_ICLK2X::write(0); // 5_00 3 (OS=1)
-            GBS::DEC1_BYPS::write(1);      // 5_1f 1 // dec1 disabled (OS=1)
-            GBS::DEC2_BYPS::write(1);      // 5_1f 1 // dec2 disabled (OS=1)
-            GBS::PLLAD_MD::write(512);     // could try 856
-        }
-    }
-
-    if (rto->videoStandardInput == 13) {
-        // section is missing HD_HSYNC_RST and HD_INI_ST adjusts
-        uint16_t vtotal = GBS::STATUS_SYNC_PROC_VTOTAL::read();
-        if (vtotal < 532) { // 640x480 or less
-            GBS::PLLAD_KS::write(3);
-            GBS::PLLAD_FS::write(1);
-        } else if (vtotal >= 532 && vtotal < 810) { // 800x600, 1024x768
-            //GBS::PLLAD_KS::write(3); // just a little too much at 1024x768
-            GBS::PLLAD_FS::write(0);
-            GBS::PLLAD_KS::write(2);
-        } else { //if (vtotal > 1058 && vtotal < 1074) { // 1280x1024
-            GBS::PLLAD_KS::write(2);
-            GBS::PLLAD_FS::write(1);
-        }
-    }
-
-    GBS::DEC_IDREG_EN::write(1); // 5_1f 7
-    GBS::DEC_WEN_MODE::write(1); // 5_1e 7 // 1 keeps ADC phase consistent. around 4 lock positions vs totally random
     rto->phaseSP = 8;
     rto->phaseADC = 24;                         // fix value // works best with yuv input in tests
     setAndUpdateSogLevel(rto->currentLevelSOG); // also re-latch everything
@@ -5613,6 +5906,7 @@ void bypassModeSwitch_RGBHV()
 
 void runAutoGain()
 {
+    TW_PROFILE_TAG("runAutoGain");
     static unsigned long lastTimeAutoGain = millis();
     uint8_t limit_found = 0, greenValue = 0;
     uint8_t loopCeiling = 0;
@@ -5886,6 +6180,7 @@ boolean snapToIntegralFrameRate(void)
 
 void printInfo()
 {
+    TW_PROFILE_TAG("printInfo");
     static char print[121]; // Increase if compiler complains about sprintf
     static uint8_t clearIrqCounter = 0;
     static uint8_t lockCounterPrevious = 0;
@@ -5896,32 +6191,36 @@ void printInfo()
         wifi = WiFi.RSSI();
     }
 
-    uint16_t hperiod = GBS::HPERIOD_IF::read();
-    uint16_t vperiod = GBS::VPERIOD_IF::read();
-    uint8_t stat0FIrq = GBS::STATUS_0F::read();
-    char HSp = GBS::STATUS_SYNC_PROC_HSPOL::read() ? '+' : '-'; // 0 = neg, 1 = pos
-    char VSp = GBS::STATUS_SYNC_PROC_VSPOL::read() ? '+' : '-'; // 0 = neg, 1 = pos
-    char h = 'H', v = 'V';
-    if (!GBS::STATUS_SYNC_PROC_HSACT::read()) {
-        h = HSp = ' ';
-    }
-    if (!GBS::STATUS_SYNC_PROC_VSACT::read()) {
-        v = VSp = ' ';
+    uint8_t stat0FIrq;
+    {
+        GBS::StatusSnapshot snapshot; // the status fields on this line come from one burst
+        uint16_t hperiod = snapshot.get<GBS::HPERIOD_IF>();
+        uint16_t vperiod = snapshot.get<GBS::VPERIOD_IF>();
+        stat0FIrq = snapshot.get<GBS::STATUS_0F>();
+        char HSp = snapshot.get<GBS::STATUS_SYNC_PROC_HSPOL>() ? '+' : '-'; // 0 = neg, 1 = pos
+        char VSp = snapshot.get<GBS::STATUS_SYNC_PROC_VSPOL>() ? '+' : '-'; // 0 = neg, 1 = pos
+        char h = 'H', v = 'V';
+        if (!snapshot.get<GBS::STATUS_SYNC_PROC_HSACT>()) {
+            h = HSp = ' ';
+        }
+        if (!snapshot.get<GBS::STATUS_SYNC_PROC_VSACT>()) {
+            v = VSp = ' ';
+        }
+
+        //int charsToPrint =
+        sprintf(print, "h:%4u v:%4u PLL:%01u A:%02x%02x%02x S:%02x.%02x.%02x %c%c%c%c I:%02x D:%04x m:%hu ht:%4d vt:%4d hpw:%4d u:%3x s:%2x S:%2d W:%2d\n",
+                hperiod, vperiod, lockCounterPrevious,
+                GBS::ADC_RGCTRL::read(), GBS::ADC_GGCTRL::read(), GBS::ADC_BGCTRL::read(),
+                snapshot.get<GBS::STATUS_00>(), snapshot.get<GBS::STATUS_05>(), GBS::SP_CS_0x3E::read(),
+                h, HSp, v, VSp, stat0FIrq, GBS::TEST_BUS::read(), getVideoMode(),
+                snapshot.get<GBS::STATUS_SYNC_PROC_HTOTAL>(), snapshot.get<GBS::STATUS_SYNC_PROC_VTOTAL>() /*+ 1*/, // emucrt: without +1 is correct line count
+                snapshot.get<GBS::STATUS_SYNC_PROC_HLOW_LEN>(), rto->noSyncCounter, rto->continousStableCounter,
+                rto->currentLevelSOG, wifi);
+
+        //SerialM.print("charsToPrint: "); SerialM.println(charsToPrint);
+        SerialM.print(print);
     }
 
-    //int charsToPrint =
-    sprintf(print, "h:%4u v:%4u PLL:%01u A:%02x%02x%02x S:%02x.%02x.%02x %c%c%c%c I:%02x D:%04x m:%hu ht:%4d vt:%4d hpw:%4d u:%3x s:%2x S:%2d W:%2d\n",
-            hperiod, vperiod, lockCounterPrevious,
-            GBS::ADC_RGCTRL::read(), GBS::ADC_GGCTRL::read(), GBS::ADC_BGCTRL::read(),
-            GBS::STATUS_00::read(), GBS::STATUS_05::read(), GBS::SP_CS_0x3E::read(),
-            h, HSp, v, VSp, stat0FIrq, GBS::TEST_BUS::read(), getVideoMode(),
-            GBS::STATUS_SYNC_PROC_HTOTAL::read(), GBS::STATUS_SYNC_PROC_VTOTAL::read() /*+ 1*/, // emucrt: without +1 is correct line count
-            GBS::STATUS_SYNC_PROC_HLOW_LEN::read(), rto->noSyncCounter, rto->continousStableCounter,
-            rto->currentLevelSOG, wifi);
-
-    //SerialM.print("charsToPrint: "); SerialM.println(charsToPrint);
-    SerialM.print(print);
-
     if (stat0FIrq != 0x00) {
         // clear 0_0F interrupt bits regardless of syncwatcher status
         clearIrqCounter++;
@@ -5966,8 +6265,114 @@ void startWire()
     pinMode(SDA, OUTPUT_OPEN_DRAIN);
     // no issues even at 700k, requires ESP8266 160Mhz CPU clock, else (80Mhz) uses 400k in library
     // no problem with Si5351 at 700k either
-    //Wire.setClock(400000);
-    Wire.setClock(700000);
+    // the rate is tuned per board by calibrateWireClock()
+    Wire.setClock(wireClock);
+}
+
+// The Si5351 shares the bus: its device status has to read back with
+// SYS_INIT clear
+static boolean clockGenAnswers()
+{
+    Wire.beginTransmission(SIADDR);
+    Wire.write(0); // Device Status
+    if (Wire.endTransmission() != 0 || Wire.requestFrom((uint8_t)SIADDR, (size_t)1) != 1) {
+        return false;
+    }
+    return (Wire.read() & 0x80) == 0;
+}
+
+// Step SCL up from 400k and verify write / readback on the ADC_UNUSED_69
+// scratch register at each rate, and that the clock gen still answers if
+// there is one. Keeps one step below the highest rate that passed every
+// iteration without a NACK, as margin, and never goes above wireClockMax:
+// the OLED and the Si5351 on the same bus aren't checked beyond that.
+// Requires board power.
+void calibrateWireClock()
+{
+    static const uint8_t patterns[] = {0x55, 0xaa, 0x00, 0xff};
+    const uint32_t minClock = 400000;
+    const uint32_t maxClock = wireClockMax + 100000;
+    const uint32_t step = 100000;
+    const uint8_t iterations = 64;
+    uint32_t best = 0;
+
+    for (uint32_t clock = minClock; clock <= maxClock; clock += step) {
+        Wire.setClock(clock);
+        GBS::shadowEnable(true); // re-select the segment at the new rate
+        uint16_t errors = tw::busErrors();
+        boolean clean = true;
+        for (uint8_t i = 0; i < iterations && clean; i++) {
+            // alternating bits / all zeros / all ones, with a walking bit flipped
+            uint8_t pattern = patterns[i & 3] ^ (1 << ((i >> 2) & 7));
+            GBS::ADC_UNUSED_69::write(pattern);
+            clean = GBS::ADC_UNUSED_69::read() == pattern;
+        }
+        if (clean && rto->extClockGenDetected) {
+            clean = clockGenAnswers();
+        }
+        if (!clean || tw::busErrors() != errors) {
+            break;
+        }
+        best = clock;
+        yield();
+    }
+
+    if (best > minClock) {
+        best -= step; // margin
+    } else {
+        best = minClock; // nothing passed or only the slowest, use the library default
+    }
+    if (best > wireClockMax) {
+        best = wireClockMax;
+    }
+    wireClock = best;
+    Wire.setClock(wireClock);
+    GBS::shadowEnable(true);
+    GBS::ADC_UNUSED_69::write(0);
+    wireErrorsSeen = tw::busErrors();
+
+    SerialM.print(F("i2c clock: "));
+    SerialM.println(wireClock);
+    saveWireClock();
+}
+
+void saveWireClock()
+{
+    File f = SPIFFS.open("/i2cclock.txt", "w");
+    if (!f) {
+        SerialM.println(F("saving i2c clock failed!"));
+        return;
+    }
+    f.println(wireClock);
+    f.close();
+}
+
+// NACKs while the board still answers mean the rate is marginal on this
+// board (or it warmed up), step down and remember that.
+void checkWireErrors()
+{
+    static unsigned long lastCheck = 0;
+    if (!rto->boardHasPower) {
+        wireErrorsSeen = tw::busErrors(); // power loss NACKs don't count
+        return;
+    }
+    if (millis() - lastCheck < 1000) {
+        return;
+    }
+    lastCheck = millis();
+    if (tw::busErrors() == wireErrorsSeen) {
+        return;
+    }
+    // power loss is handled elsewhere, only act when the scratch register works
+    if (checkBoardPower() && wireClock > 400000) {
+        wireClock -= 100000;
+        Wire.setClock(wireClock);
+        GBS::shadowEnable(true); // writes at the old rate may have been lost
+        SerialM.print(F("i2c errors, clock now: "));
+        SerialM.println(wireClock);
+        saveWireClock();
+    }
+    wireErrorsSeen = tw::busErrors();
 }
 
 void fastSogAdjust()
@@ -6009,6 +6414,7 @@ void fastSogAdjust()
 
 void runSyncWatcher()
 {
+    TW_PROFILE_TAG("runSyncWatcher");
     if (!rto->boardHasPower) {
         return;
     }
@@ -6018,14 +6424,27 @@ void runSyncWatcher()
     static unsigned long lastSyncDrop = millis();
     static unsigned long lastLineCountMeasure = millis();
 
+    // The decisions of this tick are made on one status burst. Only the
+    // loops that wait and resample on purpose read the chip again.
     uint16_t thisStableLineCount = 0;
-    uint8_t detectedVideoMode = getVideoMode();
-    boolean status16SpHsStable = getStatus16SpHsStable();
+    uint8_t detectedVideoMode;
+    boolean status16SpHsStable;
+    boolean sogBad, sogSwitched, hsActive;
+    uint16_t lineCount;
+    {
+        GBS::StatusSnapshot snapshot;
+        detectedVideoMode = getVideoMode();
+        status16SpHsStable = getStatus16SpHsStable();
+        sogBad = snapshot.get<GBS::STATUS_INT_SOG_BAD>();
+        sogSwitched = snapshot.get<GBS::STATUS_INT_SOG_SW>();
+        hsActive = snapshot.get<GBS::STATUS_SYNC_PROC_HSACT>();
+        lineCount = snapshot.get<GBS::STATUS_SYNC_PROC_VTOTAL>();
+    }
 
     if (rto->outModeHdBypass && status16SpHsStable) {
         if (videoStandardInputIsPalNtscSd()) {
             if (millis() - lastLineCountMeasure > 765) {
-                thisStableLineCount = GBS::STATUS_SYNC_PROC_VTOTAL::read();
+                thisStableLineCount = lineCount;
                 for (uint8_t i = 0; i < 3; i++) {
                     delay(2);
                     if (GBS::STATUS_SYNC_PROC_VTOTAL::read() < (thisStableLineCount - 3) ||
@@ -6063,7 +6482,7 @@ void runSyncWatcher()
 
     if (rto->videoStandardInput == 13) { // using flaky graphic modes
         if (detectedVideoMode == 0) {
-            if (GBS::STATUS_INT_SOG_BAD::read() == 0) {
+            if (!sogBad) {
                 detectedVideoMode = 13; // then keep it
             }
         }
@@ -6076,7 +6495,7 @@ void runSyncWatcher()
 
     if (rto->syncTypeCsync && !rto->inputIsYpBpR && (newVideoModeCounter == 0)) {
         // look for SOG instability
-        if (GBS::STATUS_INT_SOG_BAD::read() == 1 || GBS::STATUS_INT_SOG_SW::read() == 1) {
+        if (sogBad || sogSwitched) {
             resetInterruptSogSwitchBit();
             if ((millis() - preemptiveSogWindowStart) > sogWindowLen) {
                 // start new window
@@ -6149,7 +6568,7 @@ void runSyncWatcher()
 
         rto->phaseIsSet = 0;
 
-        if (rto->noSyncCounter <= 3 || GBS::STATUS_SYNC_PROC_HSACT::read() == 0) {
+        if (rto->noSyncCounter <= 3 || !hsActive) {
             freezeVideo();
         }
 
@@ -6203,7 +6622,7 @@ void runSyncWatcher()
         }
 
         if (rto->noSyncCounter % 32 == 0) {
-            if (GBS::STATUS_SYNC_PROC_HSACT::read() == 1) {
+            if (hsActive) {
                 unfreezeVideo();
             } else {
                 freezeVideo();
@@ -6410,7 +6829,7 @@ void runSyncWatcher()
                 }
             }
         }
-    } else if (getStatus16SpHsStable() && detectedVideoMode != 0 && rto->videoStandardInput != 15 && (rto->videoStandardInput == detectedVideoMode)) {
+    } else if (status16SpHsStable && detectedVideoMode != 0 && rto->videoStandardInput != 15 && (rto->videoStandardInput == detectedVideoMode)) {
         // last used mode reappeared / stable again
         if (rto->continousStableCounter < 255) {
             rto->continousStableCounter++;
@@ -6607,7 +7026,7 @@ void runSyncWatcher()
             boolean needPostAdjust = 0;
             static uint16_t activePresetLineCount = 0;
             // is the source in range for scaling RGBHV and is it currently in mode 15?
-            uint16 sourceLines = GBS::STATUS_SYNC_PROC_VTOTAL::read(); // if sourceLines = 0, might be in some reset state
+            uint16 sourceLines = lineCount; // if sourceLines = 0, might be in some reset state
             if ((sourceLines <= 535 && sourceLines != 0) && rto->videoStandardInput == 15) {
                 uint16_t firstDetectedSourceLines = sourceLines;
                 boolean moveOn = 1;
@@ -7108,6 +7527,7 @@ boolean checkBoardPower()
     }
 
     GBS::ADC_UNUSED_69::write(0); // attempt to clear
+    GBS::shadowEnable(false);     // register contents are unknown now
     if (rto->boardHasPower == true) {
         Serial.println(F("! power / i2c lost !"));
     }
@@ -7136,20 +7556,23 @@ boolean checkBoardPower()
 
 void calibrateAdcOffset()
 {
-    GBS::PAD_BOUT_EN::write(0);          // disable output to pin for test
-    GBS::PLL648_CONTROL_01::write(0xA5); // display clock to adc = 162mhz
-    GBS::ADC_INPUT_SEL::write(2);        // 10 > R2/G2/B2 as input (not connected, so to isolate ADC)
-    GBS::DEC_MATRIX_BYPS::write(1);
-    GBS::DEC_TEST_ENABLE::write(1);
-    GBS::ADC_5_03::write(0x31);    // bottom clamps, filter max (40mhz)
-    GBS::ADC_TEST_04::write(0x00); // disable bit 1
-    GBS::SP_CS_CLP_ST::write(0x00);
-    GBS::SP_CS_CLP_SP::write(0x00);
-    GBS::SP_5_56::write(0x05); // SP_SOG_MODE needs to be 1
-    GBS::SP_5_57::write(0x80);
-    GBS::ADC_5_00::write(0x02);
-    GBS::TEST_BUS_SEL::write(0x0b); // 0x2b
-    GBS::TEST_BUS_EN::write(1);
+    {
+        GBS::Transaction t; // one burst per segment
+        GBS::PAD_BOUT_EN::write(0);          // disable output to pin for test
+        GBS::PLL648_CONTROL_01::write(0xA5); // display clock to adc = 162mhz
+        GBS::ADC_INPUT_SEL::write(2);        // 10 > R2/G2/B2 as input (not connected, so to isolate ADC)
+        GBS::DEC_MATRIX_BYPS::write(1);
+        GBS::DEC_TEST_ENABLE::write(1);
+        GBS::ADC_5_03::write(0x31);    // bottom clamps, filter max (40mhz)
+        GBS::ADC_TEST_04::write(0x00); // disable bit 1
+        GBS::SP_CS_CLP_ST::write(0x00);
+        GBS::SP_CS_CLP_SP::write(0x00);
+        GBS::SP_5_56::write(0x05); // SP_SOG_MODE needs to be 1
+        GBS::SP_5_57::write(0x80);
+        GBS::ADC_5_00::write(0x02);
+        GBS::TEST_BUS_SEL::write(0x0b); // 0x2b
+        GBS::TEST_BUS_EN::write(1);
+    }
     resetDigital();
 
     uint16_t hitTargetCounter = 0;
@@ -7157,13 +7580,16 @@ void calibrateAdcOffset()
     uint8_t missTargetCounter = 0;
     uint8_t readout = 0;
 
-    GBS::ADC_RGCTRL::write(0x7F);
-    GBS::ADC_GGCTRL::write(0x7F);
-    GBS::ADC_BGCTRL::write(0x7F);
-    GBS::ADC_ROFCTRL::write(0x7F);
-    GBS::ADC_GOFCTRL::write(0x3D); // start
-    GBS::ADC_BOFCTRL::write(0x7F);
-    GBS::DEC_TEST_SEL::write(1); // 5_1f = 0x1c
+    {
+        GBS::Transaction t;
+        GBS::ADC_RGCTRL::write(0x7F);
+        GBS::ADC_GGCTRL::write(0x7F);
+        GBS::ADC_BGCTRL::write(0x7F);
+        GBS::ADC_ROFCTRL::write(0x7F);
+        GBS::ADC_GOFCTRL::write(0x3D); // start
+        GBS::ADC_BOFCTRL::write(0x7F);
+        GBS::DEC_TEST_SEL::write(1); // 5_1f = 0x1c
+    }
 
     //unsigned long overallTimer = millis();
     unsigned long startTimer = 0;
@@ -7242,27 +7668,10 @@ void calibrateAdcOffset()
     //Serial.println(millis() - overallTimer);
 }
 
+// defaults are in USER_OPTIONS (options.h)
 void loadDefaultUserOptions()
 {
-    uopt->presetPreference = Output960P;    // #1
-    uopt->enableFrameTimeLock = 0; // permanently adjust frame timing to avoid glitch vertical bar. does not work on all displays!
-    uopt->presetSlot = 'A';          //
-    uopt->frameTimeLockMethod = 0; // compatibility with more displays
-    uopt->enableAutoGain = 0;
-    uopt->wantScanlines = 0;
-    uopt->wantOutputComponent = 0;
-    uopt->deintMode = 0;
-    uopt->wantVdsLineFilter = 0;
-    uopt->wantPeaking = 1;
-    uopt->preferScalingRgbhv = 1;
-    uopt->wantTap6 = 1;
-    uopt->PalForce60 = 0;
-    uopt->matchPresetSource = 1;             // #14
-    uopt->wantStepResponse = 1;              // #15
-    uopt->wantFullHeight = 1;                // #16
-    uopt->enableCalibrationADC = 1;          // #17
-    uopt->scanlineStrength = 0x30;           // #18
-    uopt->disableExternalClockGenerator = 0; // #19
+    prefsDefaults(uopt);
 }
 
 //RF_PRE_INIT() {
@@ -7384,6 +7793,7 @@ void setup()
         WiFi.setOutputPower(16.0f);         // float: min 0.0f, max 20.5f
         startWebserver();
         rto->webServerStarted = true;
+        GBS::setIdleHook(busIdle); // long register programs keep the web ui alive
     } else {
         //WiFi.disconnect(); // deletes credentials
         WiFi.mode(WIFI_OFF);
@@ -7421,6 +7831,7 @@ void setup()
     rto->osr = 0;
     rto->useHdmiSyncFix = 0;
     rto->notRecognizedCounter = 0;
+    rto->integerScale = 0;
 
     // more run time variables
     rto->inputIsYpBpR = false;
@@ -7451,6 +7862,7 @@ void setup()
     userCommand = '@';
 
     pinMode(DEBUG_IN_PIN, INPUT);
+    VsyncCapture::begin(); // debug pin edges, captured once a reader routes a signal
     pinMode(12, OUTPUT);
     LEDON; // enable the LED, lets users know the board is starting up
 
@@ -7477,87 +7889,20 @@ void setup()
         SerialM.println(F("SPIFFS mount failed! ((1M SPIFFS) selected?)"));
     } else {
         // load user preferences file
-        File f = SPIFFS.open("/preferencesv2.txt", "r");
-        if (!f) {
+        if (!loadUserPrefs()) {
             SerialM.println(F("no preferences file yet, create new"));
             loadDefaultUserOptions();
-            saveUserPrefs(); // if this fails, there must be a spiffs problem
-        } else {
-            //on a fresh / spiffs not formatted yet MCU:  userprefs.txt open ok //result = 207
-            uopt->presetPreference = (PresetPreference)(f.read() - '0'); // #1
-            if (uopt->presetPreference > 10)
-                uopt->presetPreference = Output960P; // fresh spiffs ?
-
-            uopt->enableFrameTimeLock = (uint8_t)(f.read() - '0');
-            if (uopt->enableFrameTimeLock > 1)
-                uopt->enableFrameTimeLock = 0;
-
-            uopt->presetSlot = lowByte(f.read());
-
-            uopt->frameTimeLockMethod = (uint8_t)(f.read() - '0');
-            if (uopt->frameTimeLockMethod > 1)
-                uopt->frameTimeLockMethod = 0;
-
-            uopt->enableAutoGain = (uint8_t)(f.read() - '0');
-            if (uopt->enableAutoGain > 1)
-                uopt->enableAutoGain = 0;
-
-            uopt->wantScanlines = (uint8_t)(f.read() - '0');
-            if (uopt->wantScanlines > 1)
-                uopt->wantScanlines = 0;
-
-            uopt->wantOutputComponent = (uint8_t)(f.read() - '0');
-            if (uopt->wantOutputComponent > 1)
-                uopt->wantOutputComponent = 0;
-
-            uopt->deintMode = (uint8_t)(f.read() - '0');
-            if (uopt->deintMode > 2)
-                uopt->deintMode = 0;
-
-            uopt->wantVdsLineFilter = (uint8_t)(f.read() - '0');
-            if (uopt->wantVdsLineFilter > 1)
-                uopt->wantVdsLineFilter = 0;
-
-            uopt->wantPeaking = (uint8_t)(f.read() - '0');
-            if (uopt->wantPeaking > 1)
-                uopt->wantPeaking = 1;
-
-            uopt->preferScalingRgbhv = (uint8_t)(f.read() - '0');
-            if (uopt->preferScalingRgbhv > 1)
-                uopt->preferScalingRgbhv = 1;
-
-            uopt->wantTap6 = (uint8_t)(f.read() - '0');
-            if (uopt->wantTap6 > 1)
-                uopt->wantTap6 = 1;
-
-            uopt->PalForce60 = (uint8_t)(f.read() - '0');
-            if (uopt->PalForce60 > 1)
-                uopt->PalForce60 = 0;
-
-            uopt->matchPresetSource = (uint8_t)(f.read() - '0'); // #14
-            if (uopt->matchPresetSource > 1)
-                uopt->matchPresetSource = 1;
-
-            uopt->wantStepResponse = (uint8_t)(f.read() - '0'); // #15
-            if (uopt->wantStepResponse > 1)
-                uopt->wantStepResponse = 1;
-
-            uopt->wantFullHeight = (uint8_t)(f.read() - '0'); // #16
-            if (uopt->wantFullHeight > 1)
-                uopt->wantFullHeight = 1;
-
-            uopt->enableCalibrationADC = (uint8_t)(f.read() - '0'); // #17
-            if (uopt->enableCalibrationADC > 1)
-                uopt->enableCalibrationADC = 1;
-
-            uopt->scanlineStrength = (uint8_t)(f.read() - '0'); // #18
-            if (uopt->scanlineStrength > 0x60)
-                uopt->enableCalibrationADC = 0x30;
-
-            uopt->disableExternalClockGenerator = (uint8_t)(f.read() - '0'); // #19
-            if (uopt->disableExternalClockGenerator > 1)
-                uopt->disableExternalClockGenerator = 0;
+            saveUserPrefs();
+            flushUserPrefs(); // if this fails, there must be a spiffs problem
+        }
 
+        // I2C clock found by calibrateWireClock() on an earlier boot
+        f = SPIFFS.open("/i2cclock.txt", "r");
+        if (f) {
+            uint32_t clock = f.readStringUntil('\n').toInt();
+            if (clock >= 400000 && clock <= wireClockMax) {
+                wireClock = clock;
+            }
             f.close();
         }
     }
@@ -7640,6 +7985,12 @@ void setup()
             Serial.println(F("no ext clockgen"));
         }
 
+        if (!SPIFFS.exists("/i2cclock.txt")) {
+            calibrateWireClock(); // first boot on this board
+        }
+        startWire(); // applies wireClock
+        wireErrorsSeen = tw::busErrors(); // NACKs from the power / recovery checks above don't count
+
         zeroAll();
         setResetParameters();
         prepareSyncProcessor();
@@ -7898,6 +8249,16 @@ void handleWiFi(boolean instant)
     yield();
 }
 
+// runs between I2C bursts of long register programs, must stay short
+void busIdle()
+{
+    static unsigned long lastTime = 0;
+    if (millis() - lastTime > 10) {
+        lastTime = millis();
+        handleWiFi(0);
+    }
+}
+
 void myLog(char const* type, char command) {
     SerialM.printf("%s command %c at settings source %d, custom slot %d, status %x\n",
         type, command, uopt->presetPreference, uopt->presetSlot, rto->presetID);
@@ -7939,6 +8300,9 @@ void loop()
 #endif
 
     handleWiFi(0); // WiFi + OTA + WS + MDNS, checks for server enabled + started
+    GBS::pump(4);  // deferred register programs, a few bursts at a time
+    checkWireErrors();
+    checkUserPrefs();
 
     // is there a command from Terminal or web ui?
     // Serial takes precedence
@@ -8782,6 +9146,13 @@ void loop()
             case ':':
                 externalClockGenSyncInOutRate();
                 break;
+#ifdef TW_PROFILE
+            case '%':
+                // bus traffic since the last dump
+                tw::Profile::dump(SerialM, 16);
+                tw::Profile::reset();
+                break;
+#endif
             case ';':
                 externalClockGenResetClock();
                 if (rto->extClockGenDetected) {
@@ -8844,7 +9215,7 @@ void loop()
             fsDebugPrintf("running frame sync, clock gen enabled = %d\n", rto->extClockGenDetected);
             bool success = rto->extClockGenDetected
                 ? FrameSync::runFrequency()
-                : FrameSync::runVsync(uopt->frameTimeLockMethod);
+                : FrameSync::runVsync(rto->integerScale ? FRAMESYNC_METHOD_HTOTAL : uopt->frameTimeLockMethod);
             if (!success) {
                 if (rto->syncLockFailIgnore-- == 0) {
                     FrameSync::reset(uopt->frameTimeLockMethod); // in case run() failed because we lost sync signal
@@ -8856,11 +9227,18 @@ void loop()
 
             if (debug_backup != 0x0) {
                 GBS::TEST_BUS_SEL::write(debug_backup);
+                FrameSync::debugBusChanged();
             }
         }
         lastVsyncLock = millis();
     }
 
+    // dithered FrameTimeLock picks the next frame's vtotal in between
+    if (uopt->enableFrameTimeLock && uopt->frameTimeLockMethod == FRAMESYNC_METHOD_DITHER && !rto->extClockGenDetected &&
+        !rto->integerScale && rto->sourceDisconnected == false) {
+        FrameSync::runDither();
+    }
+
     if (rto->syncWatcherEnabled && rto->boardHasPower) {
         if ((millis() - lastTimeInterruptClear) > 3000) {
             GBS::INTERRUPT_CONTROL_00::write(0xfe); // reset except for SOGBAD
@@ -9053,6 +9431,8 @@ void loop()
                     writeOneByte(0x00, 0); // update cached segment
                     GBS::STATUS_00::read();
                 }
+                wireErrorsSeen = tw::busErrors();
+                GBS::shadowEnable(true); // refills from the bus as registers get used
                 rto->syncWatcherEnabled = true;
                 rto->boardHasPower = true;
                 delay(100);
@@ -9099,6 +9479,7 @@ void handleType2Command(char argument)
             webSocket.close();
             loadDefaultUserOptions();
             saveUserPrefs();
+            flushUserPrefs();
             Serial.println(F("options set to defaults, restarting"));
             delay(60);
             ESP.reset(); // don't use restart(), messes up websocket reconnects
@@ -9159,6 +9540,7 @@ void handleType2Command(char argument)
             break;
         case 'a':
             webSocket.close();
+            flushUserPrefs();
             Serial.println(F("restart"));
             delay(60);
             ESP.reset(); // don't use restart(), messes up websocket reconnects
@@ -9173,52 +9555,19 @@ void handleType2Command(char argument)
                 delay(1); // wifi stack
             }
             ////
-            File f = SPIFFS.open("/preferencesv2.txt", "r");
-            if (!f) {
-                SerialM.println(F("failed opening preferences file"));
-            } else {
-                SerialM.print(F("preset preference = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("frame time lock = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("preset slot = "));
-                SerialM.println((uint8_t)(f.read()));
-                SerialM.print(F("frame lock method = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("auto gain = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("scanlines = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("component output = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("deinterlacer mode = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("line filter = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("peaking = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("preferScalingRgbhv = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("6-tap = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("pal force60 = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("matched = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("step response = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-                SerialM.print(F("disable external clock generator = "));
-                SerialM.println((uint8_t)(f.read() - '0'));
-
-                f.close();
-            }
+#define PRINT_USER_OPTION(type, name, id, value, max) \
+    SerialM.print(F(#name " = "));                   \
+    SerialM.println((uint32_t)uopt->name);
+            USER_OPTIONS(PRINT_USER_OPTION)
+#undef PRINT_USER_OPTION
         } break;
         case 'f':
         case 'g':
         case 'h':
         case 'p':
         case 's':
-        case 'L': {
+        case 'L':
+        case 'j': {
             // load preset via webui
             uint8_t videoMode = getVideoMode();
             if (videoMode == 0 && GBS::STATUS_SYNC_PROC_HSACT::read())
@@ -9237,6 +9586,8 @@ void handleType2Command(char argument)
                 uopt->presetPreference = Output1080P; // 1920x1080
             if (argument == 'L')
                 uopt->presetPreference = OutputDownscale; // downscale
+            if (argument == 'j')
+                uopt->presetPreference = OutputModeline; // native display mode
 
             rto->useHdmiSyncFix = 1; // disables sync out when programming preset
             if (rto->videoStandardInput == 14) {
@@ -9256,6 +9607,8 @@ void handleType2Command(char argument)
             if (uopt->frameTimeLockMethod == 0) {
                 uopt->frameTimeLockMethod = 1;
             } else if (uopt->frameTimeLockMethod == 1) {
+                uopt->frameTimeLockMethod = FRAMESYNC_METHOD_DITHER;
+            } else {
                 uopt->frameTimeLockMethod = 0;
             }
             saveUserPrefs();
@@ -9428,6 +9781,7 @@ void handleType2Command(char argument)
             break;
         case 'u':
             // restart to attempt wifi station mode connect
+            flushUserPrefs();
             delay(30);
             WiFi.mode(WIFI_STA);
             WiFi.hostname(device_hostname_partial); // _full
@@ -9448,6 +9802,19 @@ void handleType2Command(char argument)
             uopt->enableCalibrationADC = !uopt->enableCalibrationADC;
             saveUserPrefs();
             break;
+        case 'k':
+            uopt->wantIntegerScale = !uopt->wantIntegerScale;
+            SerialM.print(F("integer scale: "));
+            if (uopt->wantIntegerScale) {
+                SerialM.println("on");
+            } else {
+                SerialM.println("off");
+            }
+            saveUserPrefs();
+            if (rto->videoStandardInput == 1 || rto->videoStandardInput == 2) {
+                applyPresets(rto->videoStandardInput);
+            }
+            break;
         case 'x':
             uopt->preferScalingRgbhv = !uopt->preferScalingRgbhv;
             SerialM.print(F("preferScalingRgbhv: "));
@@ -9657,19 +10024,233 @@ void handleType2Command(char argument)
 
 WiFiEventHandler disconnectedEventHandler;
 
-void startWebserver()
+// files in a backup bundle
+static const char *const backupFiles[] = {SLOTS_DB_FILE, PREFS_FILE};
+static const uint8_t backupFilesCount = sizeof(backupFiles) / sizeof(backupFiles[0]);
+static_assert(sizeof(backupFiles) / sizeof(backupFiles[0]) <= BACKUP_FILES_MAX, "BACKUP_FILES_MAX too small");
+
+// one /bin/backup.bin response
+struct BackupStream
 {
-    persWM.setApCredentials(ap_ssid, ap_password);
-    persWM.onConnect([]() {
-        SerialM.print(F("(WiFi): STA mode connected; IP: "));
-        SerialM.println(WiFi.localIP().toString());
-        if (MDNS.begin(device_hostname_partial, WiFi.localIP())) { // MDNS request for gbscontrol.local
-            //Serial.println("MDNS started");
-            MDNS.addService("http", "tcp", 80); // Add service to MDNS-SD
-            MDNS.announce();
+    BackupHeader header;
+    BackupEntry entries[BACKUP_FILES_MAX];
+    uint32_t crc;
+    uint32_t crcSize; // stream bytes the crc covers so far
+    boolean damaged;  // a file changed while streaming, the crc won't match
+};
+
+// Sets up the bundle for the files as they are now, returns its size
+uint32_t backupBegin(BackupStream &s)
+{
+    flushUserPrefs();
+    File db = slotDbOpen(); // creates the slot database if there is none yet
+    db.close();
+    s.header.magic = BACKUP_MAGIC;
+    s.header.version = BACKUP_VERSION;
+    s.header.files = 0;
+    s.header.reserved = 0;
+    s.crc = 0;
+    s.crcSize = 0;
+    s.damaged = false;
+    uint32_t size = sizeof(BackupHeader) + sizeof(s.crc);
+    for (uint8_t i = 0; i < backupFilesCount; i++) {
+        File f = SPIFFS.open(backupFiles[i], "r");
+        if (!f) {
+            continue;
         }
-        SerialM.println(FPSTR(st_info_string));
-    });
+        BackupEntry &entry = s.entries[s.header.files++];
+        memset(entry.name, 0, sizeof(entry.name));
+        strncpy(entry.name, backupFiles[i], sizeof(entry.name) - 1);
+        entry.size = f.size();
+        f.close();
+        size += sizeof(BackupEntry) + entry.size;
+    }
+    return size;
+}
+
+// Fills buffer with the bundle from index on, files are read as they go.
+// Returns the bytes filled.
+size_t backupFill(BackupStream &s, uint8_t *buffer, size_t maxLen, size_t index)
+{
+    size_t len = backupCopyPart((const uint8_t *)&s.header, 0, sizeof(s.header), index, buffer, maxLen);
+    uint32_t start = sizeof(s.header);
+    for (uint8_t i = 0; i < s.header.files; i++) {
+        len += backupCopyPart((const uint8_t *)&s.entries[i], start, sizeof(BackupEntry), index + len, buffer + len, maxLen - len);
+        start += sizeof(BackupEntry);
+        uint32_t pos = index + len;
+        if (len < maxLen && pos >= start && pos < start + s.entries[i].size) {
+            size_t n = start + s.entries[i].size - pos;
+            n = n < maxLen - len ? n : maxLen - len;
+            File f = SPIFFS.open(s.entries[i].name, "r");
+            if (!f || !f.seek(pos - start) || f.read(buffer + len, n) != n) {
+                memset(buffer + len, 0, n);
+                s.damaged = true;
+            }
+            f.close();
+            len += n;
+        }
+        start += s.entries[i].size;
+    }
+
+    // start is where the crc goes now
+    if (index == s.crcSize && index < start) {
+        size_t covered = start - index < len ? start - index : len;
+        s.crc = presetCrc32(buffer, covered, s.crc);
+        s.crcSize += covered;
+    }
+    uint32_t crc = s.crcSize == start && !s.damaged ? s.crc : ~s.crc;
+    len += backupCopyPart((const uint8_t *)&crc, start, sizeof(crc), index + len, buffer + len, maxLen - len);
+    return len;
+}
+
+enum BackupImportPhase : uint8_t {
+    BackupImportHeader,
+    BackupImportEntry,
+    BackupImportData,
+    BackupImportCrc,
+    BackupImportDone,
+    BackupImportFailed,
+};
+
+// the one /bin/restore upload in progress
+struct BackupImport
+{
+    BackupImportPhase phase;
+    BackupHeader header;
+    BackupEntry entries[BACKUP_FILES_MAX];
+    uint8_t entry;                     // current entry
+    uint32_t left;                     // bytes of its file still to come
+    uint8_t block[sizeof(BackupEntry)]; // header, entry or crc being collected
+    uint8_t blockSize;
+    uint32_t crc;
+    File file;
+    boolean applied; // result of backupImportEnd()
+};
+
+static BackupImport backupImport;
+
+static String backupTmpName(uint8_t entry)
+{
+    return BACKUP_TMP_PREFIX + String(entry);
+}
+
+void backupImportBegin(BackupImport &s)
+{
+    s.phase = BackupImportHeader;
+    s.header.files = 0;
+    s.entry = 0;
+    s.left = 0;
+    s.blockSize = 0;
+    s.crc = 0;
+    s.applied = false;
+}
+
+// an entry of the bundle was read, check it and open its temporary file
+static boolean backupImportOpen(BackupImport &s)
+{
+    BackupEntry &entry = s.entries[s.entry];
+    entry.name[sizeof(entry.name) - 1] = 0;
+    boolean known = false;
+    for (uint8_t i = 0; i < backupFilesCount; i++) {
+        known = known || strcmp(entry.name, backupFiles[i]) == 0;
+    }
+    FSInfo info;
+    SPIFFS.info(info);
+    if (!known || entry.size > info.totalBytes - info.usedBytes) {
+        SerialM.print(F("restore: can't take "));
+        SerialM.println(entry.name);
+        return false;
+    }
+    s.file = SPIFFS.open(backupTmpName(s.entry), "w");
+    s.left = entry.size;
+    return (boolean)s.file;
+}
+
+// Takes the next piece of a bundle
+void backupImportData(BackupImport &s, const uint8_t *data, size_t len)
+{
+    while (len > 0 && s.phase != BackupImportDone && s.phase != BackupImportFailed) {
+        size_t n;
+        if (s.phase == BackupImportData) {
+            n = len < s.left ? len : s.left;
+            if (s.file.write(data, n) != n) {
+                s.phase = BackupImportFailed;
+            }
+            s.left -= n;
+        } else {
+            // fixed size parts are collected in block first
+            size_t size = s.phase == BackupImportHeader ? sizeof(BackupHeader) : s.phase == BackupImportEntry ? sizeof(BackupEntry) : sizeof(s.crc);
+            n = size - s.blockSize < len ? size - s.blockSize : len;
+            memcpy(s.block + s.blockSize, data, n);
+            s.blockSize += n;
+        }
+        if (s.phase != BackupImportCrc) {
+            s.crc = presetCrc32(data, n, s.crc);
+        }
+        data += n;
+        len -= n;
+
+        if (s.phase == BackupImportHeader && s.blockSize == sizeof(BackupHeader)) {
+            memcpy(&s.header, s.block, sizeof(BackupHeader));
+            boolean ok = s.header.magic == BACKUP_MAGIC && s.header.version == BACKUP_VERSION && s.header.files <= BACKUP_FILES_MAX;
+            s.phase = !ok ? BackupImportFailed : s.header.files > 0 ? BackupImportEntry : BackupImportCrc;
+            s.blockSize = 0;
+        } else if (s.phase == BackupImportEntry && s.blockSize == sizeof(BackupEntry)) {
+            memcpy(&s.entries[s.entry], s.block, sizeof(BackupEntry));
+            s.phase = backupImportOpen(s) ? BackupImportData : BackupImportFailed;
+            s.blockSize = 0;
+        } else if (s.phase == BackupImportCrc && s.blockSize == sizeof(s.crc)) {
+            uint32_t crc;
+            memcpy(&crc, s.block, sizeof(crc));
+            s.phase = crc == s.crc ? BackupImportDone : BackupImportFailed;
+        }
+        if (s.phase == BackupImportData && s.left == 0) {
+            s.file.close();
+            s.phase = ++s.entry < s.header.files ? BackupImportEntry : BackupImportCrc;
+        }
+    }
+}
+
+// Replaces the files with the restored ones if the bundle was complete and
+// intact, removes the temporary files otherwise. Returns true if applied.
+boolean backupImportEnd(BackupImport &s)
+{
+    s.file.close();
+    boolean ok = s.phase == BackupImportDone;
+    for (uint8_t i = 0; i < s.header.files && i < BACKUP_FILES_MAX; i++) {
+        if (ok) {
+            SPIFFS.remove(s.entries[i].name);
+            SPIFFS.rename(backupTmpName(i), s.entries[i].name);
+        } else {
+            SPIFFS.remove(backupTmpName(i));
+        }
+    }
+    if (ok) {
+        presetCacheInvalidate();
+        userPrefsDirty = false; // don't overwrite the restored preferences
+        loadUserPrefs();
+        SerialM.println(F("backup restored"));
+    } else {
+        SerialM.println(F("backup damaged, nothing restored"));
+    }
+    s.phase = BackupImportFailed; // until the next upload
+    s.applied = ok;
+    return ok;
+}
+
+void startWebserver()
+{
+    persWM.setApCredentials(ap_ssid, ap_password);
+    persWM.onConnect([]() {
+        SerialM.print(F("(WiFi): STA mode connected; IP: "));
+        SerialM.println(WiFi.localIP().toString());
+        if (MDNS.begin(device_hostname_partial, WiFi.localIP())) { // MDNS request for gbscontrol.local
+            //Serial.println("MDNS started");
+            MDNS.addService("http", "tcp", 80); // Add service to MDNS-SD
+            MDNS.announce();
+        }
+        SerialM.println(FPSTR(st_info_string));
+    });
     persWM.onAp([]() {
         SerialM.println(FPSTR(ap_info_string));
         // add mdns announce here as well?
@@ -9722,6 +10303,32 @@ void startWebserver()
         }
     });
 
+    // /modeline?id=<CEA VIC or 0x80 + DMT id> or ?w=&h=&hz= for CVT reduced
+    // blanking, optionally &sync=<MODELINE_HSYNC_POS | MODELINE_VSYNC_POS>
+    server.on("/modeline", HTTP_GET, [](AsyncWebServerRequest *request) {
+        Modeline mode;
+        uint8_t id = request->hasParam("id") ? request->getParam("id")->value().toInt() : MODELINE_ID_CVT_RB;
+        if (id == MODELINE_ID_CVT_RB) {
+            uint16_t width = request->hasParam("w") ? request->getParam("w")->value().toInt() : 0;
+            uint16_t height = request->hasParam("h") ? request->getParam("h")->value().toInt() : 0;
+            uint8_t refresh = request->hasParam("hz") ? request->getParam("hz")->value().toInt() : 60;
+            if (!modelineCvtRb(width, height, refresh, &mode)) {
+                request->send(200, "application/json", "false");
+                return;
+            }
+            uopt->modelineWidth = width;
+            uopt->modelineHeight = height;
+            uopt->modelineRefresh = refresh;
+        } else if (!modelineFromTable(id, &mode)) {
+            request->send(200, "application/json", "false");
+            return;
+        }
+        uopt->modelineId = id;
+        uopt->modelineSync = request->hasParam("sync") ? request->getParam("sync")->value().toInt() : 0xff;
+        userCommand = 'j'; // applied and saved like the other output resolutions
+        request->send(200, "application/json", "true");
+    });
+
     server.on("/wifi/connect", HTTP_POST, [](AsyncWebServerRequest *request) {
         AsyncWebServerResponse *response =
             request->beginResponse(200, "application/json", "true");
@@ -9743,30 +10350,24 @@ void startWebserver()
 
     server.on("/bin/slots.bin", HTTP_GET, [](AsyncWebServerRequest *request) {
         if (ESP.getFreeHeap() > 10000) {
-            SlotMetaArray slotsObject;
-            File slotsBinaryFileRead = SPIFFS.open(SLOTS_FILE, "r");
-
-            if (!slotsBinaryFileRead) {
-                File slotsBinaryFileWrite = SPIFFS.open(SLOTS_FILE, "w");
-                for (int i = 0; i < SLOTS_TOTAL; i++) {
-                    slotsObject.slot[i].slot = i;
-                    slotsObject.slot[i].presetID = 0;
-                    slotsObject.slot[i].scanlines = 0;
-                    slotsObject.slot[i].scanlinesStrength = 0;
-                    slotsObject.slot[i].wantVdsLineFilter = false;
-                    slotsObject.slot[i].wantStepResponse = true;
-                    slotsObject.slot[i].wantPeaking = true;
-                    char emptySlotName[25] = "Empty                   ";
-                    strncpy(slotsObject.slot[i].name, emptySlotName, 25);
-                }
-                slotsBinaryFileWrite.write((byte *)&slotsObject, sizeof(slotsObject));
-                slotsBinaryFileWrite.close();
-            } else {
-                slotsBinaryFileRead.close();
+            // the SlotMetaArray layout the web ui reads
+            File db = slotDbOpen();
+            if (db) {
+                AsyncResponseStream *response = request->beginResponseStream("application/octet-stream");
+                SlotMeta meta;
+                for (uint8_t i = 0; i < SLOTS_TOTAL; i++) {
+                    db.seek(slotDbEntryOffset(i));
+                    if (db.read((uint8_t *)&meta, sizeof(meta)) != sizeof(meta)) {
+                        slotMetaDefault(&meta, i);
+                    }
+                    response->write((const uint8_t *)&meta, sizeof(meta));
+                }
+                db.close();
+                request->send(response);
+                return;
             }
-
-            request->send(SPIFFS, "/slots.bin", "application/octet-stream");
         }
+        request->send(200, "application/json", "false");
     });
 
     server.on("/slot/set", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -9797,31 +10398,6 @@ void startWebserver()
             int params = request->params();
 
             if (params > 0) {
-                SlotMetaArray slotsObject;
-                File slotsBinaryFileRead = SPIFFS.open(SLOTS_FILE, "r");
-
-                if (slotsBinaryFileRead) {
-                    slotsBinaryFileRead.read((byte *)&slotsObject, sizeof(slotsObject));
-                    slotsBinaryFileRead.close();
-                } else {
-                    File slotsBinaryFileWrite = SPIFFS.open(SLOTS_FILE, "w");
-
-                    for (int i = 0; i < SLOTS_TOTAL; i++) {
-                        slotsObject.slot[i].slot = i;
-                        slotsObject.slot[i].presetID = 0;
-                        slotsObject.slot[i].scanlines = 0;
-                        slotsObject.slot[i].scanlinesStrength = 0;
-                        slotsObject.slot[i].wantVdsLineFilter = false;
-                        slotsObject.slot[i].wantStepResponse = true;
-                        slotsObject.slot[i].wantPeaking = true;
-                        char emptySlotName[25] = "Empty                   ";
-                        strncpy(slotsObject.slot[i].name, emptySlotName, 25);
-                    }
-
-                    slotsBinaryFileWrite.write((byte *)&slotsObject, sizeof(slotsObject));
-                    slotsBinaryFileWrite.close();
-                }
-
                 // index param
                 AsyncWebParameter *slotIndexParam = request->getParam(0);
                 String slotIndexString = slotIndexParam->value();
@@ -9834,21 +10410,22 @@ void startWebserver()
                 AsyncWebParameter *slotNameParam = request->getParam(1);
                 String slotName = slotNameParam->value();
 
+                SlotMeta meta;
                 char emptySlotName[25] = "                        ";
-                strncpy(slotsObject.slot[slotIndex].name, emptySlotName, 25);
-
-                slotsObject.slot[slotIndex].slot = slotIndex;
-                slotName.toCharArray(slotsObject.slot[slotIndex].name, sizeof(slotsObject.slot[slotIndex].name));
-                slotsObject.slot[slotIndex].presetID = rto->presetID;
-                slotsObject.slot[slotIndex].scanlines = uopt->wantScanlines;
-                slotsObject.slot[slotIndex].scanlinesStrength = uopt->scanlineStrength;
-                slotsObject.slot[slotIndex].wantVdsLineFilter = uopt->wantVdsLineFilter;
-                slotsObject.slot[slotIndex].wantStepResponse = uopt->wantStepResponse;
-                slotsObject.slot[slotIndex].wantPeaking = uopt->wantPeaking;
-
-                File slotsBinaryOutputFile = SPIFFS.open(SLOTS_FILE, "w");
-                slotsBinaryOutputFile.write((byte *)&slotsObject, sizeof(slotsObject));
-                slotsBinaryOutputFile.close();
+                strncpy(meta.name, emptySlotName, 25);
+
+                meta.slot = slotIndex;
+                slotName.toCharArray(meta.name, sizeof(meta.name));
+                meta.presetID = rto->presetID;
+                meta.scanlines = uopt->wantScanlines;
+                meta.scanlinesStrength = uopt->scanlineStrength;
+                meta.wantVdsLineFilter = uopt->wantVdsLineFilter;
+                meta.wantStepResponse = uopt->wantStepResponse;
+                meta.wantPeaking = uopt->wantPeaking;
+
+                if (!slotDbWriteMeta(slotIndex, &meta)) {
+                    goto fail;
+                }
 
                 result = true;
             }
@@ -9873,63 +10450,35 @@ void startWebserver()
             else
             {
                 Ascii8 slot = uopt->presetSlot;
-                Ascii8 nextSlot;
-                auto currentSlot = slotIndexMap.indexOf(slot);
-
-                SlotMetaArray slotsObject;
-                File slotsBinaryFileRead = SPIFFS.open(SLOTS_FILE, "r");
-                slotsBinaryFileRead.read((byte *)&slotsObject, sizeof(slotsObject));
-                slotsBinaryFileRead.close();
-                String slotName = slotsObject.slot[currentSlot].name;
-
-                // remove preset files
-                SPIFFS.remove("/preset_ntsc." + String((char)slot));
-                SPIFFS.remove("/preset_pal." + String((char)slot));
-                SPIFFS.remove("/preset_ntsc_480p." + String((char)slot));
-                SPIFFS.remove("/preset_pal_576p." + String((char)slot));
-                SPIFFS.remove("/preset_ntsc_720p." + String((char)slot));
-                SPIFFS.remove("/preset_ntsc_1080p." + String((char)slot));
-                SPIFFS.remove("/preset_medium_res." + String((char)slot));
-                SPIFFS.remove("/preset_vga_upscale." + String((char)slot));
-                SPIFFS.remove("/preset_unknown." + String((char)slot));
-
-                uint8_t loopCount = 0;
-                uint8_t flag = 1;
-                while (flag != 0)
-                {
-                    slot = slotIndexMap[currentSlot + loopCount];
-                    nextSlot = slotIndexMap[currentSlot + loopCount + 1];
-                    flag = 0;
-                    flag += SPIFFS.rename("/preset_ntsc." + String((char)(nextSlot)), "/preset_ntsc." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_pal." + String((char)(nextSlot)), "/preset_pal." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_ntsc_480p." + String((char)(nextSlot)), "/preset_ntsc_480p." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_pal_576p." + String((char)(nextSlot)), "/preset_pal_576p." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_ntsc_720p." + String((char)(nextSlot)), "/preset_ntsc_720p." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_ntsc_1080p." + String((char)(nextSlot)), "/preset_ntsc_1080p." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_medium_res." + String((char)(nextSlot)), "/preset_medium_res." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_vga_upscale." + String((char)(nextSlot)), "/preset_vga_upscale." + String((char)slot));
-                    flag += SPIFFS.rename("/preset_unknown." + String((char)(nextSlot)), "/preset_unknown." + String((char)slot));
-
-                    slotsObject.slot[currentSlot + loopCount].slot = slotsObject.slot[currentSlot + loopCount + 1].slot;
-                    slotsObject.slot[currentSlot + loopCount].presetID = slotsObject.slot[currentSlot + loopCount + 1].presetID;
-                    slotsObject.slot[currentSlot + loopCount].scanlines = slotsObject.slot[currentSlot + loopCount + 1].scanlines;
-                    slotsObject.slot[currentSlot + loopCount].scanlinesStrength = slotsObject.slot[currentSlot + loopCount + 1].scanlinesStrength;
-                    slotsObject.slot[currentSlot + loopCount].wantVdsLineFilter = slotsObject.slot[currentSlot + loopCount + 1].wantVdsLineFilter;
-                    slotsObject.slot[currentSlot + loopCount].wantStepResponse = slotsObject.slot[currentSlot + loopCount + 1].wantStepResponse;
-                    slotsObject.slot[currentSlot + loopCount].wantPeaking = slotsObject.slot[currentSlot + loopCount + 1].wantPeaking;
-                    // slotsObject.slot[currentSlot + loopCount].name = slotsObject.slot[currentSlot + loopCount + 1].name;
-                    strncpy(slotsObject.slot[currentSlot + loopCount].name, slotsObject.slot[currentSlot + loopCount + 1].name, 25);
-                    loopCount++;
-                }
-
-                File slotsBinaryFileWrite = SPIFFS.open(SLOTS_FILE, "w");
-                slotsBinaryFileWrite.write((byte *)&slotsObject, sizeof(slotsObject));
-                slotsBinaryFileWrite.close();
+                SlotMeta meta;
+                if (!slotDbReadMeta(slotIndex(slot), &meta)) {
+                    goto fail;
+                }
+                String slotName = meta.name;
+
+                // only clears the index entry, the preset records become free space
+                presetCacheInvalidate();
+                if (!slotDbRemove(slotIndex(slot))) {
+                    goto fail;
+                }
                 SerialM.println("Preset \"" + slotName + "\" removed");
                 result = true;
             }
         }
 
+        fail:
+        request->send(200, "application/json", result ? "true" : "false");
+    });
+
+    server.on("/slot/swap", HTTP_GET, [](AsyncWebServerRequest *request) {
+        bool result = false;
+
+        if (request->hasParam("a") && request->hasParam("b")) {
+            presetCacheInvalidate();
+            result = slotDbSwap(lowByte(request->getParam("a")->value().toInt()),
+                                lowByte(request->getParam("b")->value().toInt()));
+        }
+
         request->send(200, "application/json", result ? "true" : "false");
     });
 
@@ -9949,6 +10498,14 @@ void startWebserver()
             }
             if (final) {
                 request->_tempFile.close();
+                if ("/" + filename == PREFS_FILE) {
+                    userPrefsDirty = false; // restored, don't overwrite it with the old options
+                } else if ("/" + filename == PREFS_FILE_V2) {
+                    userPrefsDirty = false;
+                    SPIFFS.remove(PREFS_FILE); // from an old backup, loadUserPrefs() takes it over on boot
+                }
+                slotDbImportFile("/" + filename); // from an old backup
+                presetCacheInvalidate();          // might have been a preset or a backup
             }
         });
 
@@ -9967,6 +10524,7 @@ void startWebserver()
 
     server.on("/spiffs/dir", HTTP_GET, [](AsyncWebServerRequest *request) {
         if (ESP.getFreeHeap() > 10000) {
+            flushUserPrefs(); // a backup is about to be made
             Dir dir = SPIFFS.openDir("/");
             String output = "[";
 
@@ -9987,7 +10545,40 @@ void startWebserver()
         request->send(200, "application/json", "false");
     });
 
+    // all slots, presets and preferences in one go, see backupfile.h
+    server.on("/bin/backup.bin", HTTP_GET, [](AsyncWebServerRequest *request) {
+        if (ESP.getFreeHeap() > 10000) {
+            BackupStream stream;
+            uint32_t size = backupBegin(stream);
+            AsyncWebServerResponse *response = request->beginResponse(
+                "application/octet-stream", size,
+                [stream](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+                    return backupFill(stream, buffer, maxLen, index);
+                });
+            response->addHeader("Content-Disposition", "attachment; filename=\"gbs-control.backup.bin\"");
+            request->send(response);
+            return;
+        }
+        request->send(200, "application/json", "false");
+    });
+
+    server.on(
+        "/bin/restore", HTTP_POST,
+        [](AsyncWebServerRequest *request) {
+            request->send(200, "application/json", backupImport.applied ? "true" : "false");
+        },
+        [](AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
+            if (!index) {
+                backupImportBegin(backupImport);
+            }
+            backupImportData(backupImport, data, len);
+            if (final) {
+                backupImportEnd(backupImport);
+            }
+        });
+
     server.on("/spiffs/format", HTTP_GET, [](AsyncWebServerRequest *request) {
+        presetCacheInvalidate();
         request->send(200, "application/json", SPIFFS.format() ? "true" : "false");
     });
 
@@ -9996,19 +10587,22 @@ void startWebserver()
         request->send(200, "application/json", wifiMode == WIFI_AP ? "{\"mode\":\"ap\"}" : "{\"mode\":\"sta\",\"ssid\":\"" + WiFi.SSID() + "\"}");
     });
 
+#ifdef TW_PROFILE
+    server.on("/bus/profile", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream *response = request->beginResponseStream("text/plain");
+        tw::Profile::dump(*response, 16);
+        if (request->hasParam("reset")) {
+            tw::Profile::reset();
+        }
+        request->send(response);
+    });
+#endif
+
     server.on("/gbs/restore-filters", HTTP_GET, [](AsyncWebServerRequest *request) {
-        SlotMetaArray slotsObject;
-        File slotsBinaryFileRead = SPIFFS.open(SLOTS_FILE, "r");
+        SlotMeta meta;
         bool result = false;
-        if (slotsBinaryFileRead) {
-            slotsBinaryFileRead.read((byte *)&slotsObject, sizeof(slotsObject));
-            slotsBinaryFileRead.close();
-            auto currentSlot = slotIndexMap.indexOf(uopt->presetSlot);
-            if (currentSlot == -1) {
-                goto fail;
-            }
-
-            uopt->wantScanlines = slotsObject.slot[currentSlot].scanlines;
+        if (slotDbReadMeta(slotIndex(uopt->presetSlot), &meta)) {
+            uopt->wantScanlines = meta.scanlines;
 
             SerialM.print(F("slot: "));
             SerialM.println(uopt->presetSlot);
@@ -10021,14 +10615,13 @@ void startWebserver()
             }
             saveUserPrefs();
 
-            uopt->scanlineStrength = slotsObject.slot[currentSlot].scanlinesStrength;
-            uopt->wantVdsLineFilter = slotsObject.slot[currentSlot].wantVdsLineFilter;
-            uopt->wantStepResponse = slotsObject.slot[currentSlot].wantStepResponse;
-            uopt->wantPeaking = slotsObject.slot[currentSlot].wantPeaking;
+            uopt->scanlineStrength = meta.scanlinesStrength;
+            uopt->wantVdsLineFilter = meta.wantVdsLineFilter;
+            uopt->wantStepResponse = meta.wantStepResponse;
+            uopt->wantPeaking = meta.wantPeaking;
             result = true;
         }
 
-        fail:
         request->send(200, "application/json", result ? "true" : "false");
     });
 
@@ -10093,6 +10686,7 @@ void initUpdateOTA()
             type = "filesystem";
 
         // NOTE: if updating SPIFFS this would be the place to unmount SPIFFS using SPIFFS.end()
+        flushUserPrefs();
         SPIFFS.end();
         SerialM.println("Start updating " + type);
     });
@@ -10127,226 +10721,656 @@ void StrClear(char *str, uint16_t length)
     }
 }
 
-const uint8_t *loadPresetFromSPIFFS(byte forVideoMode)
+// source video modes with custom presets, by SlotDbEntry.cell / size index
+static const uint8_t slotDbVideoModes[SLOTS_DB_MODES] = {0, 1, 2, 3, 4, 5, 6, 8, 14};
+
+// index into SlotDbEntry.cell / size, SLOTS_DB_MODES if there are no custom presets for the mode
+uint8_t slotDbMode(uint8_t videoMode)
 {
-    static uint8_t preset[432];
-    String s = "";
-    Ascii8 slot = 0;
-    File f;
+    uint8_t mode = 0;
+    while (mode < SLOTS_DB_MODES && slotDbVideoModes[mode] != videoMode) {
+        mode++;
+    }
+    return mode;
+}
 
-    f = SPIFFS.open("/preferencesv2.txt", "r");
-    if (f) {
-        SerialM.println(F("preferencesv2.txt opened"));
-        uint8_t result[3];
-        result[0] = f.read(); // todo: move file cursor manually
-        result[1] = f.read();
-        result[2] = f.read();
+// old style preset file for a source video mode in a slot, empty if there is none for that mode
+String presetFileName(uint8_t videoMode, Ascii8 slot)
+{
+    String name;
+    if (videoMode == 1) {
+        name = "/preset_ntsc.";
+    } else if (videoMode == 2) {
+        name = "/preset_pal.";
+    } else if (videoMode == 3) {
+        name = "/preset_ntsc_480p.";
+    } else if (videoMode == 4) {
+        name = "/preset_pal_576p.";
+    } else if (videoMode == 5) {
+        name = "/preset_ntsc_720p.";
+    } else if (videoMode == 6) {
+        name = "/preset_ntsc_1080p.";
+    } else if (videoMode == 8) {
+        name = "/preset_medium_res.";
+    } else if (videoMode == 14) {
+        name = "/preset_vga_upscale.";
+    } else if (videoMode == 0) {
+        name = "/preset_unknown.";
+    } else {
+        return name;
+    }
+    return name + String((char)slot);
+}
 
-        f.close();
-        slot = result[2];
+// Built-in presets custom presets are stored against (PresetFileHeader.base).
+// Only ever append, the index is stored in the preset records.
+static const uint8_t *const presetBases[] = {
+    ntsc_240p, pal_240p, ntsc_720x480, pal_768x576, ntsc_1280x720, ntsc_1280x1024,
+    ntsc_1920x1080, ntsc_downscale, pal_1280x720, pal_1280x1024, pal_1920x1080, pal_downscale};
+static const uint8_t presetBasesCount = sizeof(presetBases) / sizeof(presetBases[0]);
+
+// Reads a preset record (PresetFileHeader and payload) at the current
+// position into payload (PRESET_PAYLOAD_SIZE bytes). outdated is set when
+// the record should be rewritten in the current format.
+// Returns false if the record is damaged.
+boolean readPresetRecord(File &f, uint8_t *payload, boolean *outdated)
+{
+    PresetFileHeader header;
+    if (f.read((uint8_t *)&header, sizeof(header)) != sizeof(header) || header.magic != PRESET_FILE_MAGIC) {
+        SerialM.println(F("preset damaged (header)"));
+        return false;
+    }
+    boolean ok = false;
+    if (header.version > PRESET_FILE_VERSION) {
+        SerialM.println(F("unknown preset file version"));
+        return false;
+    } else if (header.version == 1 || header.base == PRESET_BASE_NONE) {
+        ok = header.payloadSize == PRESET_PAYLOAD_SIZE &&
+             f.read(payload, PRESET_PAYLOAD_SIZE) == PRESET_PAYLOAD_SIZE;
+    } else if (header.base < presetBasesCount && header.payloadSize <= PRESET_PAYLOAD_SIZE) {
+        static uint8_t delta[PRESET_PAYLOAD_SIZE];
+        ok = f.read(delta, header.payloadSize) == header.payloadSize &&
+             presetDeltaApply(delta, header.payloadSize, presetBases[header.base], payload);
+    }
+    // also catches a delta whose base changed in a firmware update
+    if (!ok || presetCrc32(payload, PRESET_PAYLOAD_SIZE) != header.crc) {
+        SerialM.println(F("preset damaged (crc)"));
+        return false;
+    }
+    *outdated = header.version != PRESET_FILE_VERSION;
+    return true;
+}
+
+// Reads a preset payload from an old style preset file, binary or text
+// ("123,\n" per byte). Returns false if the file is damaged.
+boolean readPresetFile(File &f, uint8_t *payload)
+{
+    boolean outdated;
+    uint32_t magic = 0;
+    if (f.read((uint8_t *)&magic, sizeof(magic)) == sizeof(magic) && magic == PRESET_FILE_MAGIC) {
+        f.seek(0);
+        return readPresetRecord(f, payload, &outdated);
+    }
+
+    // text preset, parse the numbers as they stream in
+    f.seek(0);
+    uint16_t i = 0;
+    uint16_t value = 0;
+    while (i < PRESET_PAYLOAD_SIZE) {
+        int c = f.read();
+        if (c < 0 || c == '}') {
+            break;
+        }
+        if (c >= '0' && c <= '9') {
+            value = value * 10 + (c - '0');
+        } else if (c == ',') {
+            payload[i++] = (uint8_t)value;
+            value = 0;
+        }
+    }
+    if (i != PRESET_PAYLOAD_SIZE) {
+        SerialM.println(F("preset file damaged (short)"));
+        return false;
+    }
+    return true;
+}
+
+// Encodes the payload as a preset record into record (whole cells, at least
+// sizeof(PresetFileHeader) + PRESET_PAYLOAD_SIZE bytes): a delta against the
+// closest built-in preset, or in full if that doesn't save anything.
+// Returns the record size.
+uint16_t encodePresetRecord(const uint8_t *payload, uint8_t videoMode, uint8_t *record)
+{
+    PresetFileHeader header;
+    header.magic = PRESET_FILE_MAGIC;
+    header.version = PRESET_FILE_VERSION;
+    header.videoMode = videoMode;
+    header.presetID = payload[PRESET_ID_INDEX] & 0x7f;
+    header.base = PRESET_BASE_NONE;
+    header.payloadSize = PRESET_PAYLOAD_SIZE;
+    header.reserved = 0;
+    header.crc = presetCrc32(payload, PRESET_PAYLOAD_SIZE);
+
+    uint16_t fewest = PRESET_PAYLOAD_SIZE;
+    uint8_t closest = 0;
+    for (uint8_t i = 0; i < presetBasesCount; i++) {
+        uint16_t count = presetDeltaCount(payload, presetBases[i]);
+        if (count < fewest) {
+            fewest = count;
+            closest = i;
+        }
+        yield();
+    }
+    // the delta has to beat the full payload
+    uint8_t *body = record + sizeof(header);
+    uint16_t deltaSize = presetDeltaEncode(payload, presetBases[closest], body, PRESET_PAYLOAD_SIZE - 1);
+    if (deltaSize > 0) {
+        header.base = closest;
+        header.payloadSize = deltaSize;
     } else {
-        // file not found, we don't know what preset to load
-        SerialM.println(F("please select a preset slot first!")); // say "slot" here to make people save usersettings
-        if (forVideoMode == 2 || forVideoMode == 4)
-            return pal_240p;
-        else
-            return ntsc_240p;
+        memcpy(body, payload, PRESET_PAYLOAD_SIZE);
+    }
+    memcpy(record, &header, sizeof(header));
+    return sizeof(header) + header.payloadSize;
+}
+
+static uint16_t slotDbCells(uint16_t size)
+{
+    return (size + SLOTS_DB_CELL - 1) / SLOTS_DB_CELL;
+}
+
+void slotMetaDefault(SlotMeta *meta, uint8_t index)
+{
+    strncpy(meta->name, EMPTY_SLOT_NAME, sizeof(meta->name));
+    meta->presetID = 0;
+    meta->scanlines = 0;
+    meta->scanlinesStrength = 0;
+    meta->slot = index;
+    meta->wantVdsLineFilter = false;
+    meta->wantStepResponse = true;
+    meta->wantPeaking = true;
+}
+
+static boolean slotDbReadEntry(File &db, uint8_t index, SlotDbEntry *entry)
+{
+    return db.seek(slotDbEntryOffset(index)) &&
+           db.read((uint8_t *)entry, sizeof(SlotDbEntry)) == sizeof(SlotDbEntry);
+}
+
+static boolean slotDbWriteEntry(File &db, uint8_t index, const SlotDbEntry *entry)
+{
+    return db.seek(slotDbEntryOffset(index)) &&
+           db.write((const uint8_t *)entry, sizeof(SlotDbEntry)) == sizeof(SlotDbEntry);
+}
+
+// First free run of cells for a record of size bytes. Cells of the record
+// being replaced count as used, it stays valid until its entry is updated.
+// The run may end past the end of the file, the file grows then.
+static uint16_t slotDbAllocate(File &db, uint16_t size)
+{
+    uint16_t cells = slotDbCells(size);
+    uint16_t end = db.size() / SLOTS_DB_CELL;
+    uint8_t *used = (uint8_t *)calloc((end + 7) / 8, 1);
+    if (!used) {
+        return end; // append
     }
+    SlotDbEntry entry;
+    for (uint8_t i = 0; i < SLOTS_TOTAL; i++) {
+        if (!slotDbReadEntry(db, i, &entry)) {
+            break;
+        }
+        for (uint8_t mode = 0; mode < SLOTS_DB_MODES; mode++) {
+            uint16_t cell = entry.cell[mode];
+            uint16_t stop = cell + slotDbCells(entry.size[mode]);
+            for (; cell != 0 && cell < stop && cell < end; cell++) {
+                used[cell >> 3] |= 1 << (cell & 7);
+            }
+        }
+    }
+    uint16_t start = SLOTS_DB_FIRST_CELL;
+    for (uint16_t cell = SLOTS_DB_FIRST_CELL; cell < end && cell - start < cells; cell++) {
+        if (used[cell >> 3] & (1 << (cell & 7))) {
+            start = cell + 1;
+        }
+    }
+    free(used);
+    return start;
+}
+
+// Stores a preset payload as the record for a slot and video mode
+static boolean slotDbWritePreset(File &db, uint8_t index, uint8_t videoMode, const uint8_t *payload)
+{
+    static uint8_t record[sizeof(PresetFileHeader) + PRESET_PAYLOAD_SIZE]; // 7 cells
+    uint8_t mode = slotDbMode(videoMode);
+    SlotDbEntry entry;
+    if (mode == SLOTS_DB_MODES || !slotDbReadEntry(db, index, &entry)) {
+        return false;
+    }
+    uint16_t size = encodePresetRecord(payload, videoMode, record);
+    uint16_t padded = slotDbCells(size) * SLOTS_DB_CELL; // keeps the file size a multiple of cells
+    memset(record + size, 0, padded - size);
+    uint16_t cell = slotDbAllocate(db, size);
+    if (!db.seek((uint32_t)cell * SLOTS_DB_CELL) || db.write(record, padded) != padded) {
+        return false;
+    }
+    entry.cell[mode] = cell;
+    entry.size[mode] = size;
+    return slotDbWriteEntry(db, index, &entry);
+}
+
+// Moves an old style slot file (SLOTS_FILE or a per slot preset file) into
+// the slot database. Returns false if name isn't one.
+static boolean slotDbImport(File &db, const String &name)
+{
+    if (name == SLOTS_FILE) {
+        File f = SPIFFS.open(name, "r");
+        SlotDbEntry entry;
+        SlotMeta meta;
+        for (uint8_t i = 0; f && i < SLOTS_TOTAL; i++) {
+            if (f.read((uint8_t *)&meta, sizeof(meta)) != sizeof(meta) || !slotDbReadEntry(db, i, &entry)) {
+                break;
+            }
+            entry.meta = meta;
+            entry.meta.slot = i;
+            slotDbWriteEntry(db, i, &entry);
+        }
+        f.close();
+        SPIFFS.remove(name);
+        return true;
+    }
+
+    uint8_t index = name.length() > 2 ? slotIndex(name[name.length() - 1]) : SLOT_NONE;
+    uint8_t mode = 0;
+    while (index != SLOT_NONE && mode < SLOTS_DB_MODES && presetFileName(slotDbVideoModes[mode], slotChar(index)) != name) {
+        mode++;
+    }
+    if (index == SLOT_NONE || mode == SLOTS_DB_MODES) {
+        return false;
+    }
+    static uint8_t payload[PRESET_PAYLOAD_SIZE];
+    File f = SPIFFS.open(name, "r");
+    if (f && readPresetFile(f, payload)) {
+        slotDbWritePreset(db, index, slotDbVideoModes[mode], payload);
+    }
+    f.close();
+    SPIFFS.remove(name);
+    return true;
+}
+
+// Creates the slot database, taking over SLOTS_FILE and the per slot preset files
+static File slotDbCreate()
+{
+    SerialM.println(F("creating slot database"));
+    SPIFFS.remove(SLOTS_DB_FILE ".tmp");
+    File db = SPIFFS.open(SLOTS_DB_FILE ".tmp", "w+");
+    if (!db) {
+        return db;
+    }
+    SlotDbHeader header = {SLOTS_DB_MAGIC, SLOTS_DB_VERSION, SLOTS_TOTAL};
+    db.write((const uint8_t *)&header, sizeof(header));
+    SlotDbEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    for (uint8_t i = 0; i < SLOTS_TOTAL; i++) {
+        slotMetaDefault(&entry.meta, i);
+        db.write((const uint8_t *)&entry, sizeof(entry));
+    }
+    for (uint16_t i = db.size(); i < SLOTS_DB_FIRST_CELL * SLOTS_DB_CELL; i++) {
+        db.write((uint8_t)0);
+    }
+
+    slotDbImport(db, SLOTS_FILE);
+    for (uint8_t i = 0; i < SLOTS_TOTAL; i++) {
+        for (uint8_t mode = 0; mode < SLOTS_DB_MODES; mode++) {
+            String name = presetFileName(slotDbVideoModes[mode], slotChar(i));
+            if (SPIFFS.exists(name)) {
+                slotDbImport(db, name);
+            }
+        }
+        yield();
+    }
+    db.close();
+    SPIFFS.rename(SLOTS_DB_FILE ".tmp", SLOTS_DB_FILE);
+    return SPIFFS.open(SLOTS_DB_FILE, "r+");
+}
+
+// The slot database, open for reading and writing. Created on first use.
+File slotDbOpen()
+{
+    File db = SPIFFS.open(SLOTS_DB_FILE, "r+");
+    if (db) {
+        SlotDbHeader header;
+        if (db.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            header.magic == SLOTS_DB_MAGIC && header.version == SLOTS_DB_VERSION && header.slots == SLOTS_TOTAL) {
+            return db;
+        }
+        db.close();
+        SerialM.println(F("slot database damaged"));
+        SPIFFS.remove(SLOTS_DB_FILE);
+    }
+    return slotDbCreate();
+}
+
+boolean slotDbReadMeta(uint8_t index, SlotMeta *meta)
+{
+    SlotDbEntry entry;
+    File db = slotDbOpen();
+    boolean ok = index < SLOTS_TOTAL && db && slotDbReadEntry(db, index, &entry);
+    db.close();
+    if (ok) {
+        *meta = entry.meta;
+    }
+    return ok;
+}
+
+boolean slotDbWriteMeta(uint8_t index, const SlotMeta *meta)
+{
+    SlotDbEntry entry;
+    File db = slotDbOpen();
+    boolean ok = index < SLOTS_TOTAL && db && slotDbReadEntry(db, index, &entry);
+    if (ok) {
+        entry.meta = *meta;
+        entry.meta.slot = index;
+        ok = slotDbWriteEntry(db, index, &entry);
+    }
+    db.close();
+    return ok;
+}
+
+// Empties a slot, its preset records become free space
+boolean slotDbRemove(uint8_t index)
+{
+    SlotDbEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    slotMetaDefault(&entry.meta, index);
+    File db = slotDbOpen();
+    boolean ok = index < SLOTS_TOTAL && db && slotDbWriteEntry(db, index, &entry);
+    db.close();
+    return ok;
+}
+
+// Exchanges two slots, name and preset records
+boolean slotDbSwap(uint8_t a, uint8_t b)
+{
+    SlotDbEntry entryA, entryB;
+    File db = slotDbOpen();
+    boolean ok = a < SLOTS_TOTAL && b < SLOTS_TOTAL && db &&
+                 slotDbReadEntry(db, a, &entryA) && slotDbReadEntry(db, b, &entryB);
+    if (ok) {
+        entryA.meta.slot = b;
+        entryB.meta.slot = a;
+        ok = slotDbWriteEntry(db, a, &entryB) && slotDbWriteEntry(db, b, &entryA);
+    }
+    db.close();
+    return ok;
+}
+
+// Takes over an old style slot file written to SPIFFS (restoring an old backup)
+boolean slotDbImportFile(const String &name)
+{
+    File db = slotDbOpen();
+    boolean ok = db && SPIFFS.exists(name) && slotDbImport(db, name);
+    db.close();
+    return ok;
+}
+
+// Reads the preset payload for a slot and source video mode.
+// Returns false if there is none or it is damaged.
+boolean slotDbLoadPreset(Ascii8 slot, uint8_t videoMode, uint8_t *payload)
+{
+    uint8_t index = slotIndex(slot);
+    uint8_t mode = slotDbMode(videoMode);
+    SlotDbEntry entry;
+    File db = slotDbOpen();
+    if (index == SLOT_NONE || mode == SLOTS_DB_MODES || !db || !slotDbReadEntry(db, index, &entry) || entry.cell[mode] == 0) {
+        SerialM.println(F("no preset file for this slot and source"));
+        db.close();
+        return false;
+    }
+    SerialM.println(entry.meta.name);
+    boolean outdated = false;
+    boolean ok = db.seek((uint32_t)entry.cell[mode] * SLOTS_DB_CELL) && readPresetRecord(db, payload, &outdated);
+    if (ok && outdated && slotDbWritePreset(db, index, videoMode, payload)) {
+        SerialM.println(F("preset converted")); // on first load
+    }
+    db.close();
+    return ok;
+}
+
+boolean slotDbSavePreset(Ascii8 slot, uint8_t videoMode, const uint8_t *payload)
+{
+    uint8_t index = slotIndex(slot);
+    File db = slotDbOpen();
+    boolean ok = index != SLOT_NONE && db && slotDbWritePreset(db, index, videoMode, payload);
+    db.close();
+    return ok;
+}
+
+// Decoded custom presets, so switching back and forth between source modes
+// (240p / 480i) doesn't touch the flash. Least recently used goes first.
+#define PRESET_CACHE_ENTRIES 2 // 432 bytes of RAM each
+
+struct PresetCacheEntry
+{
+    uint8_t payload[PRESET_PAYLOAD_SIZE];
+    Ascii8 slot; // 0 = unused
+    uint8_t videoMode;
+    uint16_t lastUse;
+};
+
+static PresetCacheEntry presetCache[PRESET_CACHE_ENTRIES];
+static uint16_t presetCacheClock = 0;
+
+// call whenever preset files may have changed
+void presetCacheInvalidate()
+{
+    for (uint8_t i = 0; i < PRESET_CACHE_ENTRIES; i++) {
+        presetCache[i].slot = 0;
+    }
+}
+
+const uint8_t *loadPresetFromSPIFFS(byte forVideoMode)
+{
+    Ascii8 slot = uopt->presetSlot; // preferences may not be flushed yet, RAM is current
 
     SerialM.print(F("loading from preset slot "));
     SerialM.print((char)slot);
     SerialM.print(": ");
 
-    if (forVideoMode == 1) {
-        f = SPIFFS.open("/preset_ntsc." + String((char)slot), "r");
-    } else if (forVideoMode == 2) {
-        f = SPIFFS.open("/preset_pal." + String((char)slot), "r");
-    } else if (forVideoMode == 3) {
-        f = SPIFFS.open("/preset_ntsc_480p." + String((char)slot), "r");
-    } else if (forVideoMode == 4) {
-        f = SPIFFS.open("/preset_pal_576p." + String((char)slot), "r");
-    } else if (forVideoMode == 5) {
-        f = SPIFFS.open("/preset_ntsc_720p." + String((char)slot), "r");
-    } else if (forVideoMode == 6) {
-        f = SPIFFS.open("/preset_ntsc_1080p." + String((char)slot), "r");
-    } else if (forVideoMode == 8) {
-        f = SPIFFS.open("/preset_medium_res." + String((char)slot), "r");
-    } else if (forVideoMode == 14) {
-        f = SPIFFS.open("/preset_vga_upscale." + String((char)slot), "r");
-    } else if (forVideoMode == 0) {
-        f = SPIFFS.open("/preset_unknown." + String((char)slot), "r");
+    PresetCacheEntry *entry = &presetCache[0];
+    for (uint8_t i = 0; i < PRESET_CACHE_ENTRIES; i++) {
+        if (presetCache[i].slot == slot && presetCache[i].videoMode == forVideoMode) {
+            SerialM.println(F("cached"));
+            presetCache[i].lastUse = ++presetCacheClock;
+            return presetCache[i].payload;
+        }
+        if (presetCache[i].slot == 0 || (entry->slot != 0 && (uint16_t)(presetCacheClock - presetCache[i].lastUse) > (uint16_t)(presetCacheClock - entry->lastUse))) {
+            entry = &presetCache[i]; // free or least recently used
+        }
     }
+    entry->slot = 0;
+    uint8_t *preset = entry->payload;
 
-    if (!f) {
-        SerialM.println(F("no preset file for this slot and source"));
+    if (!slotDbLoadPreset(slot, forVideoMode, preset)) {
         if (forVideoMode == 2 || forVideoMode == 4)
             return pal_240p;
         else
             return ntsc_240p;
-    } else {
-        SerialM.println(f.name());
-        s = f.readStringUntil('}');
-        f.close();
-    }
-
-    char *tmp;
-    uint16_t i = 0;
-    tmp = strtok(&s[0], ",");
-    while (tmp) {
-        preset[i++] = (uint8_t)atoi(tmp);
-        tmp = strtok(NULL, ",");
-        yield(); // wifi stack
     }
 
+    entry->slot = slot;
+    entry->videoMode = forVideoMode;
+    entry->lastUse = ++presetCacheClock;
     return preset;
 }
 
 void savePresetToSPIFFS()
 {
-    uint8_t readout = 0;
-    File f;
-    Ascii8 slot = 0;
+    static uint8_t payload[PRESET_PAYLOAD_SIZE];
+    Ascii8 slot = uopt->presetSlot;
 
-    // first figure out if the user has set a preferenced slot
-    f = SPIFFS.open("/preferencesv2.txt", "r");
-    if (f) {
-        uint8_t result[3];
-        result[0] = f.read(); // todo: move file cursor manually
-        result[1] = f.read();
-        result[2] = f.read();
+    SerialM.print(F("saving to preset slot "));
+    SerialM.println(String((char)slot));
 
-        f.close();
-        slot = result[2]; // got the slot to save to now
-    } else {
-        // file not found, we don't know where to save this preset
-        SerialM.println(F("please select a preset slot first!"));
+    if (slotIndex(slot) == SLOT_NONE || slotDbMode(rto->videoStandardInput) == SLOTS_DB_MODES) {
+        SerialM.println(F("open save file failed!"));
         return;
     }
 
-    SerialM.print(F("saving to preset slot "));
-    SerialM.println(String((char)slot));
+    GBS::GBS_PRESET_CUSTOM::write(1); // use one reserved bit to mark this as a custom preset
+    // don't store scanlines
+    if (GBS::GBS_OPTION_SCANLINES_ENABLED::read() == 1) {
+        disableScanlines();
+    }
 
-    if (rto->videoStandardInput == 1) {
-        f = SPIFFS.open("/preset_ntsc." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 2) {
-        f = SPIFFS.open("/preset_pal." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 3) {
-        f = SPIFFS.open("/preset_ntsc_480p." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 4) {
-        f = SPIFFS.open("/preset_pal_576p." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 5) {
-        f = SPIFFS.open("/preset_ntsc_720p." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 6) {
-        f = SPIFFS.open("/preset_ntsc_1080p." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 8) {
-        f = SPIFFS.open("/preset_medium_res." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 14) {
-        f = SPIFFS.open("/preset_vga_upscale." + String((char)slot), "w");
-    } else if (rto->videoStandardInput == 0) {
-        f = SPIFFS.open("/preset_unknown." + String((char)slot), "w");
+    if (!rto->extClockGenDetected) {
+        if (uopt->enableFrameTimeLock && FrameSync::getSyncLastCorrection() != 0) {
+            FrameSync::reset(uopt->frameTimeLockMethod);
+        }
     }
 
-    if (!f) {
+    // same order as writeProgramArrayNew() reads it back
+    uint16_t index = 0;
+    for (int i = 0; i <= 5; i++) {
+        writeOneByte(0xF0, i);
+        switch (i) {
+            case 0:
+                for (int x = 0x40; x <= 0x5F; x += 16) {
+                    readFromRegister(x, 16, payload + index); // one burst per bank
+                    index += 16;
+                }
+                for (int x = 0x90; x <= 0x9F; x += 16) {
+                    readFromRegister(x, 16, payload + index);
+                    index += 16;
+                }
+                break;
+            case 1:
+                for (int x = 0x0; x <= 0x2F; x += 16) {
+                    readFromRegister(x, 16, payload + index);
+                    index += 16;
+                }
+                break;
+            case 2:
+                // not needed anymore
+                break;
+            case 3:
+                for (int x = 0x0; x <= 0x7F; x += 16) {
+                    readFromRegister(x, 16, payload + index);
+                    index += 16;
+                }
+                break;
+            case 4:
+                for (int x = 0x0; x <= 0x5F; x += 16) {
+                    readFromRegister(x, 16, payload + index);
+                    index += 16;
+                }
+                break;
+            case 5:
+                for (int x = 0x0; x <= 0x6F; x += 16) {
+                    readFromRegister(x, 16, payload + index);
+                    index += 16;
+                }
+                break;
+        }
+    }
+
+    presetCacheInvalidate();
+    if (!slotDbSavePreset(slot, rto->videoStandardInput, payload)) {
         SerialM.println(F("open save file failed!"));
-    } else {
-        SerialM.println(F("open save file ok"));
+        return;
+    }
+    SerialM.println(F("preset saved"));
+}
 
-        GBS::GBS_PRESET_CUSTOM::write(1); // use one reserved bit to mark this as a custom preset
-        // don't store scanlines
-        if (GBS::GBS_OPTION_SCANLINES_ENABLED::read() == 1) {
-            disableScanlines();
-        }
+// Loads the options from PREFS_FILE, or takes over an old PREFS_FILE_V2.
+// Returns false if there are none.
+boolean loadUserPrefs()
+{
+    if (!SPIFFS.exists(PREFS_FILE) && SPIFFS.exists(PREFS_FILE_TMP)) {
+        SPIFFS.rename(PREFS_FILE_TMP, PREFS_FILE); // flushUserPrefs() was interrupted
+    }
 
-        if (!rto->extClockGenDetected) {
-            if (uopt->enableFrameTimeLock && FrameSync::getSyncLastCorrection() != 0) {
-                FrameSync::reset(uopt->frameTimeLockMethod);
-            }
+    File f = SPIFFS.open(PREFS_FILE, "r");
+    if (f) {
+        uint8_t buffer[PREFS_FILE_MAX];
+        uint16_t size = f.read(buffer, sizeof(buffer));
+        f.close();
+        bool migrated;
+        if (!prefsDecode(buffer, size, uopt, &migrated)) {
+            SerialM.println(F("preferences file damaged"));
+            return false;
         }
-
-        for (int i = 0; i <= 5; i++) {
-            writeOneByte(0xF0, i);
-            switch (i) {
-                case 0:
-                    for (int x = 0x40; x <= 0x5F; x++) {
-                        readFromRegister(x, 1, &readout);
-                        f.print(readout);
-                        f.println(",");
-                    }
-                    for (int x = 0x90; x <= 0x9F; x++) {
-                        readFromRegister(x, 1, &readout);
-                        f.print(readout);
-                        f.println(",");
-                    }
-                    break;
-                case 1:
-                    for (int x = 0x0; x <= 0x2F; x++) {
-                        readFromRegister(x, 1, &readout);
-                        f.print(readout);
-                        f.println(",");
-                    }
-                    break;
-                case 2:
-                    // not needed anymore
-                    break;
-                case 3:
-                    for (int x = 0x0; x <= 0x7F; x++) {
-                        readFromRegister(x, 1, &readout);
-                        f.print(readout);
-                        f.println(",");
-                    }
-                    break;
-                case 4:
-                    for (int x = 0x0; x <= 0x5F; x++) {
-                        readFromRegister(x, 1, &readout);
-                        f.print(readout);
-                        f.println(",");
-                    }
-                    break;
-                case 5:
-                    for (int x = 0x0; x <= 0x6F; x++) {
-                        readFromRegister(x, 1, &readout);
-                        f.print(readout);
-                        f.println(",");
-                    }
-                    break;
-            }
+        if (migrated) {
+            saveUserPrefs(); // in this firmware's layout
         }
-        f.println("};");
-        SerialM.print(F("preset saved as: "));
-        SerialM.println(f.name());
-        f.close();
+        return true;
     }
+
+    f = SPIFFS.open(PREFS_FILE_V2, "r");
+    if (!f) {
+        return false;
+    }
+    // option id n at position n - 1, as value + '0' except for the slot
+    uint8_t text[32];
+    uint16_t size = f.read(text, sizeof(text));
+    f.close();
+    prefsDefaults(uopt);
+    for (uint8_t i = 0; i < prefsOptionsCount; i++) {
+        PrefsOption option = prefsOption(i);
+        if (option.field.id <= size) {
+            uint8_t c = text[option.field.id - 1];
+            if (option.field.offset != offsetof(userOptions, presetSlot)) {
+                c -= '0';
+            }
+            prefsSet((uint8_t *)uopt + option.field.offset, option.field.size, c);
+        }
+    }
+    prefsValidate(uopt);
+    saveUserPrefs();
+    flushUserPrefs();
+    SPIFFS.remove(PREFS_FILE_V2);
+    SerialM.println(F("preferences converted"));
+    return true;
 }
 
+// Options changed: they are written by checkUserPrefs() once they stop
+// changing for PREFS_QUIET_PERIOD, so encoder / slider steps don't each
+// stall on a flash write. Call flushUserPrefs() before resetting.
 void saveUserPrefs()
 {
-    File f = SPIFFS.open("/preferencesv2.txt", "w");
+    userPrefsDirty = true;
+    userPrefsChanged = millis();
+}
+
+void checkUserPrefs()
+{
+    if (userPrefsDirty && millis() - userPrefsChanged >= PREFS_QUIET_PERIOD) {
+        flushUserPrefs();
+    }
+}
+
+// Writes the options now if they changed. The old file is only replaced by a
+// complete new one, see the recovery in setup().
+void flushUserPrefs()
+{
+    if (!userPrefsDirty) {
+        return;
+    }
+    userPrefsDirty = false;
+    uint8_t buffer[prefsFileSize];
+    uint16_t size = prefsEncode(uopt, buffer);
+    File f = SPIFFS.open(PREFS_FILE_TMP, "w");
     if (!f) {
         SerialM.println(F("saveUserPrefs: open file failed"));
         return;
     }
-    f.write(uopt->presetPreference + '0'); // #1
-    f.write(uopt->enableFrameTimeLock + '0');
-    f.write(uopt->presetSlot);
-    f.write(uopt->frameTimeLockMethod + '0');
-    f.write(uopt->enableAutoGain + '0');
-    f.write(uopt->wantScanlines + '0');
-    f.write(uopt->wantOutputComponent + '0');
-    f.write(uopt->deintMode + '0');
-    f.write(uopt->wantVdsLineFilter + '0');
-    f.write(uopt->wantPeaking + '0');
-    f.write(uopt->preferScalingRgbhv + '0');
-    f.write(uopt->wantTap6 + '0');
-    f.write(uopt->PalForce60 + '0');
-    f.write(uopt->matchPresetSource + '0');             // #14
-    f.write(uopt->wantStepResponse + '0');              // #15
-    f.write(uopt->wantFullHeight + '0');                // #16
-    f.write(uopt->enableCalibrationADC + '0');          // #17
-    f.write(uopt->scanlineStrength + '0');              // #18
-    f.write(uopt->disableExternalClockGenerator + '0'); // #19
-
-
+    boolean ok = f.write(buffer, size) == size;
     f.close();
+    if (!ok) {
+        SerialM.println(F("saveUserPrefs: write failed"));
+        return;
+    }
+    SPIFFS.remove(PREFS_FILE);
+    SPIFFS.rename(PREFS_FILE_TMP, PREFS_FILE);
 }
 
 #endif
@@ -10826,6 +11850,7 @@ void settingsMenuOLED()
                 display.display();
             }
             webSocket.close();
+            flushUserPrefs();
             delay(60);
             ESP.reset();
             oled_selectOption = 0;
@@ -10843,6 +11868,7 @@ void settingsMenuOLED()
             webSocket.close();
             loadDefaultUserOptions();
             saveUserPrefs();
+            flushUserPrefs();
             delay(60);
             ESP.reset();
             oled_selectOption = 1;
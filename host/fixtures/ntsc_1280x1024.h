@@ -0,0 +1,435 @@
+// ntsc_1280x1024.h as it was before presetgen.h, see preset_check.cpp
+const uint8_t ntsc_1280x1024_fixture[] PROGMEM = {
+    0x7C, // s0_40
+    0xA5, // s0_41
+    0x0,  // s0_42
+    0x19, // s0_43
+    0x25, // s0_44
+    0xD,  // s0_45
+    0x7F, // s0_46
+    0x17, // s0_47
+    0xEB, // s0_48
+    0xB,  // s0_49
+    0x0,  // s0_4A
+    0x0,  // s0_4B
+    0x0,  // s0_4C
+    0x2A, // s0_4D
+    0x0,  // s0_4E
+    0x3C, // s0_4F
+    0x0,  // s0_50
+    0x0,  // s0_51
+    0x67, // s0_52
+    0x0,  // s0_53
+    0x0,  // s0_54
+    0x0,  // s0_55
+    0x0,  // s0_56
+    0x0,  // s0_57
+    0x0,  // s0_58
+    0xFF, // s0_59
+    0x0,  // s0_5A
+    0x0,  // s0_5B
+    0x0,  // s0_5C
+    0x0,  // s0_5D
+    0x0,  // s0_5E
+    0x0,  // s0_5F
+    0x82, // s0_90
+    0x0,  // s0_91
+    0x4E, // s0_92
+    0xC5, // s0_93
+    0x0,  // s0_94
+    0x10, // s0_95
+    0x10, // s0_96
+    0x0,  // s0_97
+    0x0,  // s0_98
+    0x0,  // s0_99
+    0x0,  // s0_9A
+    0x0,  // s0_9B
+    0x0,  // s0_9C
+    0x0,  // s0_9D
+    0x0,  // s0_9E
+    0x0,  // s0_9F
+    0x2,  // s1_0
+    0xE1, // s1_1
+    0x6A, // s1_2
+    0x0,  // s1_3
+    0x0,  // s1_4
+    0x0,  // s1_5
+    0x0,  // s1_6
+    0x0,  // s1_7
+    0x0,  // s1_8
+    0x0,  // s1_9
+    0x0,  // s1_A
+    0x50, // s1_B
+    0x6,  // s1_C
+    0x0,  // s1_D
+    0x94, // s1_E
+    0x4,  // s1_F
+    0x2,  // s1_10
+    0x0,  // s1_11
+    0x48, // s1_12
+    0x0,  // s1_13
+    0x40, // s1_14
+    0x4,  // s1_15
+    0x4C, // s1_16
+    0x0,  // s1_17
+    0x64, // s1_18
+    0x4,  // s1_19
+    0x74, // s1_1A
+    0x0,  // s1_1B
+    0x4,  // s1_1C
+    0x0,  // s1_1D
+    0x6,  // s1_1E
+    0x0,  // s1_1F
+    0x40, // s1_20
+    0x0,  // s1_21
+    0xD5, // s1_22
+    0x4,  // s1_23
+    0x0,  // s1_24
+    0x0,  // s1_25
+    0x88, // s1_26
+    0x0,  // s1_27
+    0x3E, // s1_28
+    0x0,  // s1_29
+    0x0,  // s1_2A
+    0x2,  // s1_2B
+    0x0,  // s1_2C
+    0x0,  // s1_2D
+    0x0,  // s1_2E
+    0x0,  // s1_2F
+    0x2,  // s3_0
+    0xE7, // s3_1
+    0xA9, // s3_2
+    0x42, // s3_3
+    0x68, // s3_4
+    0x9,  // s3_5
+    0x18, // s3_6
+    0x1C, // s3_7
+    0xE0, // s3_8
+    0x1,  // s3_9
+    0x10, // s3_A
+    0x0,  // s3_B
+    0x9,  // s3_C
+    0x1,  // s3_D
+    0x40, // s3_E
+    0x0,  // s3_F
+    0xC0, // s3_10
+    0x49, // s3_11
+    0x20, // s3_12
+    0x2A, // s3_13
+    0x84, // s3_14
+    0x2,  // s3_15
+    0x0,  // s3_16
+    0x52, // s3_17
+    0x1E, // s3_18
+    0x4,  // s3_19
+    0x0,  // s3_1A
+    0x1,  // s3_1B
+    0x0,  // s3_1C
+    0x0,  // s3_1D
+    0x0,  // s3_1E
+    0x1,  // s3_1F
+    0x2C, // s3_20
+    0x4,  // s3_21
+    0x2C, // s3_22
+    0x4,  // s3_23
+    0xA0, // s3_24
+    0x3,  // s3_25
+    0x0,  // s3_26
+    0xCF, // s3_27
+    0x26, // s3_28
+    0x7,  // s3_29
+    0x11, // s3_2A
+    0x11, // s3_2B
+    0xE0, // s3_2C
+    0x2F, // s3_2D
+    0x20, // s3_2E
+    0xF0, // s3_2F
+    0x40, // s3_30
+    0x3A, // s3_31
+    0x88, // s3_32
+    0x0,  // s3_33
+    0x0,  // s3_34
+    0x80, // s3_35
+    0x1C, // s3_36
+    0x29, // s3_37
+    0x0,  // s3_38
+    0x0,  // s3_39
+    0x0,  // s3_3A
+    0x0,  // s3_3B
+    0x0,  // s3_3C
+    0x0,  // s3_3D
+    0x80, // s3_3E
+    0x0,  // s3_3F
+    0x3,  // s3_40
+    0x3,  // s3_41
+    0x40, // s3_42
+    0xC,  // s3_43
+    0xF8, // s3_44
+    0x16, // s3_45
+    0xF8, // s3_46
+    0x18, // s3_47
+    0xF9, // s3_48
+    0x10, // s3_49
+    0xF9, // s3_4A
+    0x20, // s3_4B
+    0xF9, // s3_4C
+    0xA,  // s3_4D
+    0x1A, // s3_4E
+    0x1E, // s3_4F
+    0x30, // s3_50
+    0x0,  // s3_51
+    0x70, // s3_52
+    0x8,  // s3_53
+    0x24, // s3_54
+    0xA,  // s3_55
+    0x8B, // s3_56
+    0x0,  // s3_57
+    0x14, // s3_58
+    0x0,  // s3_59
+    0x0,  // s3_5A
+    0x1A, // s3_5B
+    0x0,  // s3_5C
+    0xC4, // s3_5D
+    0x3F, // s3_5E
+    0x4,  // s3_5F
+    0x4,  // s3_60
+    0x9B, // s3_61
+    0x80, // s3_62
+    0x9,  // s3_63
+    0xE9, // s3_64
+    0xFF, // s3_65
+    0x7F, // s3_66
+    0x40, // s3_67
+    0xD2, // s3_68
+    0xD,  // s3_69
+    0xD8, // s3_6A
+    0xFF, // s3_6B
+    0x3F, // s3_6C
+    0xC0, // s3_6D
+    0x49, // s3_6E
+    0x20, // s3_6F
+    0x28, // s3_70
+    0xAC, // s3_71
+    0x2,  // s3_72
+    0xBC, // s3_73
+    0x5,  // s3_74
+    0x0,  // s3_75
+    0x0,  // s3_76
+    0x0,  // s3_77
+    0x0,  // s3_78
+    0x0,  // s3_79
+    0x0,  // s3_7A
+    0x0,  // s3_7B
+    0x0,  // s3_7C
+    0x0,  // s3_7D
+    0x0,  // s3_7E
+    0x0,  // s3_7F
+    0x82, // s4_0
+    0x30, // s4_1
+    0x0,  // s4_2
+    0x0,  // s4_3
+    0x30, // s4_4
+    0x11, // s4_5
+    0x42, // s4_6
+    0x30, // s4_7
+    0x1,  // s4_8
+    0x94, // s4_9
+    0x11, // s4_A
+    0x7F, // s4_B
+    0x0,  // s4_C
+    0x74, // s4_D
+    0x0,  // s4_E
+    0x6,  // s4_F
+    0x0,  // s4_10
+    0x92, // s4_11
+    0x5,  // s4_12
+    0x1,  // s4_13
+    0x96, // s4_14
+    0x5,  // s4_15
+    0x0,  // s4_16
+    0x0,  // s4_17
+    0x6,  // s4_18
+    0x0,  // s4_19
+    0x50, // s4_1A
+    0x21, // s4_1B
+    0x0,  // s4_1C
+    0x0,  // s4_1D
+    0x0,  // s4_1E
+    0x0,  // s4_1F
+    0x0,  // s4_20
+    0x43, // s4_21
+    0x2,  // s4_22
+    0x8,  // s4_23
+    0x0,  // s4_24
+    0xF0, // s4_25
+    0x10, // s4_26
+    0xFF, // s4_27
+    0xFF, // s4_28
+    0x1F, // s4_29
+    0x0,  // s4_2A
+    0x87, // s4_2B
+    0x18, // s4_2C
+    0x3D, // s4_2D
+    0x0,  // s4_2E
+    0x0,  // s4_2F
+    0x0,  // s4_30
+    0x0,  // s4_31
+    0x0,  // s4_32
+    0xC,  // s4_33
+    0x0,  // s4_34
+    0x0,  // s4_35
+    0xC,  // s4_36
+    0x0,  // s4_37
+    0x1,  // s4_38
+    0x0,  // s4_39
+    0x1,  // s4_3A
+    0x0,  // s4_3B
+    0x0,  // s4_3C
+    0x0,  // s4_3D
+    0x3,  // s4_3E
+    0x0,  // s4_3F
+    0x0,  // s4_40
+    0x0,  // s4_41
+    0x6C, // s4_42
+    0x0,  // s4_43
+    0x0,  // s4_44
+    0xD0, // s4_45
+    0x4,  // s4_46
+    0x0,  // s4_47
+    0xD0, // s4_48
+    0x4,  // s4_49
+    0x0,  // s4_4A
+    0x14, // s4_4B
+    0x0,  // s4_4C
+    0x70, // s4_4D
+    0x24, // s4_4E
+    0x34, // s4_4F
+    0x0,  // s4_50
+    0x0,  // s4_51
+    0x0,  // s4_52
+    0x0,  // s4_53
+    0x1,  // s4_54
+    0x0,  // s4_55
+    0x0,  // s4_56
+    0x0,  // s4_57
+    0x0,  // s4_58
+    0x1,  // s4_59
+    0x0,  // s4_5A
+    0xCC, // s4_5B
+    0x0,  // s4_5C
+    0x0,  // s4_5D
+    0x0,  // s4_5E
+    0x0,  // s4_5F
+    0x10, // s5_0
+    0x0,  // s5_1
+    0x5B, // s5_2
+    0x31, // s5_3
+    0x2,  // s5_4
+    0x2,  // s5_5
+    0x40, // s5_6
+    0x40, // s5_7
+    0x40, // s5_8
+    0x7B, // s5_9
+    0x7B, // s5_A
+    0x7B, // s5_B
+    0x12, // s5_C
+    0x0,  // s5_D
+    0x82, // s5_E
+    0x0,  // s5_F
+    0x0,  // s5_10
+    0xB2, // s5_11
+    0x29, // s5_12
+    0x9,  // s5_13
+    0x0,  // s5_14
+    0x0,  // s5_15
+    0x6F, // s5_16
+    0x6,  // s5_17
+    0xA1, // s5_18
+    0x97, // s5_19
+    0x0,  // s5_1A
+    0x0,  // s5_1B
+    0x0,  // s5_1C
+    0x0,  // s5_1D
+    0x80, // s5_1E
+    0x81, // s5_1F
+    0x0,  // s5_20
+    0x18, // s5_21
+    0xF,  // s5_22
+    0x0,  // s5_23
+    0x40, // s5_24
+    0x0,  // s5_25
+    0x4,  // s5_26
+    0x0,  // s5_27
+    0x0,  // s5_28
+    0x0,  // s5_29
+    0xF,  // s5_2A
+    0x0,  // s5_2B
+    0x0,  // s5_2C
+    0x3,  // s5_2D
+    0x0,  // s5_2E
+    0x2,  // s5_2F
+    0x0,  // s5_30
+    0x2F, // s5_31
+    0x0,  // s5_32
+    0x3A, // s5_33
+    0x6,  // s5_34
+    0xC0, // s5_35
+    0x0,  // s5_36
+    0x14, // s5_37
+    0xA,  // s5_38
+    0x9,  // s5_39
+    0x3,  // s5_3A
+    0x0,  // s5_3B
+    0x0,  // s5_3C
+    0x0,  // s5_3D
+    0x0,  // s5_3E
+    0x4,  // s5_3F
+    0x1,  // s5_40
+    0xE,  // s5_41
+    0x0,  // s5_42
+    0x4C, // s5_43
+    0x0,  // s5_44
+    0x10, // s5_45
+    0x0,  // s5_46
+    0x0,  // s5_47
+    0x0,  // s5_48
+    0x0,  // s5_49
+    0x0,  // s5_4A
+    0x84, // s5_4B
+    0x8,  // s5_4C
+    0x10, // s5_4D
+    0x0,  // s5_4E
+    0x78, // s5_4F
+    0x6,  // s5_50
+    0x2,  // s5_51
+    0x0,  // s5_52
+    0x0,  // s5_53
+    0x0,  // s5_54
+    0x0,  // s5_55
+    0x5,  // s5_56
+    0xC0, // s5_57
+    0x5,  // s5_58
+    0x0,  // s5_59
+    0x1,  // s5_5A
+    0x0,  // s5_5B
+    0x3,  // s5_5C
+    0x2,  // s5_5D
+    0x0,  // s5_5E
+    0x0,  // s5_5F
+    0x0,  // s5_60
+    0x0,  // s5_61
+    0x0,  // s5_62
+    0xF,  // s5_63
+    0x0,  // s5_64
+    0x0,  // s5_65
+    0x0,  // s5_66
+    0x0,  // s5_67
+    0x0,  // s5_68
+    0x0,  // s5_69
+    0x0,  // s5_6A
+    0x0,  // s5_6B
+    0x0,  // s5_6C
+    0x0,  // s5_6D
+    0x0,  // s5_6E
+    0x0,  // s5_6F
+};
@@ -0,0 +1,581 @@
+// Frame sync benchmark: FrameSyncManager (framesync.h) on a Linux host,
+// against simulated input and output vsync.
+//
+// The GBS registers are TV5725Sim (tv5725sim.h), simulated time is its
+// clock: bus traffic costs what it would at 400kHz and HostPlatform below
+// stands in for FrameSyncEsp. The input vsync runs at the scenario's rate
+// with drift and jitter and goes away for a while halfway through (a
+// source reset). The output vsync follows VDS_HSYNC_RST * VDS_VSYNC_RST
+// over the display clock, the clock gen's when PLL648_CONTROL_01 picks it.
+// loop() is modelled as a pass every LOOP_PASS_US with an occasional
+// stall, the lock runs every lockInterval like the firmware does them.
+//
+// Per method and scenario, averaged over the seeds:
+//   lock s       seconds from the input coming back until the phase stays
+//                within LOCK_WINDOW frames of the target for LOCK_RUNS runs
+//                (- if it never does)
+//   rms fr       phase error RMS in frames, over the runs before the reset
+//   corrections  output frames with other timing than the frame before
+//   worst fps    largest deviation of an output frame rate from the input
+//
+// runFrequency runs the alpha-beta rate filter and PI phase controller
+// with the gains below, runFrequency P the proportional controller it
+// replaced (two-sample rate check included), for comparison when tuning.
+// Both move the output at most MAX_CORRECTION (0.06%) off the input
+// rate, 0.06 frames of phase per run, so lock times after a reset are
+// mostly that slew and hardly move with the gains; compare rms.
+//
+// Usage: framesync_sim [-v] [-s seeds] [method...], methods as listed.
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <random>
+#include <vector>
+
+#include "tv5725sim.h"
+#include "options.h"
+
+typedef TV5725<GBS_ADDR> GBS;
+
+static runTimeOptions rtoStore;
+runTimeOptions *rto = &rtoStore;
+
+static bool verbose = false;
+
+struct HostSerial
+{
+    void printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        if (verbose) {
+            va_list args;
+            va_start(args, format);
+            vprintf(format, args);
+            va_end(args);
+        }
+    }
+} SerialM;
+
+#define CPU_HZ 160000000 // board_build.f_cpu
+#define LOOP_PASS_US 1000
+#define LOCK_WINDOW 0.05
+#define LOCK_RUNS 20
+
+// The simulated world around the GBS: input source, output timing and the
+// debug pin
+namespace world {
+    struct Scenario
+    {
+        const char *name;
+        double inRate;    // Hz
+        double outRate;   // Hz, before the first lock
+        double drift;     // input rate change per second, relative
+        double jitter;    // input edge time sigma, us
+        double clockPpm;  // clock gen crystal error
+        uint32_t stallUs; // loop() stall every 7 lock runs
+    };
+
+    std::mt19937 rng;
+    const Scenario *scenario;
+    double start;    // us, TV5725Sim::now() of the scenario start
+    double inIdeal;  // us, the next input vsync without jitter
+    double inNext;   // us, the next input edge on the pin
+    double inLast;   // us, the last input vsync without jitter
+    double outLast;  // us, the last output vsync
+    double gapFrom, gapTo; // us, no input in between
+    double clockGen; // Hz, what setClock() asked for
+    void (*isr)();
+    bool inIsr;
+    uint32_t isrStamp;
+
+    // output timing as the frame counter sees it
+    double excursion;
+    bool watchExcursion;
+    uint32_t corrections;
+    uint32_t lastTiming[3];
+
+    double now()
+    {
+        return TV5725Sim::now();
+    }
+
+    double inRate(double t)
+    {
+        return scenario->inRate * (1 + scenario->drift * (t - start) / 1e6);
+    }
+
+    uint16_t htotal()
+    {
+        return TV5725Sim::peek(3, 0x01) | (TV5725Sim::peek(3, 0x02) & 0x0f) << 8;
+    }
+
+    uint16_t vtotal()
+    {
+        return TV5725Sim::peek(3, 0x02) >> 4 | (TV5725Sim::peek(3, 0x03) & 0x7f) << 4;
+    }
+
+    double displayClock()
+    {
+        return TV5725Sim::peek(0, 0x41) == 0x75 ? clockGen * (1 + scenario->clockPpm) : 81000000.0;
+    }
+
+    double outPeriod()
+    {
+        return htotal() * (double)vtotal() / displayClock() * 1e6;
+    }
+
+    // what the test bus puts on the debug pin: 1 input vsync, 2 output
+    // vblank, 0 something else
+    uint8_t pin()
+    {
+        uint8_t testBusSel = TV5725Sim::peek(0, 0x4d) & 0x1f;
+        uint8_t ifTestSel = TV5725Sim::peek(1, 0x28) >> 4;
+        uint8_t spTestSel = TV5725Sim::peek(5, 0x63);
+        if ((testBusSel == 0x0 && ifTestSel == 3) || (testBusSel == 0xa && spTestSel == 0x0f)) {
+            return 1;
+        }
+        return testBusSel == 0x2 ? 2 : 0;
+    }
+
+    void fire(double t)
+    {
+        if (isr) {
+            inIsr = true;
+            isrStamp = (uint32_t)(uint64_t)llround(t * (CPU_HZ / 1000000));
+            isr();
+            inIsr = false;
+        }
+    }
+
+    void scheduleInput()
+    {
+        inLast = inIdeal;
+        inIdeal += 1e6 / inRate(inIdeal);
+        if (inIdeal >= gapFrom && inIdeal < gapTo) {
+            inIdeal = gapTo;
+        }
+        std::normal_distribution<double> jitter(0, scenario->jitter);
+        inNext = inIdeal + jitter(rng);
+    }
+
+    void outputFrame(double period)
+    {
+        if (watchExcursion) {
+            double deviation = fabs(1e6 / period - inRate(outLast)) / inRate(outLast);
+            excursion = deviation > excursion ? deviation : excursion;
+        }
+        uint32_t timing[3] = {htotal(), vtotal(), (uint32_t)clockGen};
+        if (memcmp(timing, lastTiming, sizeof(timing)) != 0) {
+            corrections++;
+            memcpy(lastTiming, timing, sizeof(timing));
+        }
+    }
+
+    // Delivers the edges up to now. Register writes since the last output
+    // vsync still count for the frame under way, as with the VDS counters.
+    void update()
+    {
+        if (inIsr) {
+            return;
+        }
+        double t = now();
+        for (;;) {
+            double period = outPeriod();
+            double outNext = outLast + period;
+            if (inNext > t && outNext > t) {
+                break;
+            }
+            if (outNext <= inNext) {
+                outputFrame(period);
+                outLast = outNext;
+                if (pin() == 2) {
+                    fire(outLast);
+                }
+            } else {
+                double edge = inNext;
+                scheduleInput();
+                if (pin() == 1) {
+                    fire(edge);
+                }
+            }
+        }
+    }
+
+    void advance(uint32_t us)
+    {
+        TV5725Sim::advance(us);
+        update();
+    }
+
+    void begin(const Scenario &s, unsigned seed)
+    {
+        scenario = &s;
+        rng.seed(seed);
+        start = now();
+        inIdeal = start + std::uniform_real_distribution<double>(0, 1e6 / s.inRate)(rng);
+        gapFrom = gapTo = 0;
+        scheduleInput();
+        outLast = start;
+        isr = nullptr;
+        inIsr = false;
+        excursion = 0;
+        watchExcursion = false;
+        corrections = 0;
+        memset(lastTiming, 0, sizeof(lastTiming));
+    }
+
+    // output vsync phase behind the input, in frames, 0..1
+    double phase()
+    {
+        double frame = 1e6 / inRate(inLast);
+        return fmod(outLast - inLast + 8 * frame, frame) / frame;
+    }
+}
+
+// FrameSyncEsp for the simulated world
+struct HostPlatform
+{
+    static uint32_t cycles()
+    {
+        world::update();
+        if (world::inIsr) {
+            return world::isrStamp;
+        }
+        return (uint32_t)(uint64_t)llround(world::now() * (CPU_HZ / 1000000));
+    }
+
+    static uint32_t cyclesPerSecond()
+    {
+        return CPU_HZ;
+    }
+
+    static uint32_t ms()
+    {
+        world::update();
+        return TV5725Sim::now() / 1000;
+    }
+
+    static void wait()
+    {
+        world::advance(1000);
+    }
+
+    static void attachEdgeISR(void (*isr)())
+    {
+        world::isr = isr;
+    }
+
+    static void detachEdgeISR()
+    {
+        world::isr = nullptr;
+    }
+
+    static void setClock(uint32_t freq)
+    {
+        world::update();
+        world::clockGen = freq;
+        world::advance(150); // one Si5351 PLL burst
+    }
+
+    static void idle()
+    {
+        world::advance(50);
+    }
+};
+
+#define FRAMESYNC_PLATFORM HostPlatform
+#include "framesync.h"
+
+// runFrequency() gains, as FrameSyncAttrs in gbs-control.cpp unless
+// defined on the command line for tuning, e.g.
+// make -C host -B CPPFLAGS=-DSIM_PHASE_KI=0.002f check
+#ifndef SIM_RATE_ALPHA
+#define SIM_RATE_ALPHA 0.3f
+#endif
+#ifndef SIM_RATE_BETA
+#define SIM_RATE_BETA 0.02f
+#endif
+#ifndef SIM_PHASE_KP
+#define SIM_PHASE_KP 0.0038f
+#endif
+#ifndef SIM_PHASE_KI
+#define SIM_PHASE_KI 0.001f
+#endif
+#ifndef SIM_DITHER_KP
+#define SIM_DITHER_KP 0.5f
+#endif
+#ifndef SIM_DITHER_KI
+#define SIM_DITHER_KI 0.1f
+#endif
+#ifndef SIM_DITHER_BAND
+#define SIM_DITHER_BAND 30.0f
+#endif
+
+// As FrameSyncAttrs in gbs-control.cpp
+struct Attrs
+{
+    static const uint8_t debugInPin = 0;
+    static const uint32_t lockInterval = 100 * 16.70;
+    static const int16_t syncCorrection = 2;
+    static const int32_t syncTargetPhase = 90;
+    static constexpr float rateAlpha = SIM_RATE_ALPHA;
+    static constexpr float rateBeta = SIM_RATE_BETA;
+    static constexpr float phaseKp = SIM_PHASE_KP;
+    static constexpr float phaseKi = SIM_PHASE_KI;
+    static const bool rateRecheck = false;
+    static constexpr float ditherKp = SIM_DITHER_KP;
+    static constexpr float ditherKi = SIM_DITHER_KI;
+    static constexpr float ditherBand = SIM_DITHER_BAND;
+};
+
+// The proportional controller runFrequency() had before the rate filter
+// and the phase integrator: the last measured input rate as is, plus
+// phaseKp, taken only when a second measurement agrees with it
+struct PAttrs : Attrs
+{
+    static constexpr float rateAlpha = 1.0f;
+    static constexpr float rateBeta = 0.0f;
+    static constexpr float phaseKp = 0.0038f;
+    static constexpr float phaseKi = 0.0f;
+    static const bool rateRecheck = true;
+};
+
+struct Method
+{
+    const char *name;
+    uint8_t frameTimeLockMethod;
+    bool clockGen; // runFrequency()
+    void (*begin)(bool);
+    bool (*run)(uint8_t);
+    void (*dither)();
+    uint16_t (*init)(uint8_t);
+    void (*reset)(uint8_t);
+    bool (*ready)();
+    void (*initFrequency)(float, uint32_t);
+};
+
+template <class FS>
+struct MethodOf
+{
+    static void begin(bool clockGen)
+    {
+        FS::cleanup();
+        if (clockGen) {
+            FS::clearFrequency();
+        }
+    }
+
+    static bool run(uint8_t method)
+    {
+        return method == 0xff ? FS::runFrequency() : FS::runVsync(method);
+    }
+
+    static Method make(const char *name, uint8_t method, bool clockGen)
+    {
+        Method m = {name, method, clockGen, begin, run, FS::runDither, FS::init, FS::reset, FS::ready, FS::initFrequency};
+        return m;
+    }
+};
+
+typedef FrameSyncManager<GBS, Attrs> FrameSync;
+
+static const Method methods[] = {
+    MethodOf<FrameSync>::make("runVsync 0", FRAMESYNC_METHOD_VTOTAL_VS, false),
+    MethodOf<FrameSync>::make("runVsync 1", FRAMESYNC_METHOD_VTOTAL, false),
+    MethodOf<FrameSync>::make("runVsync 2", FRAMESYNC_METHOD_DITHER, false),
+    MethodOf<FrameSync>::make("runFrequency", 0xff, true),
+    MethodOf<FrameSyncManager<GBS, PAttrs>>::make("runFrequency P", 0xff, true),
+};
+
+static const world::Scenario scenarios[] = {
+    {"NTSC 59.94", 59.94, 60.0, 0, 2, 0, 40000},
+    {"SNES 60.09", 60.0988, 59.94, 0, 2, 0, 40000},
+    {"SNES, drift + clock gen 50 ppm", 60.0988, 59.94, 2e-7, 2, 50e-6, 40000},
+    {"PAL 50", 50.0, 50.0, 0, 2, 0, 40000},
+    {"NTSC, 20 us jitter", 59.94, 60.0, 0, 20, 0, 40000},
+};
+
+struct Result
+{
+    double lock; // s, < 0 for none
+    double rms;  // frames
+    uint32_t corrections;
+    double excursion;
+};
+
+// the loop() passes between two lock runs
+static void loopFor(const Method &m, uint32_t us, uint32_t stallUs)
+{
+    uint32_t end = TV5725Sim::now() + us;
+    TV5725Sim::advance(stallUs);
+    while ((int32_t)(end - TV5725Sim::now()) > 0) {
+        world::advance(LOOP_PASS_US);
+        if (m.frameTimeLockMethod == FRAMESYNC_METHOD_DITHER && !m.clockGen) {
+            m.dither();
+        }
+    }
+}
+
+// what doPostPresetLoadSteps() / the sync watcher do before locking
+static bool lockInit(const Method &m)
+{
+    GBS::TEST_BUS_SEL::write(0x0);
+    uint16_t best = m.init(m.frameTimeLockMethod);
+    if (best == 0) {
+        return false;
+    }
+    if (!m.clockGen) {
+        GBS::VDS_HSYNC_RST::write(best);
+        return true;
+    }
+    // externalClockGenSyncInOutRate()
+    uint32_t ticks = FrameSync::getPulseTicks();
+    if (ticks == 0) {
+        return false;
+    }
+    float sfr = (float)CPU_HZ / ticks;
+    float ofr = 1e6 / world::outPeriod();
+    m.initFrequency(ofr, rto->freqExtClockGen);
+    setExternalClockGenFrequencySmooth(sfr / ofr * rto->freqExtClockGen);
+    return true;
+}
+
+static Result simulate(const Method &m, const world::Scenario &s, unsigned seed, uint16_t runs)
+{
+    TV5725Sim::reset(GBS_ADDR);
+    TV5725Sim::setFieldPeriod(8);
+    GBS::shadowEnable(true);
+    world::begin(s, seed);
+    world::clockGen = 81000000;
+    rto->freqExtClockGen = 81000000;
+    rto->outModeHdBypass = false;
+
+    GBS::PLL648_CONTROL_01::write(m.clockGen ? 0x75 : 0x65);
+    GBS::PAD_CKIN_ENZ::write(0);
+    GBS::VDS_VSYNC_RST::write(1000);
+    GBS::VDS_VS_ST::write(1);
+    GBS::VDS_HSYNC_RST::write(81000000 / (s.outRate * 1000));
+    GBS::IF_TEST_SEL::write(3);
+    GBS::TEST_BUS_SEL::write(0x0);
+    VsyncCapture::begin();
+    m.begin(m.clockGen);
+    loopFor(m, 200000, 0);
+
+    for (uint8_t i = 0; i < 10 && !lockInit(m); i++) {
+        loopFor(m, 20000, 0);
+    }
+
+    uint16_t resetRun = runs / 2;
+    uint8_t failed = 0;
+    double resumed = 0;
+    std::vector<double> error(runs), at(runs);
+    for (uint16_t r = 0; r < runs; r++) {
+        if (r == resetRun) {
+            // the source goes away for 300ms and comes back with another phase
+            world::gapFrom = world::now();
+            world::gapTo = world::gapFrom + 300000 + std::uniform_real_distribution<double>(0, 1e6 / s.inRate)(world::rng);
+            resumed = world::gapTo;
+        }
+        world::watchExcursion = r >= 5;
+        loopFor(m, Attrs::lockInterval * 1000, r % 7 == 6 ? s.stallUs : 0);
+        if (!m.ready()) {
+            lockInit(m);
+        } else {
+            GBS::TEST_BUS_SEL::write(0x0);
+            if (m.run(m.clockGen ? 0xff : m.frameTimeLockMethod)) {
+                failed = 0;
+            } else if (++failed > 2) {
+                m.reset(m.frameTimeLockMethod);
+                failed = 0;
+            }
+        }
+        error[r] = world::phase() - Attrs::syncTargetPhase / 360.0;
+        error[r] -= error[r] > 0.5 ? 1 : 0;
+        at[r] = world::now();
+    }
+
+    Result result = {-1, 0, world::corrections, world::excursion};
+    for (uint16_t k = resetRun; k + LOCK_RUNS <= runs && result.lock < 0; k++) {
+        bool locked = true;
+        for (uint16_t i = k; i < k + LOCK_RUNS; i++) {
+            locked &= fabs(error[i]) < LOCK_WINDOW;
+        }
+        if (locked) {
+            result.lock = at[k] > resumed ? (at[k] - resumed) / 1e6 : 0;
+        }
+    }
+    uint16_t n = 0;
+    for (uint16_t i = resetRun > 60 ? resetRun - 60 : 0; i < resetRun; i++, n++) {
+        result.rms += error[i] * error[i];
+    }
+    result.rms = sqrt(result.rms / n);
+    return result;
+}
+
+static bool selected(const char *name, int argc, char **argv, int first)
+{
+    if (first >= argc) {
+        return true;
+    }
+    for (int i = first; i < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned seeds = 5;
+    int first = 1;
+    for (; first < argc && argv[first][0] == '-'; first++) {
+        if (strcmp(argv[first], "-v") == 0) {
+            verbose = true;
+        } else if (strcmp(argv[first], "-s") == 0 && first + 1 < argc) {
+            seeds = atoi(argv[++first]);
+        } else {
+            fprintf(stderr, "usage: %s [-v] [-s seeds] [method...]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (seeds == 0) {
+        seeds = 1;
+    }
+
+    bool partial = false;
+    printf("%-32s %-16s %8s %8s %12s %10s\n", "scenario", "method", "lock s", "rms fr", "corrections", "worst fps");
+    for (const world::Scenario &s : scenarios) {
+        for (const Method &m : methods) {
+            if (!selected(m.name, argc, argv, first)) {
+                continue;
+            }
+            double lock = 0, rms = 0, excursion = 0;
+            uint32_t corrections = 0;
+            unsigned locked = 0;
+            for (unsigned seed = 1; seed <= seeds; seed++) {
+                Result r = simulate(m, s, seed, 300);
+                if (r.lock >= 0) {
+                    lock += r.lock;
+                    locked++;
+                }
+                rms += r.rms;
+                corrections += r.corrections;
+                excursion = r.excursion > excursion ? r.excursion : excursion;
+            }
+            char lockText[16] = "-";
+            if (locked == seeds) {
+                snprintf(lockText, sizeof(lockText), "%.1f", lock / locked);
+            } else if (locked > 0) {
+                snprintf(lockText, sizeof(lockText), "%.1f*", lock / locked);
+            }
+            partial |= locked < seeds;
+            printf("%-32s %-16s %8s %8.4f %12u %9.4f%%\n", s.name, m.name, lockText, rms / seeds, corrections / seeds, excursion * 100);
+        }
+    }
+    if (partial) {
+        printf("* not every seed locked, - none\n");
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+// Built-in presets: the arrays presetgen.h expands from the timing
+// descriptors must be the bytes the hand written tables had, kept in
+// fixtures/.
+#include <stdio.h>
+
+#include "tv5725sim.h"
+
+#define PROGMEM
+
+#include "ntsc_240p.h"
+#include "ntsc_720x480.h"
+#include "ntsc_1280x720.h"
+#include "ntsc_1280x1024.h"
+#include "ntsc_1920x1080.h"
+#include "ntsc_downscale.h"
+#include "pal_240p.h"
+#include "pal_768x576.h"
+#include "pal_1280x720.h"
+#include "pal_1280x1024.h"
+#include "pal_1920x1080.h"
+#include "pal_downscale.h"
+
+#include "fixtures/ntsc_240p.h"
+#include "fixtures/ntsc_720x480.h"
+#include "fixtures/ntsc_1280x720.h"
+#include "fixtures/ntsc_1280x1024.h"
+#include "fixtures/ntsc_1920x1080.h"
+#include "fixtures/ntsc_downscale.h"
+#include "fixtures/pal_240p.h"
+#include "fixtures/pal_768x576.h"
+#include "fixtures/pal_1280x720.h"
+#include "fixtures/pal_1280x1024.h"
+#include "fixtures/pal_1920x1080.h"
+#include "fixtures/pal_downscale.h"
+
+#define PRESETS(X)  \
+    X(ntsc_240p)      \
+    X(ntsc_720x480)   \
+    X(ntsc_1280x720)  \
+    X(ntsc_1280x1024) \
+    X(ntsc_1920x1080) \
+    X(ntsc_downscale) \
+    X(pal_240p)       \
+    X(pal_768x576)    \
+    X(pal_1280x720)   \
+    X(pal_1280x1024)  \
+    X(pal_1920x1080)  \
+    X(pal_downscale)
+
+// first differing byte, -1 for none
+static int compare(const uint8_t *preset, size_t size, const uint8_t *fixture, size_t fixtureSize)
+{
+    if (size != fixtureSize) {
+        return size < fixtureSize ? size : fixtureSize;
+    }
+    for (size_t i = 0; i < size; i++) {
+        if (preset[i] != fixture[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int main()
+{
+    int failed = 0, total = 0;
+#define CHECK(name)                                                                                  \
+    {                                                                                                \
+        int at = compare(name, sizeof(name), name##_fixture, sizeof(name##_fixture));                \
+        total++;                                                                                     \
+        if (at >= 0) {                                                                               \
+            failed++;                                                                                \
+            printf("%s: differs from the fixture at byte %d (%zu bytes, fixture %zu)\n", #name, at, \
+                   sizeof(name), sizeof(name##_fixture));                                            \
+        }                                                                                            \
+    }
+    PRESETS(CHECK)
+#undef CHECK
+    printf("%d of %d presets equal to their fixtures\n", total - failed, total);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,99 @@
+// Bus traffic of hot register accesses (tw.h) with TV5725Sim counting.
+//
+// The shadow cache is off, so every access goes to the bus as it would
+// for volatile registers. "span read" is what reading the whole byte
+// range back (Tie::write before RegCover / CoverRuns) would cost, for
+// comparison with "bytes read". The last rows send a 432 byte preset the
+// way writeProgramArrayNew() does, bank by bank and recorded into a
+// GBS::Deferred, with the number of idle hook calls in between.
+#include <stdio.h>
+
+#include "tv5725sim.h"
+
+#define PROGMEM
+#include "ntsc_240p.h"
+
+typedef TV5725<GBS_ADDR> GBS;
+
+// as FrameSyncManager and gbs-control.cpp tie them
+typedef GBS::Tie<GBS::VDS_VSYNC_RST, GBS::VDS_VS_ST> VRST_SST;
+typedef GBS::Tie<GBS::VDS_VB_ST, GBS::VDS_VB_SP> VB_ST_SP;
+
+template <class... Regs>
+static uint8_t span()
+{
+    return tw::detail::RegRange<Regs...>::end - tw::detail::RegRange<Regs...>::start;
+}
+
+// Runs the access with the segment already selected, prints what it took
+template <class Access>
+static void measure(const char *label, uint8_t segment, uint8_t spanRead, Access access)
+{
+    GBS::read(segment, 0x00); // select the segment outside the count
+    TV5725Sim::resetStats();
+    access();
+    const TV5725Sim::Stats &s = TV5725Sim::stats();
+    printf("%-28s %6u %7u %11u %14u %10u\n", label, s.reads, s.writes, s.bytesRead, s.bytesWritten, spanRead);
+}
+
+static uint32_t idleCalls;
+
+static void countIdle()
+{
+    idleCalls++;
+}
+
+// the preset banks in writeProgramArrayNew() order
+static void writePreset(const uint8_t *preset)
+{
+    static const struct
+    {
+        uint8_t segment, start, end;
+    } ranges[] = {{0, 0x40, 0x60}, {0, 0x90, 0xa0}, {1, 0x00, 0x30}, {3, 0x00, 0x80}, {4, 0x00, 0x60}, {5, 0x00, 0x70}};
+    for (auto &r : ranges) {
+        for (uint8_t pos = r.start; pos < r.end; pos += 16, preset += 16) {
+            GBS::write(r.segment, pos, preset, 16);
+        }
+    }
+}
+
+int main()
+{
+    TV5725Sim::reset(GBS_ADDR);
+    GBS::shadowEnable(false);
+    uint16_t a, b;
+
+    printf("%-28s %6s %7s %11s %14s %10s\n", "access", "reads", "writes", "bytes read", "bytes written", "span read");
+    measure("VRST_SST::write", 3, span<GBS::VDS_VSYNC_RST, GBS::VDS_VS_ST>(), [] { VRST_SST::write(1000, 1); });
+    measure("VRST_SST::read", 3, 0, [&] { VRST_SST::read(a, b); });
+    measure("VB_ST_SP::write", 3, span<GBS::VDS_VB_ST, GBS::VDS_VB_SP>(), [] { VB_ST_SP::write(24, 26); });
+    measure("VDS_VS_ST::write", 3, span<GBS::VDS_VS_ST>(), [] { GBS::VDS_VS_ST::write(1); });
+    measure("VDS_VSYNC_RST::write", 3, span<GBS::VDS_VSYNC_RST>(), [] { GBS::VDS_VSYNC_RST::write(1000); });
+    measure("VDS_HSYNC_RST::write", 3, span<GBS::VDS_HSYNC_RST>(), [] { GBS::VDS_HSYNC_RST::write(2704); });
+    measure("VDS_HSYNC_RST::read", 3, 0, [] { GBS::VDS_HSYNC_RST::read(); });
+    measure("TEST_BUS_SEL::write", 0, span<GBS::TEST_BUS_SEL>(), [] { GBS::TEST_BUS_SEL::write(0x2); });
+    measure("PLL648_CONTROL_01::write", 0, span<GBS::PLL648_CONTROL_01>(), [] { GBS::PLL648_CONTROL_01::write(0x75); });
+    measure("STATUS_VDS_FIELD::read", 0, 0, [] { GBS::STATUS_VDS_FIELD::read(); });
+
+    GBS::setIdleHook(countIdle);
+    printf("\n%-28s %6s %7s %11s %14s %10s\n", "preset", "reads", "writes", "bytes read", "bytes written", "idle calls");
+    const char *labels[] = {"bank by bank", "GBS::Deferred + flush()"};
+    for (uint8_t deferred = 0; deferred < 2; deferred++) {
+        GBS::shadowEnable(true);
+        GBS::read(0, 0x00);
+        TV5725Sim::resetStats();
+        idleCalls = 0;
+        if (deferred) {
+            {
+                GBS::Deferred program;
+                writePreset(ntsc_240p);
+            }
+            GBS::flush();
+        } else {
+            writePreset(ntsc_240p);
+        }
+        const TV5725Sim::Stats &s = TV5725Sim::stats();
+        printf("%-28s %6u %7u %11u %14u %10u\n", labels[deferred], s.reads, s.writes, s.bytesRead, s.bytesWritten, idleCalls);
+    }
+    return 0;
+}
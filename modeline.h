@@ -0,0 +1,217 @@
+#ifndef _MODELINE_H_
+#define _MODELINE_H_
+// MODELINES
+// Output timings for a display's native mode, as an X11 style modeline
+// (positions in pixels / lines of the mode, sync start and end counted
+// from the start of the active area). modelineToVds() converts one into
+// VDS timing: the display clock is one of the PLL648 clocks, the mode's
+// line and frame period are kept and all horizontal positions are scaled
+// from mode pixels to display clocks.
+#define MODELINE_ID_CVT_RB 0 // no table entry, CVT reduced blanking from width / height / refresh
+#define MODELINE_ID_DMT 0x80 // ids below are CEA-861 VICs, from here on 0x80 + VESA DMT id
+#define MODELINE_HSYNC_POS 0x01
+#define MODELINE_VSYNC_POS 0x02
+#define MODELINE_HTOTAL_MAX 2704 // display clocks, the longest line a built-in preset uses
+#define MODELINE_HSYNC_ORIGIN 16 // display clock the output hsync starts on, as in most presets
+#define MODELINE_VSYNC_ORIGIN 1  // line the output vsync starts on
+
+typedef struct
+{
+    uint8_t id;
+    uint8_t flags;  // MODELINE_HSYNC_POS, MODELINE_VSYNC_POS
+    uint32_t clock; // kHz
+    uint16_t hActive, hSyncStart, hSyncEnd, hTotal;
+    uint16_t vActive, vSyncStart, vSyncEnd, vTotal;
+} Modeline;
+
+static const Modeline modelineTable[] PROGMEM = {
+    {1, 0, 25175, 640, 656, 752, 800, 480, 490, 492, 525},
+    {2, 0, 27000, 720, 736, 798, 858, 480, 489, 495, 525},
+    {4, MODELINE_HSYNC_POS | MODELINE_VSYNC_POS, 74250, 1280, 1390, 1430, 1650, 720, 725, 730, 750},
+    {16, MODELINE_HSYNC_POS | MODELINE_VSYNC_POS, 148500, 1920, 2008, 2052, 2200, 1080, 1084, 1089, 1125},
+    {17, 0, 27000, 720, 732, 796, 864, 576, 581, 586, 625},
+    {19, MODELINE_HSYNC_POS | MODELINE_VSYNC_POS, 74250, 1280, 1720, 1760, 1980, 720, 725, 730, 750},
+    {31, MODELINE_HSYNC_POS | MODELINE_VSYNC_POS, 148500, 1920, 2448, 2492, 2640, 1080, 1084, 1089, 1125},
+    {MODELINE_ID_DMT + 0x10, 0, 65000, 1024, 1048, 1184, 1344, 768, 771, 777, 806},
+    {MODELINE_ID_DMT + 0x20, MODELINE_HSYNC_POS | MODELINE_VSYNC_POS, 108000, 1280, 1376, 1488, 1800, 960, 961, 964, 1000},
+    {MODELINE_ID_DMT + 0x23, MODELINE_HSYNC_POS | MODELINE_VSYNC_POS, 108000, 1280, 1328, 1440, 1688, 1024, 1025, 1028, 1066},
+    {MODELINE_ID_DMT + 0x27, MODELINE_HSYNC_POS | MODELINE_VSYNC_POS, 85500, 1360, 1424, 1536, 1792, 768, 771, 777, 795},
+    {MODELINE_ID_DMT + 0x33, MODELINE_HSYNC_POS | MODELINE_VSYNC_POS, 162000, 1600, 1664, 1856, 2160, 1200, 1201, 1204, 1250},
+};
+static const uint8_t modelineTableCount = sizeof(modelineTable) / sizeof(modelineTable[0]);
+
+// Looks up a CEA / DMT timing, returns false for unknown ids
+static inline bool modelineFromTable(uint8_t id, Modeline *mode)
+{
+    for (uint8_t i = 0; i < modelineTableCount; i++) {
+        memcpy_P(mode, &modelineTable[i], sizeof(Modeline));
+        if (mode->id == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// VESA CVT 1.1 reduced blanking timing for width x height at refresh Hz,
+// returns false if there is none
+static inline bool modelineCvtRb(uint16_t width, uint16_t height, uint8_t refresh, Modeline *mode)
+{
+    if (width < 320 || height < 200 || refresh < 24) {
+        return false;
+    }
+    // vsync width tells the aspect ratio
+    uint8_t vSync = 10;
+    if (height * 4 == width * 3) {
+        vSync = 4;
+    } else if (height * 16 == width * 9) {
+        vSync = 5;
+    } else if (height * 16 == width * 10) {
+        vSync = 6;
+    } else if (height * 5 == width * 4 || height * 15 == width * 9) {
+        vSync = 7;
+    }
+    const float minVblank = 460.0f; // us
+    float hPeriod = (1000000.0f / refresh - minVblank) / height;
+    if (hPeriod <= 0.0f) {
+        return false;
+    }
+    uint16_t vblank = (uint16_t)(minVblank / hPeriod) + 1;
+    if (vblank < 3 + vSync + 6) {
+        vblank = 3 + vSync + 6; // front porch, sync, minimum back porch
+    }
+    mode->id = MODELINE_ID_CVT_RB;
+    mode->flags = MODELINE_HSYNC_POS;
+    mode->hActive = width & ~7;
+    mode->hSyncStart = mode->hActive + 48;
+    mode->hSyncEnd = mode->hSyncStart + 32;
+    mode->hTotal = mode->hActive + 160;
+    mode->vActive = height;
+    mode->vSyncStart = height + 3;
+    mode->vSyncEnd = mode->vSyncStart + vSync;
+    mode->vTotal = height + vblank;
+    // in steps of 250 kHz
+    mode->clock = (uint32_t)((float)refresh * mode->vTotal * mode->hTotal / 250000.0f) * 250;
+    return true;
+}
+
+typedef struct
+{
+    uint8_t displayClock; // PLL648_CONTROL_01
+    uint32_t clock;       // Hz
+    uint16_t htotal, hsyncStart, hsyncStop, hblankStart, hblankStop; // display clocks, hblank as VDS_DIS_HB
+    uint16_t vtotal, vsyncStart, vsyncStop, vblankStart, vblankStop; // lines, vblank as VDS_DIS_VB
+} VdsTiming;
+
+// PLL648 display clocks and their PLL648_CONTROL_01 settings
+static const uint8_t modelineDisplayClocks[] PROGMEM = {0xa5, 0x95, 0x85, 0x65, 0x55, 0x45, 0x25};
+static const uint32_t modelineDisplayClockHz[] PROGMEM = {162000000, 129600000, 108000000, 81000000, 64800000, 54000000, 40500000};
+
+// position + length, wrapped into a line / frame of total
+static inline uint16_t modelineWrap(uint32_t position, uint16_t total)
+{
+    return position > total ? position % total : position;
+}
+
+// Sets displayClock, clock and htotal for lines at lineRate (mHz): the
+// fastest display clock that keeps the line within MODELINE_HTOTAL_MAX.
+// Returns false if the line is too long even for the slowest one.
+static inline bool modelineDisplayClock(uint64_t lineRate, VdsTiming *vds)
+{
+    for (uint8_t i = 0; lineRate > 0 && i < sizeof(modelineDisplayClocks); i++) {
+        uint32_t clock = pgm_read_dword(&modelineDisplayClockHz[i]);
+        uint32_t htotal = ((uint64_t)clock * 1000 + lineRate / 2) / lineRate;
+        if (htotal <= MODELINE_HTOTAL_MAX) {
+            vds->displayClock = pgm_read_byte(&modelineDisplayClocks[i]);
+            vds->clock = clock;
+            vds->htotal = htotal;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Output timing for mode, sync starting at the ORIGINs. Sync polarity is
+// expressed the VDS way, a negative sync starts after it stops.
+// Returns false if the mode can't be made.
+static inline bool modelineToVds(const Modeline &mode, VdsTiming *vds)
+{
+    if (mode.hTotal == 0 || mode.vTotal == 0 || mode.clock == 0 || mode.vTotal > 2047 ||
+        mode.hSyncEnd > mode.hTotal || mode.vSyncEnd > mode.vTotal) {
+        return false;
+    }
+    // line rate in mHz, to keep the precision
+    if (!modelineDisplayClock((uint64_t)mode.clock * 1000000 / mode.hTotal, vds)) {
+        return false;
+    }
+
+    // mode pixels to display clocks
+    float k = (float)vds->htotal / mode.hTotal;
+    uint16_t hSync = (mode.hSyncEnd - mode.hSyncStart) * k + 0.5f;
+    uint16_t hBack = (mode.hTotal - mode.hSyncStart) * k + 0.5f; // sync and back porch
+    uint16_t hActive = mode.hActive * k + 0.5f;
+    uint16_t hsyncStop = MODELINE_HSYNC_ORIGIN + (hSync > 0 ? hSync : 1);
+    vds->hsyncStart = MODELINE_HSYNC_ORIGIN;
+    vds->hsyncStop = hsyncStop;
+    if (!(mode.flags & MODELINE_HSYNC_POS)) {
+        vds->hsyncStart = hsyncStop;
+        vds->hsyncStop = MODELINE_HSYNC_ORIGIN;
+    }
+    vds->hblankStop = modelineWrap(MODELINE_HSYNC_ORIGIN + hBack, vds->htotal);
+    vds->hblankStart = modelineWrap(MODELINE_HSYNC_ORIGIN + hBack + hActive, vds->htotal);
+
+    uint16_t vSync = mode.vSyncEnd - mode.vSyncStart;
+    uint16_t vsyncStop = MODELINE_VSYNC_ORIGIN + (vSync > 0 ? vSync : 1);
+    vds->vtotal = mode.vTotal;
+    vds->vsyncStart = MODELINE_VSYNC_ORIGIN;
+    vds->vsyncStop = vsyncStop;
+    if (!(mode.flags & MODELINE_VSYNC_POS)) {
+        vds->vsyncStart = vsyncStop;
+        vds->vsyncStop = MODELINE_VSYNC_ORIGIN;
+    }
+    vds->vblankStop = modelineWrap(MODELINE_VSYNC_ORIGIN + mode.vTotal - mode.vSyncStart, mode.vTotal);
+    vds->vblankStart = modelineWrap(MODELINE_VSYNC_ORIGIN + mode.vTotal - mode.vSyncStart + mode.vActive, mode.vTotal);
+    return true;
+}
+
+// VDS_HSCALE / VDS_VSCALE for an active area of newActive that shows what
+// scale did over oldActive. The VDS can't scale down, 1023 is as far as it goes.
+static inline uint16_t modelineScale(uint16_t scale, uint16_t oldActive, uint16_t newActive)
+{
+    uint32_t newScale = ((uint32_t)scale * oldActive + newActive / 2) / newActive;
+    return newScale > 1023 ? 1023 : newScale;
+}
+
+// INTEGER SCALING
+// Each source line becomes factor output lines, each VDS input pixel a
+// whole number of display clocks. SD sources reach the VDS line doubled,
+// so VDS_VSCALE is 2048 / factor: exact for 2 (scaler bypassed), 4 and 8,
+// the nearest the 10 bits allow for the others.
+#define INTEGER_SCALE_MIN_BLANK 64 // display clocks per line left for blanking and sync
+
+static inline uint16_t integerScaleVscale(uint8_t factor)
+{
+    return (2048 + factor / 2) / factor;
+}
+
+static inline uint16_t integerScaleHscale(uint8_t clocks)
+{
+    return (1024 + clocks / 2) / clocks;
+}
+
+// Display clocks per VDS input pixel closest to what hscale does, at least 1
+static inline uint8_t integerScaleClocksPerPixel(uint16_t hscale)
+{
+    uint8_t clocks = (1024 + hscale / 2) / hscale;
+    return clocks > 0 ? clocks : 1;
+}
+
+// Blanking stop for an active area of newActive in a line / frame of
+// newTotal, leaving the picture where it was in the blanking
+static inline uint16_t integerScalePlace(uint16_t stop, uint16_t active, uint16_t total, uint16_t newActive, uint16_t newTotal)
+{
+    if (active >= total || stop > total - active) {
+        return (newTotal - newActive) / 2;
+    }
+    return (uint32_t)stop * (newTotal - newActive) / (total - active);
+}
+#endif
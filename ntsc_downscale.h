@@ -1,434 +1,101 @@
-const uint8_t ntsc_downscale[] PROGMEM = {
-    0x7C, // s0_40
-    0x25, // s0_41
-    0x0,  // s0_42
-    0x19, // s0_43
-    0x25, // s0_44
-    0x11, // s0_45
-    0x7F, // s0_46
-    0x17, // s0_47
-    0xEB, // s0_48
-    0xA,  // s0_49
-    0x0,  // s0_4A
-    0x0,  // s0_4B
-    0x0,  // s0_4C
-    0x2A, // s0_4D
-    0x0,  // s0_4E
-    0x3C, // s0_4F
-    0x0,  // s0_50
-    0x0,  // s0_51
-    0x67, // s0_52
-    0x0,  // s0_53
-    0x0,  // s0_54
-    0x0,  // s0_55
-    0x0,  // s0_56
-    0x0,  // s0_57
-    0x0,  // s0_58
-    0xFF, // s0_59
-    0x0,  // s0_5A
-    0x0,  // s0_5B
-    0x0,  // s0_5C
-    0x0,  // s0_5D
-    0x0,  // s0_5E
-    0x0,  // s0_5F
-    0x24, // s0_90
-    0x0,  // s0_91
-    0x47, // s0_92
-    0xD4, // s0_93
-    0x0,  // s0_94
-    0x3E, // s0_95
-    0x32, // s0_96
-    0x0,  // s0_97
-    0x0,  // s0_98
-    0x0,  // s0_99
-    0x0,  // s0_9A
-    0x0,  // s0_9B
-    0x0,  // s0_9C
-    0x0,  // s0_9D
-    0x0,  // s0_9E
-    0x0,  // s0_9F
-    0x62, // s1_0
-    0xE0, // s1_1
-    0x69, // s1_2
-    0x0,  // s1_3
-    0x0,  // s1_4
-    0x0,  // s1_5
-    0x0,  // s1_6
-    0x0,  // s1_7
-    0x0,  // s1_8
-    0x0,  // s1_9
-    0x0,  // s1_A
-    0xC0, // s1_B
-    0x7,  // s1_C
-    0x0,  // s1_D
-    0xFF, // s1_E
-    0x4,  // s1_F
-    0x0,  // s1_10
-    0x0,  // s1_11
-    0x88, // s1_12
-    0x0,  // s1_13
-    0x48, // s1_14
-    0x4,  // s1_15
-    0x4C, // s1_16
-    0x0,  // s1_17
-    0xB0, // s1_18
-    0x4,  // s1_19
-    0xB8, // s1_1A
-    0x0,  // s1_1B
-    0xE,  // s1_1C
-    0x0,  // s1_1D
-    0x10, // s1_1E
-    0x0,  // s1_1F
-    0x40, // s1_20
-    0x0,  // s1_21
-    0x40, // s1_22
-    0x5,  // s1_23
-    0x0,  // s1_24
-    0x0,  // s1_25
-    0x60, // s1_26
-    0x0,  // s1_27
-    0x3E, // s1_28
-    0x0,  // s1_29
-    0x0,  // s1_2A
-    0x6,  // s1_2B
-    0x0,  // s1_2C
-    0x25, // s1_2D
-    0x0,  // s1_2E
-    0x0,  // s1_2F
-    0x22, // s3_0
-    0xFE, // s3_1
-    0x79, // s3_2
-    0x10, // s3_3
-    0x32, // s3_4
-    0x49, // s3_5
-    0x14, // s3_6
-    0xA,  // s3_7
-    0xC0, // s3_8
-    0x0,  // s3_9
-    0xA0, // s3_A
-    0x80, // s3_B
-    0x0,  // s3_C
-    0x5,  // s3_D
-    0x10, // s3_E
-    0x0,  // s3_F
-    0x72, // s3_10
-    0x89, // s3_11
-    0x1B, // s3_12
-    0x4,  // s3_13
-    0x1,  // s3_14
-    0x1,  // s3_15
-    0x0,  // s3_16
-    0x2,  // s3_17
-    0x20, // s3_18
-    0x4,  // s3_19
-    0x0,  // s3_1A
-    0x1,  // s3_1B
-    0x0,  // s3_1C
-    0x0,  // s3_1D
-    0x0,  // s3_1E
-    0x1,  // s3_1F
-    0x9,  // s3_20
-    0x1,  // s3_21
-    0x9,  // s3_22
-    0x1,  // s3_23
-    0xA0, // s3_24
-    0x3,  // s3_25
-    0x40, // s3_26
-    0xCF, // s3_27
-    0x26, // s3_28
-    0x7,  // s3_29
-    0x11, // s3_2A
-    0x11, // s3_2B
-    0xE0, // s3_2C
-    0x2F, // s3_2D
-    0x20, // s3_2E
-    0xF0, // s3_2F
-    0x40, // s3_30
-    0x3A, // s3_31
-    0x88, // s3_32
-    0x0,  // s3_33
-    0x0,  // s3_34
-    0x80, // s3_35
-    0x1C, // s3_36
-    0x29, // s3_37
-    0x0,  // s3_38
-    0x0,  // s3_39
-    0xFE, // s3_3A
-    0x3,  // s3_3B
-    0x3,  // s3_3C
-    0x0,  // s3_3D
-    0x80, // s3_3E
-    0x0,  // s3_3F
-    0x3,  // s3_40
-    0x3,  // s3_41
-    0x40, // s3_42
-    0xC,  // s3_43
-    0xF8, // s3_44
-    0x16, // s3_45
-    0xF8, // s3_46
-    0x18, // s3_47
-    0xF9, // s3_48
-    0x10, // s3_49
-    0xF9, // s3_4A
-    0x20, // s3_4B
-    0xF9, // s3_4C
-    0xA,  // s3_4D
-    0x1A, // s3_4E
-    0x1E, // s3_4F
-    0x30, // s3_50
-    0x0,  // s3_51
-    0x70, // s3_52
-    0x8,  // s3_53
-    0x24, // s3_54
-    0xA,  // s3_55
-    0x8B, // s3_56
-    0x0,  // s3_57
-    0x1A, // s3_58
-    0x0,  // s3_59
-    0x0,  // s3_5A
-    0x1A, // s3_5B
-    0x0,  // s3_5C
-    0xC4, // s3_5D
-    0x3F, // s3_5E
-    0x4,  // s3_5F
-    0x4,  // s3_60
-    0x9B, // s3_61
-    0x80, // s3_62
-    0x9,  // s3_63
-    0xE9, // s3_64
-    0xFF, // s3_65
-    0x7F, // s3_66
-    0x40, // s3_67
-    0xD2, // s3_68
-    0xD,  // s3_69
-    0xD8, // s3_6A
-    0xFF, // s3_6B
-    0x3F, // s3_6C
-    0xDA, // s3_6D
-    0x49, // s3_6E
-    0x1F, // s3_6F
-    0x5,  // s3_70
-    0xC9, // s3_71
-    0x0,  // s3_72
-    0xBC, // s3_73
-    0x5,  // s3_74
-    0x0,  // s3_75
-    0x0,  // s3_76
-    0x0,  // s3_77
-    0x0,  // s3_78
-    0x0,  // s3_79
-    0x0,  // s3_7A
-    0x0,  // s3_7B
-    0x0,  // s3_7C
-    0x0,  // s3_7D
-    0x0,  // s3_7E
-    0x0,  // s3_7F
-    0x82, // s4_0
-    0x30, // s4_1
-    0x0,  // s4_2
-    0x0,  // s4_3
-    0x30, // s4_4
-    0x11, // s4_5
-    0x42, // s4_6
-    0x30, // s4_7
-    0x1,  // s4_8
-    0x94, // s4_9
-    0x11, // s4_A
-    0x7F, // s4_B
-    0x0,  // s4_C
-    0x74, // s4_D
-    0x0,  // s4_E
-    0x6,  // s4_F
-    0x0,  // s4_10
-    0x92, // s4_11
-    0x5,  // s4_12
-    0x1,  // s4_13
-    0x96, // s4_14
-    0x5,  // s4_15
-    0x0,  // s4_16
-    0x0,  // s4_17
-    0x4,  // s4_18
-    0x0,  // s4_19
-    0x50, // s4_1A
-    0x21, // s4_1B
-    0x0,  // s4_1C
-    0x0,  // s4_1D
-    0x0,  // s4_1E
-    0x0,  // s4_1F
-    0x0,  // s4_20
-    0x43, // s4_21
-    0x2,  // s4_22
-    0x8,  // s4_23
-    0x0,  // s4_24
-    0x18, // s4_25
-    0x11, // s4_26
-    0xFF, // s4_27
-    0xFF, // s4_28
-    0x1F, // s4_29
-    0x0,  // s4_2A
-    0x87, // s4_2B
-    0x18, // s4_2C
-    0x3A, // s4_2D
-    0x0,  // s4_2E
-    0x0,  // s4_2F
-    0x0,  // s4_30
-    0x0,  // s4_31
-    0x0,  // s4_32
-    0xC,  // s4_33
-    0x0,  // s4_34
-    0x0,  // s4_35
-    0xC,  // s4_36
-    0x4,  // s4_37
-    0x1,  // s4_38
-    0x0,  // s4_39
-    0x1,  // s4_3A
-    0x0,  // s4_3B
-    0x0,  // s4_3C
-    0x0,  // s4_3D
-    0x3,  // s4_3E
-    0x0,  // s4_3F
-    0x0,  // s4_40
-    0x0,  // s4_41
-    0x6E, // s4_42
-    0x0,  // s4_43
-    0x0,  // s4_44
-    0xD0, // s4_45
-    0x4,  // s4_46
-    0x0,  // s4_47
-    0xD0, // s4_48
-    0x4,  // s4_49
-    0x0,  // s4_4A
-    0x14, // s4_4B
-    0x0,  // s4_4C
-    0x70, // s4_4D
-    0x24, // s4_4E
-    0x32, // s4_4F
-    0x0,  // s4_50
-    0x0,  // s4_51
-    0x0,  // s4_52
-    0x0,  // s4_53
-    0x1,  // s4_54
-    0x0,  // s4_55
-    0x0,  // s4_56
-    0x0,  // s4_57
-    0x0,  // s4_58
-    0x1,  // s4_59
-    0x0,  // s4_5A
-    0xCC, // s4_5B
-    0x0,  // s4_5C
-    0x0,  // s4_5D
-    0x0,  // s4_5E
-    0x0,  // s4_5F
-    0x10, // s5_0
-    0x0,  // s5_1
-    0x1D, // s5_2
-    0x3B, // s5_3
-    0x2,  // s5_4
-    0x2,  // s5_5
-    0x43, // s5_6
-    0x42, // s5_7
-    0x42, // s5_8
-    0x7B, // s5_9
-    0x7B, // s5_A
-    0x7B, // s5_B
-    0x12, // s5_C
-    0x0,  // s5_D
-    0x82, // s5_E
-    0x0,  // s5_F
-    0x0,  // s5_10
-    0xB2, // s5_11
-    0xFF, // s5_12
-    0x9,  // s5_13
-    0x0,  // s5_14
-    0x0,  // s5_15
-    0x5F, // s5_16
-    0x6,  // s5_17
-    0xA1, // s5_18
-    0x93, // s5_19
-    0x0,  // s5_1A
-    0x0,  // s5_1B
-    0x0,  // s5_1C
-    0x0,  // s5_1D
-    0x80, // s5_1E
-    0x85, // s5_1F
-    0x8,  // s5_20
-    0x18, // s5_21
-    0xF,  // s5_22
-    0x0,  // s5_23
-    0x40, // s5_24
-    0x0,  // s5_25
-    0x4,  // s5_26
-    0x0,  // s5_27
-    0x0,  // s5_28
-    0x0,  // s5_29
-    0xF,  // s5_2A
-    0x0,  // s5_2B
-    0x0,  // s5_2C
-    0x3,  // s5_2D
-    0x0,  // s5_2E
-    0x2,  // s5_2F
-    0x0,  // s5_30
-    0x2F, // s5_31
-    0x0,  // s5_32
-    0x3A, // s5_33
-    0x6,  // s5_34
-    0xA0, // s5_35
-    0x0,  // s5_36
-    0xE,  // s5_37
-    0x7,  // s5_38
-    0x6,  // s5_39
-    0x3,  // s5_3A
-    0x0,  // s5_3B
-    0x0,  // s5_3C
-    0x0,  // s5_3D
-    0x0,  // s5_3E
-    0x4,  // s5_3F
-    0x1,  // s5_40
-    0x14, // s5_41
-    0x0,  // s5_42
-    0x27, // s5_43
-    0x0,  // s5_44
-    0x10, // s5_45
-    0x0,  // s5_46
-    0x0,  // s5_47
-    0x0,  // s5_48
-    0x0,  // s5_49
-    0x0,  // s5_4A
-    0x84, // s5_4B
-    0x8,  // s5_4C
-    0x10, // s5_4D
-    0x0,  // s5_4E
-    0x3C, // s5_4F
-    0x3,  // s5_50
-    0x2,  // s5_51
-    0x0,  // s5_52
-    0x0,  // s5_53
-    0x0,  // s5_54
-    0x0,  // s5_55
-    0x1,  // s5_56
-    0xC0, // s5_57
-    0x5,  // s5_58
-    0x0,  // s5_59
-    0x1,  // s5_5A
-    0x0,  // s5_5B
-    0x3,  // s5_5C
-    0x2,  // s5_5D
-    0x0,  // s5_5E
-    0x0,  // s5_5F
-    0x0,  // s5_60
-    0x0,  // s5_61
-    0x0,  // s5_62
-    0xF,  // s5_63
-    0x0,  // s5_64
-    0x0,  // s5_65
-    0x0,  // s5_66
-    0x0,  // s5_67
-    0x0,  // s5_68
-    0x0,  // s5_69
-    0x0,  // s5_6A
-    0x0,  // s5_6B
-    0x0,  // s5_6C
-    0x0,  // s5_6D
-    0x0,  // s5_6E
-    0x0,  // s5_6F
+#include "presetgen.h"
+
+// 60Hz sources, downscale output
+struct ntsc_downscale_timing : presetgen::Timing
+{
+    static constexpr uint8_t presetId = 0x06;
+    static constexpr uint8_t displayClock = 0x25;
+    static constexpr uint16_t adcClock = 2559;
+    static constexpr uint16_t inputHtotal = 1279;
+    static constexpr uint16_t inputHblankStart = 0;
+    static constexpr uint16_t inputHblankStop = 136;
+    static constexpr uint16_t inputVblankStart = 14;
+    static constexpr uint16_t inputVblankStop = 16;
+    static constexpr uint16_t inputLineStop = 1344;
+    static constexpr uint16_t htotal = 2558;
+    static constexpr uint16_t vtotal = 263;
+    static constexpr uint16_t hsyncStart = 160;
+    static constexpr uint16_t hsyncStop = 8;
+    static constexpr uint16_t vsyncStart = 5;
+    static constexpr uint16_t vsyncStop = 1;
+    static constexpr uint16_t hblankStart = 2354;
+    static constexpr uint16_t hblankStop = 324;
+    static constexpr uint16_t vblankStart = 10;
+    static constexpr uint16_t vblankStop = 12;
+    static constexpr uint16_t displayHblankStart = 2418;
+    static constexpr uint16_t displayHblankStop = 440;
+    static constexpr uint16_t displayVblankStart = 260;
+    static constexpr uint16_t displayVblankStop = 16;
+    static constexpr uint16_t hscale = 512;
+    static constexpr uint16_t vscale = 512;
+    static constexpr uint8_t hscaleBypass = 0;
+    static constexpr uint8_t vscaleBypass = 1;
 };
+
+typedef presetgen::Preset<
+    ntsc_downscale_timing,
+    presetgen::Field<GBS::DAC_RGBS_SPD, 0>,
+    presetgen::Field<GBS::DAC_RGBS_S0ENZ, 0>,
+    presetgen::Field<GBS::DAC_RGBS_S1EN, 1>,
+    presetgen::Field<GBS::PAD_CKIN_ENZ, 0>,
+    presetgen::Field<GBS::OSD_MENU_EN, 0>,
+    presetgen::Field<GBS::IF_VS_SEL, 1>,
+    presetgen::Field<GBS::IF_PRGRSV_CNTRL, 1>,
+    presetgen::Field<GBS::IF_VS_FLIP, 0>,
+    presetgen::Field<GBS::IF_SEL_WEN, 1>,
+    presetgen::Field<GBS::IF_HS_SEL_LPF, 0>,
+    presetgen::Field<GBS::IF_LD_SEL_PROV, 1>,
+    presetgen::Field<GBS::IF_LD_RAM_BYPS, 1>,
+    presetgen::Field<GBS::VDS_D_RAM_BYPS, 1>,
+    presetgen::Field<GBS::ADC_RYSEL_R, 1>,
+    presetgen::Field<GBS::ADC_RYSEL_B, 1>,
+    presetgen::Field<GBS::DEC_MATRIX_BYPS, 1>,
+    presetgen::Field<GBS::SP_EXT_SYNC_SEL, 1>,
+    presetgen::Field<GBS::SP_CLAMP_MANUAL, 0>,
+    presetgen::Field<GBS::OSD_VERTICAL_ZOOM, 2>,
+    presetgen::Field<GBS::IF_HS_DEC_FACTOR, 0>,
+    presetgen::Field<GBS::ADC_INPUT_SEL, 0>,
+    presetgen::Field<GBS::PLLAD_KS, 1>,
+    presetgen::Field<GBS::OSD_HORIZONTAL_ZOOM, 2>,
+    presetgen::Field<GBS::OSD_MENU_BAR_FONT_FORCOR, 7>,
+    presetgen::Field<GBS::OSD_MENU_BAR_FONT_BGCOR, 0>,
+    presetgen::Field<GBS::OSD_MENU_BAR_BORD_COR, 1>,
+    presetgen::Field<GBS::OSD_MENU_SEL_BGCOR, 5>,
+    presetgen::Field<GBS::MEM_CLK_DLY_REG, 2>,
+    presetgen::Field<GBS::ADC_SOGCTRL, 0xE>,
+    presetgen::Field<GBS::PA_SP_S, 9>,
+    presetgen::Field<GBS::OSD_MENU_HORI_START, 0x3E>,
+    presetgen::Field<GBS::OSD_MENU_VER_START, 0x32>,
+    presetgen::Field<GBS::GBS_PRESET_DISPLAY_CLOCK, 0x25>,
+    presetgen::Field<GBS::VDS_Y_OFST, 0xFE>,
+    presetgen::Field<GBS::VDS_U_OFST, 3>,
+    presetgen::Field<GBS::VDS_V_OFST, 3>,
+    presetgen::Field<GBS::PB_GENERAL_FLAG_REG, 0x3A>,
+    presetgen::Field<GBS::ADC_ROFCTRL, 0x43>,
+    presetgen::Field<GBS::ADC_GOFCTRL, 0x42>,
+    presetgen::Field<GBS::ADC_BOFCTRL, 0x42>,
+    presetgen::Field<GBS::SP_H_PULSE_IGNOR, 0xE>,
+    presetgen::Field<GBS::SP_PRE_COAST, 7>,
+    presetgen::Field<GBS::SP_POST_COAST, 6>,
+    presetgen::Field<GBS::PB_CAP_OFFSET, 0x104>,
+    presetgen::Field<GBS::IF_HB_ST2, 0x4B0>,
+    presetgen::Field<GBS::IF_HB_SP2, 0xB8>,
+    presetgen::Field<GBS::VDS_VSYN_SIZE1, 0x109>,
+    presetgen::Field<GBS::VDS_VSYN_SIZE2, 0x109>,
+    presetgen::Field<GBS::VDS_EXT_VB_ST, 0x105>,
+    presetgen::Field<GBS::VDS_EXT_VB_SP, 0xC>,
+    presetgen::Field<GBS::IF_HBIN_SP, 0x60>,
+    presetgen::Field<GBS::VDS_EXT_HB_ST, 0x9DA>,
+    presetgen::Field<GBS::VDS_EXT_HB_SP, 0x1F4>,
+    presetgen::Field<GBS::SP_DLT_REG, 0xA0>,
+    presetgen::Field<GBS::SP_CS_CLP_ST, 0x14>,
+    presetgen::Field<GBS::SP_CS_CLP_SP, 0x27>,
+    presetgen::Field<GBS::SP_H_CST_SP, 0x33C>,
+    presetgen::Field<GBS::CAP_SAFE_GUARD_A, 0x111800>,
+    presetgen::Raw<0x01, 0x14, 0x48>,
+    presetgen::Raw<0x04, 0x18, 0x04>,
+    presetgen::Raw<0x04, 0x42, 0x6E>,
+    presetgen::Raw<0x04, 0x4F, 0x32>>
+    ntsc_downscale_gen;
+
+constexpr uint8_t ntsc_downscale[] PROGMEM = {PRESET_BYTES(ntsc_downscale_gen)};
@@ -1,4 +1,5 @@
 #ifndef _USER_H_
+#define _USER_H_
 using Ascii8 = uint8_t;
 /// Output resolution requested by user, *given to* applyPresets().
 enum PresetPreference : uint8_t {
@@ -9,33 +10,63 @@ enum PresetPreference : uint8_t {
     Output1024P = 4,
     Output1080P = 5,
     OutputDownscale = 6,
+    OutputModeline = 7, // native display mode, see modeline.h
     OutputBypass = 10,
 };
 
+#define PREFS_FILE "/preferences.bin"
+#define PREFS_FILE_TMP "/preferences.tmp"
+#define PREFS_FILE_V2 "/preferencesv2.txt" // text format before PREFS_FILE
+#define PREFS_QUIET_PERIOD 3000 // ms without changes before saveUserPrefs() reaches the flash
+
+// USER OPTIONS SCHEMA
+// X(type, name, id, default, max) for each userOptions member. The id
+// identifies the option in PREFS_FILE: never renumber or reuse one, a new
+// option takes the next free id. Values above max load as the default.
+// ids 1 - 19 are the positions in PREFS_FILE_V2.
+#define USER_OPTIONS(X)                                                                  \
+    /* 0 - normal, 1 - x480/x576, 2 - customized, 3 - 1280x720, 4 - 1280x1024, */        \
+    /* 5 - 1920x1080, 6 - downscale, 7 - modeline, 10 - bypass */                        \
+    X(PresetPreference, presetPreference, 1, Output960P, 10)                             \
+    X(Ascii8, presetSlot, 3, 'A', 0xff)                                                  \
+    /* permanently adjust frame timing to avoid glitch vertical bar. */                  \
+    /* does not work on all displays! */                                                 \
+    X(uint8_t, enableFrameTimeLock, 2, 0, 1)                                             \
+    /* 0 for compatibility with more displays, 2 dithers vtotal (no ext. clock gen) */   \
+    X(uint8_t, frameTimeLockMethod, 4, 0, 2)                                             \
+    X(uint8_t, enableAutoGain, 5, 0, 1)                                                  \
+    X(uint8_t, wantScanlines, 6, 0, 1)                                                   \
+    X(uint8_t, wantOutputComponent, 7, 0, 1)                                             \
+    X(uint8_t, deintMode, 8, 0, 2)                                                       \
+    X(uint8_t, wantVdsLineFilter, 9, 0, 1)                                               \
+    X(uint8_t, wantPeaking, 10, 1, 1)                                                    \
+    X(uint8_t, wantTap6, 12, 1, 1)                                                       \
+    X(uint8_t, preferScalingRgbhv, 11, 1, 1)                                             \
+    X(uint8_t, PalForce60, 13, 0, 1)                                                     \
+    X(uint8_t, disableExternalClockGenerator, 19, 0, 1)                                  \
+    X(uint8_t, matchPresetSource, 14, 1, 1)                                              \
+    X(uint8_t, wantStepResponse, 15, 1, 1)                                               \
+    X(uint8_t, wantFullHeight, 16, 1, 1)                                                 \
+    X(uint8_t, enableCalibrationADC, 17, 1, 1)                                           \
+    X(uint8_t, scanlineStrength, 18, 0x30, 0x60)                                         \
+    /* OutputModeline target: a CEA / DMT id (modeline.h, default DMT 1280x960) */       \
+    /* or 0 for CVT reduced blanking from width, height and refresh */                   \
+    X(uint8_t, modelineId, 20, 0xa0, 0xff)                                               \
+    X(uint16_t, modelineWidth, 21, 1280, 4095)                                           \
+    X(uint16_t, modelineHeight, 22, 960, 2047)                                           \
+    X(uint8_t, modelineRefresh, 23, 60, 120)                                             \
+    /* MODELINE_HSYNC_POS / MODELINE_VSYNC_POS, 0xff keeps the mode's polarity */        \
+    X(uint8_t, modelineSync, 24, 0xff, 0xff)                                             \
+    /* 240p / 288p sources: whole output lines per source line, whole */                 \
+    /* display clocks per pixel, see applyIntegerScale() */                              \
+    X(uint8_t, wantIntegerScale, 25, 0, 1)
+
 // userOptions holds user preferences / customizations
 struct userOptions
 {
-    // 0 - normal, 1 - x480/x576, 2 - customized, 3 - 1280x720, 4 - 1280x1024, 5 - 1920x1080,
-    // 6 - downscale, 10 - bypass
-    PresetPreference presetPreference;
-    Ascii8 presetSlot;
-    uint8_t enableFrameTimeLock;
-    uint8_t frameTimeLockMethod;
-    uint8_t enableAutoGain;
-    uint8_t wantScanlines;
-    uint8_t wantOutputComponent;
-    uint8_t deintMode;
-    uint8_t wantVdsLineFilter;
-    uint8_t wantPeaking;
-    uint8_t wantTap6;
-    uint8_t preferScalingRgbhv;
-    uint8_t PalForce60;
-    uint8_t disableExternalClockGenerator;
-    uint8_t matchPresetSource;
-    uint8_t wantStepResponse;
-    uint8_t wantFullHeight;
-    uint8_t enableCalibrationADC;
-    uint8_t scanlineStrength;
+#define USER_OPTION_MEMBER(type, name, id, value, max) type name;
+    USER_OPTIONS(USER_OPTION_MEMBER)
+#undef USER_OPTION_MEMBER
 };
 
 
@@ -85,6 +116,7 @@ struct runTimeOptions
     bool isValidForScalingRGBHV;
     bool useHdmiSyncFix;
     bool extClockGenDetected;
+    uint8_t integerScale; // output lines per source line when applyIntegerScale() did its job, else 0
 };
 // remember adc options across presets
 struct adcOptions
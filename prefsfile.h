@@ -0,0 +1,162 @@
+#ifndef _PREFSFILE_H_
+#define _PREFSFILE_H_
+// USER PREFERENCES FILE
+// A header, a table of (id, offset, size) for each stored option, then the
+// userOptions struct as it was in RAM. When the table matches this
+// firmware's USER_OPTIONS the data is copied as is, otherwise each option
+// is looked up by id, so older and newer files both load. Options the file
+// doesn't have keep their default.
+#include <stddef.h>
+#include "options.h"
+#include "presetfile.h"
+
+#define PREFS_FILE_MAGIC 0x4f534247 // "GBSO"
+#define PREFS_FILE_VERSION 1
+#define PREFS_FILE_MAX 512 // bytes, with room for options added later
+
+typedef struct
+{
+    uint32_t magic;
+    uint8_t version;
+    uint8_t fields;    // PrefsField entries following the header
+    uint16_t dataSize; // option bytes following the field table
+    uint32_t crc;      // presetCrc32() of the field table and data
+} PrefsFileHeader;
+
+typedef struct
+{
+    uint8_t id;
+    uint8_t offset; // in the data
+    uint8_t size;
+} PrefsField;
+
+static_assert(sizeof(PrefsFileHeader) == 12, "PrefsFileHeader must not have padding");
+static_assert(sizeof(PrefsField) == 3, "PrefsField must not have padding");
+
+typedef struct
+{
+    PrefsField field;
+    uint32_t value; // default
+    uint32_t max;
+} PrefsOption;
+
+#define PREFS_OPTION(type, name, id, value, max) {{id, offsetof(userOptions, name), sizeof(type)}, value, max},
+static const PrefsOption prefsOptions[] PROGMEM = {USER_OPTIONS(PREFS_OPTION)};
+#undef PREFS_OPTION
+static const uint8_t prefsOptionsCount = sizeof(prefsOptions) / sizeof(prefsOptions[0]);
+
+// what prefsEncode() writes
+static const uint16_t prefsFileSize = sizeof(PrefsFileHeader) + prefsOptionsCount * sizeof(PrefsField) + sizeof(userOptions);
+static_assert(prefsFileSize <= PREFS_FILE_MAX, "PREFS_FILE_MAX too small");
+
+static inline PrefsOption prefsOption(uint8_t i)
+{
+    PrefsOption option;
+    memcpy_P(&option, &prefsOptions[i], sizeof(option));
+    return option;
+}
+
+// little endian values of 1 - 4 bytes
+static inline uint32_t prefsGet(const uint8_t *p, uint8_t size)
+{
+    uint32_t value = 0;
+    while (size--) {
+        value = (value << 8) | p[size];
+    }
+    return value;
+}
+
+static inline void prefsSet(uint8_t *p, uint8_t size, uint32_t value)
+{
+    for (uint8_t k = 0; k < size; k++, value >>= 8) {
+        p[k] = value & 0xff;
+    }
+}
+
+static inline void prefsDefaults(userOptions *options)
+{
+    for (uint8_t i = 0; i < prefsOptionsCount; i++) {
+        PrefsOption option = prefsOption(i);
+        prefsSet((uint8_t *)options + option.field.offset, option.field.size, option.value);
+    }
+}
+
+// puts options that are out of range back to their default
+static inline void prefsValidate(userOptions *options)
+{
+    for (uint8_t i = 0; i < prefsOptionsCount; i++) {
+        PrefsOption option = prefsOption(i);
+        uint8_t *p = (uint8_t *)options + option.field.offset;
+        if (prefsGet(p, option.field.size) > option.max) {
+            prefsSet(p, option.field.size, option.value);
+        }
+    }
+}
+
+// Writes the file contents for options to out (prefsFileSize bytes),
+// returns the size
+static inline uint16_t prefsEncode(const userOptions *options, uint8_t *out)
+{
+    PrefsFileHeader header;
+    header.magic = PREFS_FILE_MAGIC;
+    header.version = PREFS_FILE_VERSION;
+    header.fields = prefsOptionsCount;
+    header.dataSize = sizeof(userOptions);
+    uint8_t *p = out + sizeof(header);
+    for (uint8_t i = 0; i < prefsOptionsCount; i++) {
+        PrefsOption option = prefsOption(i);
+        memcpy(p, &option.field, sizeof(PrefsField));
+        p += sizeof(PrefsField);
+    }
+    memcpy(p, options, sizeof(userOptions));
+    p += sizeof(userOptions);
+    header.crc = presetCrc32(out + sizeof(header), p - out - sizeof(header));
+    memcpy(out, &header, sizeof(header));
+    return p - out;
+}
+
+// Loads options from file contents. migrated is set when the file was
+// written by a firmware with other options. Returns false if the file is
+// damaged, options are the defaults then.
+static inline bool prefsDecode(const uint8_t *in, uint16_t size, userOptions *options, bool *migrated)
+{
+    PrefsFileHeader header;
+    prefsDefaults(options);
+    *migrated = false;
+    if (size < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, in, sizeof(header));
+    const uint8_t *table = in + sizeof(header);
+    const uint8_t *data = table + header.fields * sizeof(PrefsField);
+    if (header.magic != PREFS_FILE_MAGIC || header.version != PREFS_FILE_VERSION ||
+        sizeof(header) + header.fields * sizeof(PrefsField) + header.dataSize != size ||
+        presetCrc32(table, size - sizeof(header)) != header.crc) {
+        return false;
+    }
+
+    bool same = header.fields == prefsOptionsCount && header.dataSize == sizeof(userOptions);
+    for (uint8_t i = 0; same && i < prefsOptionsCount; i++) {
+        PrefsOption option = prefsOption(i);
+        same = memcmp(table + i * sizeof(PrefsField), &option.field, sizeof(PrefsField)) == 0;
+    }
+    if (same) {
+        memcpy(options, data, sizeof(userOptions));
+    } else {
+        for (uint8_t i = 0; i < prefsOptionsCount; i++) {
+            PrefsOption option = prefsOption(i);
+            for (uint8_t k = 0; k < header.fields; k++) {
+                PrefsField stored;
+                memcpy(&stored, table + k * sizeof(PrefsField), sizeof(stored));
+                if (stored.id == option.field.id && stored.offset + stored.size <= header.dataSize && stored.size <= 4) {
+                    prefsSet((uint8_t *)options + option.field.offset, option.field.size, prefsGet(data + stored.offset, stored.size));
+                    break;
+                }
+            }
+        }
+        *migrated = true;
+    }
+    prefsValidate(options);
+    return true;
+}
+#endif
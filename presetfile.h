@@ -0,0 +1,112 @@
+#ifndef _PRESETFILE_H_
+#define _PRESETFILE_H_
+// CUSTOM PRESET FILES
+// A binary header followed by the register payload, laid out exactly like
+// the PROGMEM presets writeProgramArrayNew() consumes:
+// s0_40-5F, s0_90-9F, s1_00-2F, s3_00-7F, s4_00-5F, s5_00-6F
+// Version 2 stores only the bytes that differ from one of the built-in
+// presets (the base), version 1 files hold the full payload.
+#define PRESET_FILE_MAGIC 0x50534247 // "GBSP"
+#define PRESET_FILE_VERSION 2
+#define PRESET_PAYLOAD_SIZE 432
+#define PRESET_ID_INDEX 91     // s1_2B, GBS_PRESET_ID in the payload
+#define PRESET_BASE_NONE 0xff // full payload follows the header
+
+typedef struct
+{
+    uint32_t magic;
+    uint8_t version;
+    uint8_t videoMode;    // source video mode the preset was saved for
+    uint8_t presetID;     // GBS_PRESET_ID of the payload
+    uint8_t base;         // index of the built-in preset the delta applies to, or PRESET_BASE_NONE
+    uint16_t payloadSize; // bytes following the header
+    uint16_t reserved;
+    uint32_t crc; // presetCrc32() of the full (reconstructed) payload
+} PresetFileHeader;
+
+static_assert(sizeof(PresetFileHeader) == 16, "PresetFileHeader must not have padding");
+
+// CRC-32 (IEEE, as zlib), bitwise to keep flash use down. Pass the previous
+// result as crc to continue over several buffers.
+static inline uint32_t presetCrc32(const uint8_t *data, uint16_t size, uint32_t crc = 0)
+{
+    crc = ~crc;
+    while (size--) {
+        crc ^= *data++;
+        for (uint8_t k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+// Number of payload bytes that differ from a PROGMEM base
+static inline uint16_t presetDeltaCount(const uint8_t *payload, const uint8_t *base)
+{
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < PRESET_PAYLOAD_SIZE; i++) {
+        count += payload[i] != pgm_read_byte(base + i);
+    }
+    return count;
+}
+
+// Delta against a PROGMEM base as runs of (skip, count, count bytes), with
+// skip and count up to 255. Single unchanged bytes between changes are
+// carried along, a new run would cost more. Returns the encoded size, or 0
+// if it would not fit into outSize.
+static inline uint16_t presetDeltaEncode(const uint8_t *payload, const uint8_t *base, uint8_t *out, uint16_t outSize)
+{
+    uint16_t pos = 0;
+    uint16_t size = 0;
+    while (pos < PRESET_PAYLOAD_SIZE) {
+        uint8_t skip = 0;
+        while (pos < PRESET_PAYLOAD_SIZE && skip < 255 && payload[pos] == pgm_read_byte(base + pos)) {
+            pos++;
+            skip++;
+        }
+        if (pos == PRESET_PAYLOAD_SIZE) {
+            break; // the rest is unchanged
+        }
+        uint16_t end = pos;
+        while (end < PRESET_PAYLOAD_SIZE && end - pos < 255) {
+            if (payload[end] != pgm_read_byte(base + end)) {
+                end++;
+            } else if (end + 1 < PRESET_PAYLOAD_SIZE && end - pos < 254 && payload[end + 1] != pgm_read_byte(base + end + 1)) {
+                end += 2; // bridge a single unchanged byte
+            } else {
+                break;
+            }
+        }
+        uint8_t count = end - pos;
+        if (size + 2 + count > outSize) {
+            return 0;
+        }
+        out[size++] = skip;
+        out[size++] = count;
+        memcpy(out + size, payload + pos, count);
+        size += count;
+        pos = end;
+    }
+    return size;
+}
+
+// Rebuilds the payload from a PROGMEM base and a delta.
+// Returns false if the delta runs past the payload.
+static inline bool presetDeltaApply(const uint8_t *delta, uint16_t size, const uint8_t *base, uint8_t *payload)
+{
+    memcpy_P(payload, base, PRESET_PAYLOAD_SIZE);
+    uint16_t pos = 0;
+    uint16_t i = 0;
+    while (i + 2 <= size) {
+        pos += delta[i++];
+        uint8_t count = delta[i++];
+        if (pos + count > PRESET_PAYLOAD_SIZE || i + count > size) {
+            return false;
+        }
+        memcpy(payload + pos, delta + i, count);
+        pos += count;
+        i += count;
+    }
+    return i == size;
+}
+#endif
@@ -580,53 +580,38 @@ const readLocalFile = (file) => {
 };
 /** backup / restore */
 const doBackup = () => {
-    let backupFiles;
-    let done = 0;
-    let total = 0;
-    fetch("/spiffs/dir")
-        .then((r) => r.json())
-        .then((files) => {
-        backupFiles = files;
-        total = files.length;
-        const funcs = files.map((path) => () => {
-            return fetch(`/spiffs/download?file=${path}&${+new Date()}`).then((response) => {
-                GBSControl.ui.progressBackup.setAttribute("gbs-progress", `${done}/${total}`);
-                done++;
-                return checkFetchResponseStatus(response) && response.arrayBuffer();
-            });
-        });
-        return serial(funcs);
+    GBSControl.ui.progressBackup.setAttribute("gbs-progress", `...`);
+    fetch(`/bin/backup.bin?${+new Date()}`)
+        .then((response) => {
+        checkFetchResponseStatus(response);
+        if (response.headers.get("Content-Type") !== "application/octet-stream") {
+            throw new Error("backup not available");
+        }
+        return response.blob();
     })
-        .then((files) => {
-        const headerDescriptor = files.reduce((acc, f, index) => {
-            acc[backupFiles[index]] = f.byteLength;
-            return acc;
-        }, {});
-        const backupFilesJSON = JSON.stringify(headerDescriptor);
-        const backupFilesJSONSize = backupFilesJSON.length;
-        const mainHeader = [
-            (backupFilesJSONSize >> 24) & 255,
-            (backupFilesJSONSize >> 16) & 255,
-            (backupFilesJSONSize >> 8) & 255,
-            (backupFilesJSONSize >> 0) & 255,
-        ];
-        const outputArray = [
-            ...mainHeader,
-            ...backupFilesJSON.split("").map((c) => c.charCodeAt(0)),
-            ...files.reduce((acc, f, index) => {
-                acc = acc.concat(Array.from(new Uint8Array(f)));
-                return acc;
-            }, []),
-        ];
-        downloadBlob(new Blob([new Uint8Array(outputArray)]), `gbs-control.backup-${+new Date()}.bin`);
+        .then((blob) => {
+        downloadBlob(blob, `gbs-control.backup-${+new Date()}.bin`);
+    })
+        .catch(() => {
+        gbsAlert("Backup failed, please try again").catch(() => { });
+    })
+        .then(() => {
         GBSControl.ui.progressBackup.setAttribute("gbs-progress", ``);
     });
 };
+const restartAfterRestore = () => {
+    loadUser("a").then(() => {
+        gbsAlert("Restarting GBSControl.\nPlease wait until wifi reconnects then click OK")
+            .then(() => {
+            window.location.reload();
+        })
+            .catch(() => { });
+    });
+};
 const doRestore = (file) => {
     const { backupInput } = GBSControl.ui;
     const fileBuffer = new Uint8Array(file);
-    const headerCheck = fileBuffer.slice(4, 6);
-    if (headerCheck[0] !== 0x7b || headerCheck[1] !== 0x22) {
+    const invalidBackup = () => {
         backupInput.setAttribute("disabled", "");
         gbsAlert("Invalid Backup File")
             .then(() => {
@@ -637,6 +622,35 @@ const doRestore = (file) => {
             .catch(() => {
             backupInput.removeAttribute("disabled");
         });
+    };
+    // "GBSB", a bundle from /bin/backup.bin, the device checks and applies it as a whole
+    if (fileBuffer[0] === 0x47 &&
+        fileBuffer[1] === 0x42 &&
+        fileBuffer[2] === 0x53 &&
+        fileBuffer[3] === 0x42) {
+        const formData = new FormData();
+        formData.append("file", new Blob([fileBuffer], { type: "application/octet-stream" }), "backup.bin");
+        GBSControl.ui.progressRestore.setAttribute("gbs-progress", `...`);
+        fetch("/bin/restore", {
+            method: "POST",
+            body: formData,
+        })
+            .then((r) => r.json())
+            .then((applied) => {
+            GBSControl.ui.progressRestore.setAttribute("gbs-progress", ``);
+            if (applied) {
+                restartAfterRestore();
+            }
+            else {
+                invalidBackup();
+            }
+        });
+        return;
+    }
+    // older backups, made file by file
+    const headerCheck = fileBuffer.slice(4, 6);
+    if (headerCheck[0] !== 0x7b || headerCheck[1] !== 0x22) {
+        invalidBackup();
         return;
     }
     const b0 = fileBuffer[0], b1 = fileBuffer[1], b2 = fileBuffer[2], b3 = fileBuffer[3];
@@ -665,13 +679,7 @@ const doRestore = (file) => {
     });
     serial(funcs).then(() => {
         GBSControl.ui.progressRestore.setAttribute("gbs-progress", ``);
-        loadUser("a").then(() => {
-            gbsAlert("Restarting GBSControl.\nPlease wait until wifi reconnects then click OK")
-                .then(() => {
-                window.location.reload();
-            })
-                .catch(() => { });
-        });
+        restartAfterRestore();
     });
 };
 const downloadBlob = (blob, name = "file.txt") => {
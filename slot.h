@@ -1,8 +1,10 @@
 #ifndef _SLOT_H_
+#define _SLOT_H_
 // SLOTS
-#define SLOTS_FILE "/slots.bin" // the file where to store slots metadata
+#define SLOTS_FILE "/slots.bin" // the file where to store slots metadata (before the slot database)
 #define SLOTS_TOTAL 72          // max number of slots
 #define EMPTY_SLOT_NAME "Empty                   "
+#define SLOT_NONE 0xff // slotIndex() of a character that isn't a slot
 typedef struct
 {
     char name[25];
@@ -19,4 +21,67 @@ typedef struct
 {
     SlotMeta slot[SLOTS_TOTAL]; // the max avaliable slots that can be encoded in a the charset[A-Za-z0-9-._~()!*:,;]
 } SlotMetaArray;
-#endif
\ No newline at end of file
+
+// slot characters in slot order
+static const char slotChars[SLOTS_TOTAL + 1] PROGMEM = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~()!*:,";
+
+// slot index by character, SLOT_NONE for anything else
+static const uint8_t slotIndexTable[128] PROGMEM = {
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255,  68, 255, 255, 255, 255, 255, 255,  66,  67,  69, 255,  71,  62,  63, 255,
+     52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  70, 255, 255, 255, 255, 255,
+    255,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,
+     15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, 255, 255, 255, 255,  64,
+    255,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,
+     41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, 255, 255, 255,  65, 255,
+};
+
+static inline uint8_t slotIndex(uint8_t slotChar)
+{
+    return slotChar < 128 ? pgm_read_byte(slotIndexTable + slotChar) : SLOT_NONE;
+}
+
+static inline uint8_t slotChar(uint8_t index)
+{
+    return pgm_read_byte(slotChars + index);
+}
+
+// SLOT DATABASE
+// All slots in one file: a fixed index (header, then one SlotDbEntry per
+// slot) followed by the preset records, each a PresetFileHeader plus its
+// payload as in the old per slot preset files. Records are placed in cells
+// of SLOTS_DB_CELL bytes, a record that gets replaced or removed frees its
+// cells for the next one. Removing, renaming or swapping slots only touches
+// the index.
+#define SLOTS_DB_FILE "/slots.db"
+#define SLOTS_DB_MAGIC 0x44534247 // "GBSD"
+#define SLOTS_DB_VERSION 1
+#define SLOTS_DB_MODES 9  // source video modes with custom presets, see slotDbMode()
+#define SLOTS_DB_CELL 64  // bytes, records start on a cell
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t slots; // SLOTS_TOTAL
+} SlotDbHeader;
+
+typedef struct
+{
+    SlotMeta meta;
+    uint16_t cell[SLOTS_DB_MODES]; // first cell of the preset record per mode, 0 = none
+    uint16_t size[SLOTS_DB_MODES]; // record bytes
+} SlotDbEntry;
+
+static_assert(sizeof(SlotDbHeader) == 8, "SlotDbHeader must not have padding");
+static_assert(sizeof(SlotDbEntry) == 68, "SlotDbEntry must not have padding");
+
+static inline uint32_t slotDbEntryOffset(uint8_t index)
+{
+    return sizeof(SlotDbHeader) + index * sizeof(SlotDbEntry);
+}
+
+// first cell after the index
+#define SLOTS_DB_FIRST_CELL ((sizeof(SlotDbHeader) + SLOTS_TOTAL * sizeof(SlotDbEntry) + SLOTS_DB_CELL - 1) / SLOTS_DB_CELL)
+#endif
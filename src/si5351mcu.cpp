@@ -83,9 +83,9 @@
  * [See the README.md file for other details]
  ****************************************************************************/
 void Si5351mcu::setFreq(uint8_t clk, uint32_t freq) {
-    uint8_t a, R = 1, pll_stride = 0, msyn_stride = 0;
-    uint32_t b, c, f, fvco, outdivider;
-    uint32_t MSx_P1, MSNx_P1, MSNx_P2, MSNx_P3;
+    uint8_t R = 1, pll_stride = 0, msyn_stride = 0;
+    uint32_t fvco, outdivider;
+    uint32_t MSx_P1;
 
     // Overclock option
     #ifdef SI_OVERCLOCK
@@ -109,6 +109,7 @@ void Si5351mcu::setFreq(uint8_t clk, uint32_t freq) {
 
     // Calculate the PLL-Frequency (given the even divider)
     fvco = outdivider * R * freq;
+    plan_div[clk] = outdivider * R;
 
     // Convert the Output Divider to the bit-setting required in register 44
     switch (R) {
@@ -127,52 +128,12 @@ void Si5351mcu::setFreq(uint8_t clk, uint32_t freq) {
 
     MSx_P1 = 128 * outdivider - 512;
 
-    // calc the a/b/c for the PLL Msynth
-    /***************************************************************************
-    * We will use integer only on the b/c relation, and will >> 5 (/32) both
-    * to fit it on the 1048 k limit of C and keep the relation
-    * the most accurate possible, this works fine with xtals from
-    * 24 to 28 Mhz.
-    *
-    * This will give errors of about +/- 2 Hz maximum
-    * as per my test and simulations in the worst case, well below the
-    * XTAl ppm error...
-    *
-    * This will free more than 1K of the final eeprom
-    *
-    ****************************************************************************/
-    a = fvco / int_xtal;
-    b = (fvco % int_xtal) >> 5;     // Integer part of the fraction
-                                    // scaled to match "c" limits
-    c = int_xtal >> 5;              // "c" scaled to match it's limits
-                                    // in the register
-
-    // f is (128*b)/c to mimic the Floor(128*(b/c)) from the datasheet
-    f = (128 * b) / c;
-
-    // build the registers to write
-    MSNx_P1 = 128 * a + f - 512;
-    MSNx_P2 = 128 * b - f * c;
-    MSNx_P3 = c;
-
     // PLLs and CLK# registers are allocated with a stride, we handle that with
     // the stride var to make code smaller
     if (clk > 0 ) pll_stride = 8;
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wnarrowing"
-    // HEX makes it easier to human read on bit shifts
-    uint8_t reg_bank_26[] = {
-      (MSNx_P3 & 0xFF00) >> 8,          // Bits [15:8] of MSNx_P3 in register 26
-      MSNx_P3 & 0xFF,
-      (MSNx_P1 & 0x030000L) >> 16,
-      (MSNx_P1 & 0xFF00) >> 8,          // Bits [15:8]  of MSNx_P1 in register 29
-      MSNx_P1 & 0xFF,                   // Bits [7:0]  of MSNx_P1 in register 30
-      ((MSNx_P3 & 0x0F0000L) >> 12) | ((MSNx_P2 & 0x0F0000) >> 16), // Parts of MSNx_P3 and MSNx_P1
-      (MSNx_P2 & 0xFF00) >> 8,          // Bits [15:8]  of MSNx_P2 in register 32
-      MSNx_P2 & 0xFF                    // Bits [7:0]  of MSNx_P2 in register 33
-    };
-#pragma GCC diagnostic pop
+    uint8_t reg_bank_26[8];
+    pllRegisters(fvco, reg_bank_26);
 
     // We could do this here - but move it next to the reg_bank_42 write
     // i2cWriteBurst(26 + pll_stride, reg_bank_26, sizeof(reg_bank_26));
@@ -248,6 +209,82 @@ void Si5351mcu::setFreq(uint8_t clk, uint32_t freq) {
 }
 
 
+/*****************************************************************************
+ * This function builds the PLL feedback msynth registers (26..33 + stride)
+ * for a VCO frequency, used by setFreq() and updateFreq()
+ ****************************************************************************/
+void Si5351mcu::pllRegisters(uint32_t fvco, uint8_t *reg_bank) {
+    uint8_t a;
+    uint32_t b, c, f;
+    uint32_t MSNx_P1, MSNx_P2, MSNx_P3;
+
+    // calc the a/b/c for the PLL Msynth
+    /***************************************************************************
+    * We will use integer only on the b/c relation, and will >> 5 (/32) both
+    * to fit it on the 1048 k limit of C and keep the relation
+    * the most accurate possible, this works fine with xtals from
+    * 24 to 28 Mhz.
+    *
+    * This will give errors of about +/- 2 Hz maximum
+    * as per my test and simulations in the worst case, well below the
+    * XTAl ppm error...
+    *
+    * This will free more than 1K of the final eeprom
+    *
+    ****************************************************************************/
+    a = fvco / int_xtal;
+    b = (fvco % int_xtal) >> 5;     // Integer part of the fraction
+                                    // scaled to match "c" limits
+    c = int_xtal >> 5;              // "c" scaled to match it's limits
+                                    // in the register
+
+    // f is (128*b)/c to mimic the Floor(128*(b/c)) from the datasheet
+    f = (128 * b) / c;
+
+    // build the registers to write
+    MSNx_P1 = 128 * a + f - 512;
+    MSNx_P2 = 128 * b - f * c;
+    MSNx_P3 = c;
+
+    // HEX makes it easier to human read on bit shifts
+    reg_bank[0] = (MSNx_P3 & 0xFF00) >> 8;      // Bits [15:8] of MSNx_P3 in register 26
+    reg_bank[1] = MSNx_P3 & 0xFF;
+    reg_bank[2] = (MSNx_P1 & 0x030000L) >> 16;
+    reg_bank[3] = (MSNx_P1 & 0xFF00) >> 8;      // Bits [15:8]  of MSNx_P1 in register 29
+    reg_bank[4] = MSNx_P1 & 0xFF;               // Bits [7:0]  of MSNx_P1 in register 30
+    reg_bank[5] = ((MSNx_P3 & 0x0F0000L) >> 12) | ((MSNx_P2 & 0x0F0000) >> 16); // Parts of MSNx_P3 and MSNx_P1
+    reg_bank[6] = (MSNx_P2 & 0xFF00) >> 8;      // Bits [15:8]  of MSNx_P2 in register 32
+    reg_bank[7] = MSNx_P2 & 0xFF;               // Bits [7:0]  of MSNx_P2 in register 33
+}
+
+
+/*****************************************************************************
+ * This function moves the freq of the corresponding clock without touching
+ * the output msynth: the divider plan of the last setFreq() is kept and only
+ * the PLL feedback msynth (P1/P2/P3) is rewritten, in one burst.
+ *
+ * There is no PLL reset, so no click and no phase jump, and no divider
+ * search on each step: meant for ramps and small corrections around the
+ * frequency setFreq() was last called with.
+ *
+ * If the PLL would leave its range (or there is no plan yet) this falls
+ * back to setFreq() and returns false.
+ ****************************************************************************/
+bool Si5351mcu::updateFreq(uint8_t clk, uint32_t freq) {
+    uint32_t div = plan_div[clk];
+
+    if (div == 0 || freq < SIVCO_MIN / div || freq > SIVCO_MAX / div) {
+        setFreq(clk, freq);
+        return false;
+    }
+
+    uint8_t reg_bank_26[8];
+    pllRegisters(freq * div, reg_bank_26);
+    i2cWriteBurst(26 + (clk > 0 ? 8 : 0), reg_bank_26, sizeof(reg_bank_26));
+    return true;
+}
+
+
 /*****************************************************************************
  * Reset of the PLLs and multisynths output enable
  *
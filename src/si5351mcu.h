@@ -66,6 +66,14 @@
 #define SIOUT_6mA 2
 #define SIOUT_8mA 3
 
+// PLL (VCO) range, the upper end as setFreq() uses it
+#define SIVCO_MIN 600000000L
+#ifdef SI_OVERCLOCK
+    #define SIVCO_MAX SI_OVERCLOCK
+#else
+    #define SIVCO_MAX 900000000L
+#endif
+
 // registers base (2mA by default)
 #define SICLK0_R   76       // 0b01001100
 #define SICLK12_R 108       // 0b01101100
@@ -104,6 +112,13 @@ class Si5351mcu {
         uint16_t  omsynth[SICHANNELS] = { 0 };
         uint8_t   o_Rdiv[SICHANNELS] = { 0 };
 
+        // divider plan of the last setFreq(): output msynth * R, so the
+        // PLL runs at freq * plan_div (0 before the first setFreq)
+        uint32_t  plan_div[SICHANNELS] = { 0 };
+
+        // PLL feedback msynth registers (26..33 + stride) for fvco
+        void pllRegisters(uint32_t fvco, uint8_t *reg_bank);
+
     public:
         // var to check the clock state
         bool clkOn[SICHANNELS] = { 0 };     // This should not really be public - use isEnabled()
@@ -121,6 +136,12 @@ class Si5351mcu {
         // set CLKx(0..2) to freq (Hz)
         void setFreq(uint8_t, uint32_t);
 
+        // move CLKx(0..2) to freq (Hz) keeping the output msynth of the
+        // last setFreq(), rewriting only the PLL fraction: no reset, the
+        // phase stays continuous. Falls back to setFreq() and returns
+        // false when the PLL would leave its range.
+        bool updateFreq(uint8_t, uint32_t);
+
         // pass a correction factor
         void correction(int32_t);
 
@@ -14,6 +14,16 @@ namespace detail
         static const uint8_t SegBitOffset = 0;
         static const uint8_t SegBitWidth = 8;
         static const uint8_t SegInitial = 0xff;
+        // Keep a shadow copy of all six segments
+        static const uint8_t ShadowSegments = 6;
+        // Status block for StatusSnapshot: segment 0 from 0x00 up to the
+        // sync processor's VTOTAL, one burst within the Wire buffer.  A
+        // snapshot is reused for less than the 2ms the sync code waits
+        // between polls.
+        static const uint8_t StatusSegment = 0;
+        static const uint8_t StatusStart = 0x00;
+        static const uint8_t StatusEnd = 0x1d;
+        static const uint16_t StatusMaxAge = 1500; // us
     };
 } // namespace detail
 
@@ -24,132 +34,135 @@ private:
     // Stupid template boilerplate
     typedef tw::SegmentedSlave<Addr, detail::TVAttrs> Base;
     using typename Base::SegValue;
-    template <SegValue Seg, uint8_t ByteOffset, uint8_t BitOffset, uint8_t BitWidth, tw::Signage Signed>
-    using Register = typename Base::template Register<Seg, ByteOffset, BitOffset, BitWidth, Signed>;
+    template <SegValue Seg, uint8_t ByteOffset, uint8_t BitOffset, uint8_t BitWidth, tw::Signage Signed, bool Volatile = false>
+    using Register = typename Base::template Register<Seg, ByteOffset, BitOffset, BitWidth, Signed, Volatile>;
     template <SegValue Seg, uint8_t ByteOffset, uint8_t BitOffset, uint8_t BitWidth>
     using UReg = Register<Seg, ByteOffset, BitOffset, BitWidth, tw::Signage::UNSIGNED>;
+    // Registers the chip updates by itself, never served from the shadow copy
+    template <SegValue Seg, uint8_t ByteOffset, uint8_t BitOffset, uint8_t BitWidth>
+    using VReg = Register<Seg, ByteOffset, BitOffset, BitWidth, tw::Signage::UNSIGNED, true>;
 
 public:
     // STATUS Registers
     // Arbitary names for STATUS_IF register
-    typedef UReg<0x00, 0x00, 0, 8> STATUS_00; // whole register for convenience
-    typedef UReg<0x00, 0x00, 0, 1> STATUS_IF_VT_OK;
-    typedef UReg<0x00, 0x00, 1, 1> STATUS_IF_HT_OK;
-    typedef UReg<0x00, 0x00, 2, 1> STATUS_IF_HVT_OK;
-    typedef UReg<0x00, 0x00, 3, 1> STATUS_IF_INP_NTSC_INT;
-    typedef UReg<0x00, 0x00, 4, 1> STATUS_IF_INP_NTSC_PRG;
-    typedef UReg<0x00, 0x00, 5, 1> STATUS_IF_INP_PAL_INT;
-    typedef UReg<0x00, 0x00, 6, 1> STATUS_IF_INP_PAL_PRG;
-    typedef UReg<0x00, 0x00, 7, 1> STATUS_IF_INP_SD;
-    typedef UReg<0x00, 0x01, 0, 1> STATUS_IF_INP_VGA60;
-    typedef UReg<0x00, 0x01, 1, 1> STATUS_IF_INP_VGA75;
-    typedef UReg<0x00, 0x01, 2, 1> STATUS_IF_INP_VGA86;
-    typedef UReg<0x00, 0x01, 3, 1> STATUS_IF_INP_VGA;
-    typedef UReg<0x00, 0x01, 4, 1> STATUS_IF_INP_SVGA60;
-    typedef UReg<0x00, 0x01, 5, 1> STATUS_IF_INP_SVGA75;
-    typedef UReg<0x00, 0x01, 6, 1> STATUS_IF_INP_SVGA85;
-    typedef UReg<0x00, 0x01, 7, 1> STATUS_IF_INP_SVGA;
-    typedef UReg<0x00, 0x02, 0, 1> STATUS_IF_INP_XGA60;
-    typedef UReg<0x00, 0x02, 1, 1> STATUS_IF_INP_XGA70;
-    typedef UReg<0x00, 0x02, 2, 1> STATUS_IF_INP_XGA75;
-    typedef UReg<0x00, 0x02, 3, 1> STATUS_IF_INP_XGA85;
-    typedef UReg<0x00, 0x02, 4, 1> STATUS_IF_INP_XGA;
-    typedef UReg<0x00, 0x02, 5, 1> STATUS_IF_INP_SXGA60;
-    typedef UReg<0x00, 0x02, 6, 1> STATUS_IF_INP_SXGA75;
-    typedef UReg<0x00, 0x02, 7, 1> STATUS_IF_INP_SXGA85;
-    typedef UReg<0x00, 0x03, 0, 8> STATUS_03; // whole register for convenience
-    typedef UReg<0x00, 0x03, 0, 1> STATUS_IF_INP_SXGA;
-    typedef UReg<0x00, 0x03, 1, 1> STATUS_IF_INP_PC;
-    typedef UReg<0x00, 0x03, 2, 1> STATUS_IF_INP_720P50;
-    typedef UReg<0x00, 0x03, 3, 1> STATUS_IF_INP_720P60;
-    typedef UReg<0x00, 0x03, 4, 1> STATUS_IF_INP_720;
-    typedef UReg<0x00, 0x03, 5, 1> STATUS_IF_INP_2200_1125I;
-    typedef UReg<0x00, 0x03, 6, 1> STATUS_IF_INP_2376_1250I;
-    typedef UReg<0x00, 0x03, 7, 1> STATUS_IF_INP_2640_1125I;
-    typedef UReg<0x00, 0x04, 0, 8> STATUS_04; // whole register for convenience
-    typedef UReg<0x00, 0x04, 0, 1> STATUS_IF_INP_1080I;
-    typedef UReg<0x00, 0x04, 1, 1> STATUS_IF_INP_2200_1125P;
-    typedef UReg<0x00, 0x04, 2, 1> STATUS_IF_INP_2376_1250P;
-    typedef UReg<0x00, 0x04, 3, 1> STATUS_IF_INP_2640_1125P;
-    typedef UReg<0x00, 0x04, 4, 1> STATUS_IF_INP_1808P;
-    typedef UReg<0x00, 0x04, 5, 1> STATUS_IF_INP_HD;
-    typedef UReg<0x00, 0x04, 6, 1> STATUS_IF_INP_INT;
-    typedef UReg<0x00, 0x04, 7, 1> STATUS_IF_INP_PRG;
-    typedef UReg<0x00, 0x05, 0, 8> STATUS_05; // whole register for convenience
-    typedef UReg<0x00, 0x05, 0, 1> STATUS_IF_INP_USER;
-    typedef UReg<0x00, 0x05, 1, 1> STATUS_IF_NO_SYNC;
-    typedef UReg<0x00, 0x05, 2, 1> STATUS_IF_HT_BAD;
-    typedef UReg<0x00, 0x05, 3, 1> STATUS_IF_VT_BAD;
-    typedef UReg<0x00, 0x05, 4, 1> STATUS_IF_INP_SW;
-
-    typedef UReg<0x00, 0x06, 0, 9> HPERIOD_IF;
-    typedef UReg<0x00, 0x07, 1, 11> VPERIOD_IF;
-
-    typedef UReg<0x00, 0x09, 6, 1> STATUS_MISC_PLL648_LOCK;
-    typedef UReg<0x00, 0x09, 7, 1> STATUS_MISC_PLLAD_LOCK;
-    typedef UReg<0x00, 0x0A, 0, 1> STATUS_MISC_PIP_EN_V;
-    typedef UReg<0x00, 0x0A, 1, 1> STATUS_MISC_PIP_EN_H;
-    typedef UReg<0x00, 0x0A, 4, 1> STATUS_MISC_VBLK;
-    typedef UReg<0x00, 0x0A, 5, 1> STATUS_MISC_HBLK;
-    typedef UReg<0x00, 0x0A, 6, 1> STATUS_MISC_VSYNC;
-    typedef UReg<0x00, 0x0A, 7, 1> STATUS_MISC_HSYNC;
-
-    typedef UReg<0x00, 0x0B, 0, 8> CHIP_ID_FOUNDRY;
-    typedef UReg<0x00, 0x0C, 0, 8> CHIP_ID_PRODUCT;
-    typedef UReg<0x00, 0x0D, 0, 8> CHIP_ID_REVISION;
-
-    typedef UReg<0x00, 0x0E, 0, 1> STATUS_GPIO_GPIO;
-    typedef UReg<0x00, 0x0E, 1, 1> STATUS_GPIO_HALF;
-    typedef UReg<0x00, 0x0E, 2, 1> STATUS_GPIO_SCLSA;
-    typedef UReg<0x00, 0x0E, 3, 1> STATUS_GPIO_MBA;
-    typedef UReg<0x00, 0x0E, 4, 1> STATUS_GPIO_MCS1;
-    typedef UReg<0x00, 0x0E, 5, 1> STATUS_GPIO_HBOUT;
-    typedef UReg<0x00, 0x0E, 6, 1> STATUS_GPIO_VBOUT;
-    typedef UReg<0x00, 0x0E, 7, 1> STATUS_GPIO_CLKOUT;
-
-    typedef UReg<0x00, 0x0F, 0, 8> STATUS_0F; // whole register for convenience
-    typedef UReg<0x00, 0x0F, 0, 1> STATUS_INT_SOG_BAD;
-    typedef UReg<0x00, 0x0F, 1, 1> STATUS_INT_SOG_SW;
-    typedef UReg<0x00, 0x0F, 2, 1> STATUS_INT_SOG_OK;
-    typedef UReg<0x00, 0x0F, 3, 1> STATUS_INT_INP_SW;
-    typedef UReg<0x00, 0x0F, 4, 1> STATUS_INT_INP_NO_SYNC;
-    typedef UReg<0x00, 0x0F, 5, 1> STATUS_INT_INP_HSYNC;
-    typedef UReg<0x00, 0x0F, 6, 1> STATUS_INT_INP_VSYNC;
-    typedef UReg<0x00, 0x0F, 7, 1> STATUS_INT_INP_CSYNC; //Needs confirmation
-
-    typedef UReg<0x00, 0x10, 0, 4> STATUS_VDS_FR_NUM;
-    typedef UReg<0x00, 0x10, 4, 1> STATUS_VDS_OUT_VSYNC;
-    typedef UReg<0x00, 0x10, 5, 1> STATUS_VDS_OUT_HSYNC;
-    typedef UReg<0x00, 0x11, 0, 1> STATUS_VDS_FIELD;
-    typedef UReg<0x00, 0x11, 1, 1> STATUS_VDS_OUT_BLANK;
-    typedef UReg<0x00, 0x11, 4, 11> STATUS_VDS_VERT_COUNT;
-
-    typedef UReg<0x00, 0x13, 0, 1> STATUS_MEM_FF_WFF_FIFO_FULL;
-    typedef UReg<0x00, 0x13, 1, 1> STATUS_MEM_FF_WFF_FIFO_EMPTY;
-    typedef UReg<0x00, 0x13, 2, 1> STATUS_MEM_FF_RFF_FIFO_FULL;
-    typedef UReg<0x00, 0x13, 3, 1> STATUS_MEM_FF_RFF_FIFO_EMPTY;
-    typedef UReg<0x00, 0x13, 4, 1> STATUS_MEM_FF_CAP_FIFO_FULL;
-    typedef UReg<0x00, 0x13, 5, 1> STATUS_MEM_FF_CAP_FIFO_EMPTY;
-    typedef UReg<0x00, 0x13, 6, 1> STATUS_MEM_FF_PLY_FIFO_FULL;
-    typedef UReg<0x00, 0x13, 7, 1> STATUS_MEM_FF_PLY_FIFO_EMPTY;
-    typedef UReg<0x00, 0x14, 0, 1> STATUS_MEM_FF_EXT_FIN;
-
-    typedef UReg<0x00, 0x15, 7, 1> STATUS_DEINT_PULLDN;
-
-    typedef UReg<0x00, 0x16, 0, 8> STATUS_16; // whole register for convenience
-    typedef UReg<0x00, 0x16, 0, 1> STATUS_SYNC_PROC_HSPOL;
-    typedef UReg<0x00, 0x16, 1, 1> STATUS_SYNC_PROC_HSACT;
-    typedef UReg<0x00, 0x16, 2, 1> STATUS_SYNC_PROC_VSPOL;
-    typedef UReg<0x00, 0x16, 3, 1> STATUS_SYNC_PROC_VSACT;
-    typedef UReg<0x00, 0x17, 0, 12> STATUS_SYNC_PROC_HTOTAL;
-    typedef UReg<0x00, 0x19, 0, 12> STATUS_SYNC_PROC_HLOW_LEN;
-    typedef UReg<0x00, 0x1B, 0, 11> STATUS_SYNC_PROC_VTOTAL;
-    typedef UReg<0x00, 0x1F, 0, 8> TEST_BUS_1F;
-    typedef UReg<0x00, 0x20, 0, 16> TEST_FF_STATUS;
-    typedef UReg<0x00, 0x23, 0, 8> TEST_BUS_23;
-    typedef UReg<0x00, 0x2E, 0, 16> TEST_BUS;
-    typedef UReg<0x00, 0x2E, 0, 8> TEST_BUS_2E;
-    typedef UReg<0x00, 0x2F, 0, 8> TEST_BUS_2F;
+    typedef VReg<0x00, 0x00, 0, 8> STATUS_00; // whole register for convenience
+    typedef VReg<0x00, 0x00, 0, 1> STATUS_IF_VT_OK;
+    typedef VReg<0x00, 0x00, 1, 1> STATUS_IF_HT_OK;
+    typedef VReg<0x00, 0x00, 2, 1> STATUS_IF_HVT_OK;
+    typedef VReg<0x00, 0x00, 3, 1> STATUS_IF_INP_NTSC_INT;
+    typedef VReg<0x00, 0x00, 4, 1> STATUS_IF_INP_NTSC_PRG;
+    typedef VReg<0x00, 0x00, 5, 1> STATUS_IF_INP_PAL_INT;
+    typedef VReg<0x00, 0x00, 6, 1> STATUS_IF_INP_PAL_PRG;
+    typedef VReg<0x00, 0x00, 7, 1> STATUS_IF_INP_SD;
+    typedef VReg<0x00, 0x01, 0, 1> STATUS_IF_INP_VGA60;
+    typedef VReg<0x00, 0x01, 1, 1> STATUS_IF_INP_VGA75;
+    typedef VReg<0x00, 0x01, 2, 1> STATUS_IF_INP_VGA86;
+    typedef VReg<0x00, 0x01, 3, 1> STATUS_IF_INP_VGA;
+    typedef VReg<0x00, 0x01, 4, 1> STATUS_IF_INP_SVGA60;
+    typedef VReg<0x00, 0x01, 5, 1> STATUS_IF_INP_SVGA75;
+    typedef VReg<0x00, 0x01, 6, 1> STATUS_IF_INP_SVGA85;
+    typedef VReg<0x00, 0x01, 7, 1> STATUS_IF_INP_SVGA;
+    typedef VReg<0x00, 0x02, 0, 1> STATUS_IF_INP_XGA60;
+    typedef VReg<0x00, 0x02, 1, 1> STATUS_IF_INP_XGA70;
+    typedef VReg<0x00, 0x02, 2, 1> STATUS_IF_INP_XGA75;
+    typedef VReg<0x00, 0x02, 3, 1> STATUS_IF_INP_XGA85;
+    typedef VReg<0x00, 0x02, 4, 1> STATUS_IF_INP_XGA;
+    typedef VReg<0x00, 0x02, 5, 1> STATUS_IF_INP_SXGA60;
+    typedef VReg<0x00, 0x02, 6, 1> STATUS_IF_INP_SXGA75;
+    typedef VReg<0x00, 0x02, 7, 1> STATUS_IF_INP_SXGA85;
+    typedef VReg<0x00, 0x03, 0, 8> STATUS_03; // whole register for convenience
+    typedef VReg<0x00, 0x03, 0, 1> STATUS_IF_INP_SXGA;
+    typedef VReg<0x00, 0x03, 1, 1> STATUS_IF_INP_PC;
+    typedef VReg<0x00, 0x03, 2, 1> STATUS_IF_INP_720P50;
+    typedef VReg<0x00, 0x03, 3, 1> STATUS_IF_INP_720P60;
+    typedef VReg<0x00, 0x03, 4, 1> STATUS_IF_INP_720;
+    typedef VReg<0x00, 0x03, 5, 1> STATUS_IF_INP_2200_1125I;
+    typedef VReg<0x00, 0x03, 6, 1> STATUS_IF_INP_2376_1250I;
+    typedef VReg<0x00, 0x03, 7, 1> STATUS_IF_INP_2640_1125I;
+    typedef VReg<0x00, 0x04, 0, 8> STATUS_04; // whole register for convenience
+    typedef VReg<0x00, 0x04, 0, 1> STATUS_IF_INP_1080I;
+    typedef VReg<0x00, 0x04, 1, 1> STATUS_IF_INP_2200_1125P;
+    typedef VReg<0x00, 0x04, 2, 1> STATUS_IF_INP_2376_1250P;
+    typedef VReg<0x00, 0x04, 3, 1> STATUS_IF_INP_2640_1125P;
+    typedef VReg<0x00, 0x04, 4, 1> STATUS_IF_INP_1808P;
+    typedef VReg<0x00, 0x04, 5, 1> STATUS_IF_INP_HD;
+    typedef VReg<0x00, 0x04, 6, 1> STATUS_IF_INP_INT;
+    typedef VReg<0x00, 0x04, 7, 1> STATUS_IF_INP_PRG;
+    typedef VReg<0x00, 0x05, 0, 8> STATUS_05; // whole register for convenience
+    typedef VReg<0x00, 0x05, 0, 1> STATUS_IF_INP_USER;
+    typedef VReg<0x00, 0x05, 1, 1> STATUS_IF_NO_SYNC;
+    typedef VReg<0x00, 0x05, 2, 1> STATUS_IF_HT_BAD;
+    typedef VReg<0x00, 0x05, 3, 1> STATUS_IF_VT_BAD;
+    typedef VReg<0x00, 0x05, 4, 1> STATUS_IF_INP_SW;
+
+    typedef VReg<0x00, 0x06, 0, 9> HPERIOD_IF;
+    typedef VReg<0x00, 0x07, 1, 11> VPERIOD_IF;
+
+    typedef VReg<0x00, 0x09, 6, 1> STATUS_MISC_PLL648_LOCK;
+    typedef VReg<0x00, 0x09, 7, 1> STATUS_MISC_PLLAD_LOCK;
+    typedef VReg<0x00, 0x0A, 0, 1> STATUS_MISC_PIP_EN_V;
+    typedef VReg<0x00, 0x0A, 1, 1> STATUS_MISC_PIP_EN_H;
+    typedef VReg<0x00, 0x0A, 4, 1> STATUS_MISC_VBLK;
+    typedef VReg<0x00, 0x0A, 5, 1> STATUS_MISC_HBLK;
+    typedef VReg<0x00, 0x0A, 6, 1> STATUS_MISC_VSYNC;
+    typedef VReg<0x00, 0x0A, 7, 1> STATUS_MISC_HSYNC;
+
+    typedef VReg<0x00, 0x0B, 0, 8> CHIP_ID_FOUNDRY;
+    typedef VReg<0x00, 0x0C, 0, 8> CHIP_ID_PRODUCT;
+    typedef VReg<0x00, 0x0D, 0, 8> CHIP_ID_REVISION;
+
+    typedef VReg<0x00, 0x0E, 0, 1> STATUS_GPIO_GPIO;
+    typedef VReg<0x00, 0x0E, 1, 1> STATUS_GPIO_HALF;
+    typedef VReg<0x00, 0x0E, 2, 1> STATUS_GPIO_SCLSA;
+    typedef VReg<0x00, 0x0E, 3, 1> STATUS_GPIO_MBA;
+    typedef VReg<0x00, 0x0E, 4, 1> STATUS_GPIO_MCS1;
+    typedef VReg<0x00, 0x0E, 5, 1> STATUS_GPIO_HBOUT;
+    typedef VReg<0x00, 0x0E, 6, 1> STATUS_GPIO_VBOUT;
+    typedef VReg<0x00, 0x0E, 7, 1> STATUS_GPIO_CLKOUT;
+
+    typedef VReg<0x00, 0x0F, 0, 8> STATUS_0F; // whole register for convenience
+    typedef VReg<0x00, 0x0F, 0, 1> STATUS_INT_SOG_BAD;
+    typedef VReg<0x00, 0x0F, 1, 1> STATUS_INT_SOG_SW;
+    typedef VReg<0x00, 0x0F, 2, 1> STATUS_INT_SOG_OK;
+    typedef VReg<0x00, 0x0F, 3, 1> STATUS_INT_INP_SW;
+    typedef VReg<0x00, 0x0F, 4, 1> STATUS_INT_INP_NO_SYNC;
+    typedef VReg<0x00, 0x0F, 5, 1> STATUS_INT_INP_HSYNC;
+    typedef VReg<0x00, 0x0F, 6, 1> STATUS_INT_INP_VSYNC;
+    typedef VReg<0x00, 0x0F, 7, 1> STATUS_INT_INP_CSYNC; //Needs confirmation
+
+    typedef VReg<0x00, 0x10, 0, 4> STATUS_VDS_FR_NUM;
+    typedef VReg<0x00, 0x10, 4, 1> STATUS_VDS_OUT_VSYNC;
+    typedef VReg<0x00, 0x10, 5, 1> STATUS_VDS_OUT_HSYNC;
+    typedef VReg<0x00, 0x11, 0, 1> STATUS_VDS_FIELD;
+    typedef VReg<0x00, 0x11, 1, 1> STATUS_VDS_OUT_BLANK;
+    typedef VReg<0x00, 0x11, 4, 11> STATUS_VDS_VERT_COUNT;
+
+    typedef VReg<0x00, 0x13, 0, 1> STATUS_MEM_FF_WFF_FIFO_FULL;
+    typedef VReg<0x00, 0x13, 1, 1> STATUS_MEM_FF_WFF_FIFO_EMPTY;
+    typedef VReg<0x00, 0x13, 2, 1> STATUS_MEM_FF_RFF_FIFO_FULL;
+    typedef VReg<0x00, 0x13, 3, 1> STATUS_MEM_FF_RFF_FIFO_EMPTY;
+    typedef VReg<0x00, 0x13, 4, 1> STATUS_MEM_FF_CAP_FIFO_FULL;
+    typedef VReg<0x00, 0x13, 5, 1> STATUS_MEM_FF_CAP_FIFO_EMPTY;
+    typedef VReg<0x00, 0x13, 6, 1> STATUS_MEM_FF_PLY_FIFO_FULL;
+    typedef VReg<0x00, 0x13, 7, 1> STATUS_MEM_FF_PLY_FIFO_EMPTY;
+    typedef VReg<0x00, 0x14, 0, 1> STATUS_MEM_FF_EXT_FIN;
+
+    typedef VReg<0x00, 0x15, 7, 1> STATUS_DEINT_PULLDN;
+
+    typedef VReg<0x00, 0x16, 0, 8> STATUS_16; // whole register for convenience
+    typedef VReg<0x00, 0x16, 0, 1> STATUS_SYNC_PROC_HSPOL;
+    typedef VReg<0x00, 0x16, 1, 1> STATUS_SYNC_PROC_HSACT;
+    typedef VReg<0x00, 0x16, 2, 1> STATUS_SYNC_PROC_VSPOL;
+    typedef VReg<0x00, 0x16, 3, 1> STATUS_SYNC_PROC_VSACT;
+    typedef VReg<0x00, 0x17, 0, 12> STATUS_SYNC_PROC_HTOTAL;
+    typedef VReg<0x00, 0x19, 0, 12> STATUS_SYNC_PROC_HLOW_LEN;
+    typedef VReg<0x00, 0x1B, 0, 11> STATUS_SYNC_PROC_VTOTAL;
+    typedef VReg<0x00, 0x1F, 0, 8> TEST_BUS_1F;
+    typedef VReg<0x00, 0x20, 0, 16> TEST_FF_STATUS;
+    typedef VReg<0x00, 0x23, 0, 8> TEST_BUS_23;
+    typedef VReg<0x00, 0x2E, 0, 16> TEST_BUS;
+    typedef VReg<0x00, 0x2E, 0, 8> TEST_BUS_2E;
+    typedef VReg<0x00, 0x2F, 0, 8> TEST_BUS_2F;
 
     // Miscellaneous Registers
     typedef UReg<0x00, 0x40, 0, 1> PLL_CKIS;
@@ -751,7 +764,7 @@ public:
     typedef UReg<0x05, 0x65, 0, 8> ADC_UNUSED_65;
     typedef UReg<0x05, 0x66, 0, 8> ADC_UNUSED_66;
     typedef UReg<0x05, 0x67, 0, 16> ADC_UNUSED_67; // + ADC_UNUSED_68;
-    typedef UReg<0x05, 0x69, 0, 8> ADC_UNUSED_69;
+    typedef VReg<0x05, 0x69, 0, 8> ADC_UNUSED_69; // power / i2c probe
 
     typedef UReg<0x05, 0xD0, 0, 32> VERYWIDEDUMMYREG;
 
@@ -0,0 +1,207 @@
+#ifndef TV5725SIM_H_
+#define TV5725SIM_H_
+
+// Host side stand-in for the TV5725 on the I2C bus.  Include this instead of
+// tv5725.h in a build without Arduino Wire: it plugs itself in as the tw bus
+// backend and models the six 256 byte segments, the segment register at 0xf0
+// and a few scriptable status registers.  Bus traffic is counted so code
+// paths can be compared by the number of transactions they need.
+
+#include <stdint.h>
+#include <string.h>
+
+class TV5725Sim
+{
+public:
+    struct Stats
+    {
+        uint32_t reads;
+        uint32_t writes;
+        uint32_t bytesRead;
+        uint32_t bytesWritten;
+        uint32_t segmentSwitches;
+    };
+
+    static uint8_t read(uint8_t addr, uint8_t reg, uint8_t *output, uint8_t size)
+    {
+        State &s = state();
+        ++s.stats.reads;
+        s.stats.bytesRead += size;
+        s.clock += busTime(size + 3);
+        for (uint8_t i = 0; i < size; ++i) {
+            uint8_t pos = reg + i;
+            if (addr != s.addr || s.seg >= Segments) {
+                output[i] = 0xff; // nobody answers
+            } else if (pos == SegRegister) {
+                output[i] = s.seg;
+            } else {
+                if (s.seg == 0) {
+                    updateStatus(pos);
+                }
+                output[i] = s.regs[s.seg][pos];
+            }
+        }
+        return addr == s.addr ? 0 : 2; // address NACK
+    }
+
+    static uint8_t write(uint8_t addr, uint8_t reg, uint8_t const *input, uint8_t size)
+    {
+        State &s = state();
+        ++s.stats.writes;
+        s.stats.bytesWritten += size;
+        s.clock += busTime(size + 2);
+        if (addr != s.addr) {
+            return 2; // address NACK
+        }
+        for (uint8_t i = 0; i < size; ++i) {
+            uint8_t pos = reg + i;
+            if (pos == SegRegister) {
+                if (s.seg != input[i]) {
+                    ++s.stats.segmentSwitches;
+                }
+                s.seg = input[i];
+            } else if (s.seg < Segments) {
+                s.regs[s.seg][pos] = input[i];
+            }
+        }
+        return 0;
+    }
+
+    // Simulated microseconds, advanced by bus traffic and advance()
+    static uint32_t now()
+    {
+        return state().clock;
+    }
+
+    // Stand-in for delay() in the code under test
+    static void advance(uint32_t us)
+    {
+        state().clock += us;
+    }
+
+    // Power on state: everything zero, nothing counted, no sync
+    static void reset(uint8_t addr)
+    {
+        State &s = state();
+        memset(&s, 0, sizeof(s));
+        s.addr = addr;
+        s.seg = 0xff;
+    }
+
+    static Stats &stats()
+    {
+        return state().stats;
+    }
+
+    static void resetStats()
+    {
+        memset(&state().stats, 0, sizeof(Stats));
+    }
+
+    // Direct register access, bypassing the bus and the counters
+    static uint8_t peek(uint8_t seg, uint8_t pos)
+    {
+        return state().regs[seg][pos];
+    }
+
+    static void poke(uint8_t seg, uint8_t pos, uint8_t value)
+    {
+        state().regs[seg][pos] = value;
+    }
+
+    // Scripted input: sync activity and the totals the sync processor
+    // measures
+    static void setSync(bool present, uint16_t htotal = 0, uint16_t vtotal = 0)
+    {
+        State &s = state();
+        s.syncPresent = present;
+        s.htotal = present ? htotal : 0;
+        s.vtotal = present ? vtotal : 0;
+    }
+
+    // STATUS_VDS_FIELD flips after this many reads of its byte, 0 keeps it
+    // still
+    static void setFieldPeriod(uint16_t reads)
+    {
+        state().fieldPeriod = reads;
+    }
+
+private:
+    static const uint8_t Segments = 6;
+    static const uint8_t SegRegister = 0xf0;
+
+    struct State
+    {
+        uint8_t addr;
+        uint8_t seg;
+        uint8_t regs[Segments][256];
+        bool syncPresent;
+        uint16_t htotal;
+        uint16_t vtotal;
+        uint16_t fieldPeriod;
+        uint16_t fieldReads;
+        uint32_t clock;
+        Stats stats;
+    };
+
+    static State &state()
+    {
+        static State s;
+        return s;
+    }
+
+    // Microseconds on the wire for a number of bytes at 400kHz, 9 clocks
+    // each
+    static uint32_t busTime(uint16_t bytes)
+    {
+        return bytes * 9 * 10 / 4;
+    }
+
+    // Refresh a segment 0 status byte from the scripted input before it is
+    // read
+    static void updateStatus(uint8_t pos)
+    {
+        State &s = state();
+        uint8_t *seg0 = s.regs[0];
+        switch (pos) {
+            case 0x00: // STATUS_IF_VT_OK, HT_OK, HVT_OK
+                seg0[pos] = (seg0[pos] & ~0x07) | (s.syncPresent ? 0x07 : 0x00);
+                break;
+            case 0x05: // STATUS_IF_NO_SYNC
+                seg0[pos] = (seg0[pos] & ~0x02) | (s.syncPresent ? 0x00 : 0x02);
+                break;
+            case 0x11: // STATUS_VDS_FIELD
+                if (s.fieldPeriod != 0 && ++s.fieldReads >= s.fieldPeriod) {
+                    s.fieldReads = 0;
+                    seg0[pos] ^= 0x01;
+                }
+                break;
+            case 0x16: // STATUS_SYNC_PROC_HSACT, VSACT
+                seg0[pos] = (seg0[pos] & ~0x0a) | (s.syncPresent ? 0x0a : 0x00);
+                break;
+            case 0x17: // STATUS_SYNC_PROC_HTOTAL
+                seg0[pos] = s.htotal & 0xff;
+                break;
+            case 0x18:
+                seg0[pos] = (seg0[pos] & 0xf0) | ((s.htotal >> 8) & 0x0f);
+                break;
+            case 0x1b: // STATUS_SYNC_PROC_VTOTAL
+                seg0[pos] = s.vtotal & 0xff;
+                break;
+            case 0x1c:
+                seg0[pos] = (seg0[pos] & 0xf8) | ((s.vtotal >> 8) & 0x07);
+                break;
+            case 0x2e: // TEST_BUS, sync pulses show up here
+            case 0x2f:
+                seg0[pos] = s.syncPresent ? 0x7f : 0x00;
+                break;
+            default:
+                break;
+        }
+    }
+};
+
+#define TW_BUS TV5725Sim
+#include "tv5725.h"
+
+#endif
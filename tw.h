@@ -1,11 +1,264 @@
 #ifndef TW_H_
 #define TW_H_
 
+// Builds without Arduino Wire (e.g. on a host) define TW_BUS to a class with
+// static read(), write() and now() functions matching WireBus below.
+#ifdef TW_BUS
+#include <stdint.h>
+#include <string.h>
+#else
 #include <Wire.h>
+#endif
+
+// Count bus traffic per register and per caller tag, see tw::Profile
+//#define TW_PROFILE
 
 namespace tw
 {
 
+#ifndef TW_BUS
+    // Default bus backend.  Both calls return 0 on success or the Wire
+    // error code, a short read counts as 4 (other error).
+    struct WireBus
+    {
+        static uint8_t read(uint8_t addr, uint8_t reg, uint8_t *output, uint8_t size)
+        {
+            Wire.beginTransmission(addr);
+            Wire.write(reg);
+            uint8_t status = Wire.endTransmission();
+            Wire.requestFrom(addr, size, static_cast<uint8_t>(true));
+            uint8_t rcvBytes = 0;
+            while (Wire.available()) {
+                output[rcvBytes++] = Wire.read();
+            }
+            if (status == 0 && rcvBytes != size) {
+                status = 4;
+            }
+            return status;
+        }
+
+        static uint8_t write(uint8_t addr, uint8_t reg, uint8_t const *input, uint8_t size)
+        {
+            Wire.beginTransmission(addr);
+            Wire.write(reg);
+            Wire.write(input, size);
+            return Wire.endTransmission();
+        }
+
+        // Time base for status snapshots
+        static uint32_t now()
+        {
+            return micros();
+        }
+    };
+
+#define TW_BUS tw::WireBus
+#endif
+
+    // Number of failed bus transactions (NACKs, short reads) so far.  Wraps
+    // around, callers compare against an earlier value.
+    inline uint16_t &busErrors()
+    {
+        static uint16_t count = 0;
+        return count;
+    }
+
+#ifdef TW_PROFILE
+    // Fixed size bus traffic tables.  Registers are keyed by the segment
+    // last selected plus the offset, callers by the tag set with
+    // TW_PROFILE_TAG.  Whatever doesn't fit any more is summed up in the
+    // last slot.
+    class Profile
+    {
+    public:
+        struct Counter
+        {
+            uint32_t transactions;
+            uint32_t bytes;
+            uint32_t micros;
+
+            void add(uint8_t size, uint32_t us)
+            {
+                ++transactions;
+                bytes += size;
+                micros += us;
+            }
+        };
+
+        // Names the bus traffic of a scope.  Tags nest, a weak tag only
+        // applies if no other tag is active.
+        class Tag
+        {
+        public:
+            Tag(const char *name, bool weak = false) : previous(current())
+            {
+                if (!weak || previous == nullptr) {
+                    current() = name;
+                }
+            }
+
+            ~Tag()
+            {
+                current() = previous;
+            }
+
+        private:
+            const char *previous;
+        };
+
+        // Called whenever the chip switches segments
+        static void segment(uint8_t seg)
+        {
+            Tables &t = tables();
+            t.segment = seg;
+            ++tagSlot(t, current()).switches;
+        }
+
+        static void record(uint8_t reg, uint8_t size, uint32_t us)
+        {
+            Tables &t = tables();
+            regSlot(t, t.segment, reg).counter.add(size, us);
+            tagSlot(t, current()).counter.add(size, us);
+        }
+
+        static void reset()
+        {
+            Tables &t = tables();
+            memset(t.regs, 0, sizeof(t.regs));
+            memset(t.tags, 0, sizeof(t.tags));
+        }
+
+        // Print the busiest registers and callers by bus time
+        static void dump(Print &out, uint8_t topN)
+        {
+            Tables &t = tables();
+            out.println(F("seg_reg   trans   bytes      us"));
+            bool shown[RegSlots] = {false};
+            for (uint8_t n = 0; n < topN; ++n) {
+                int best = -1;
+                for (uint8_t i = 0; i < RegSlots; ++i) {
+                    if (t.regs[i].used && !shown[i] && (best < 0 || t.regs[i].counter.micros > t.regs[best].counter.micros)) {
+                        best = i;
+                    }
+                }
+                if (best < 0) {
+                    break;
+                }
+                shown[best] = true;
+                if (best == RegSlots - 1) {
+                    out.print(F("other  "));
+                } else {
+                    out.print(t.regs[best].seg);
+                    out.print('_');
+                    if (t.regs[best].offset < 0x10) {
+                        out.print('0');
+                    }
+                    out.print(t.regs[best].offset, HEX);
+                    out.print(F("   "));
+                }
+                printCounter(out, t.regs[best].counter);
+            }
+            out.println(F("caller  segsw   trans   bytes      us"));
+            for (uint8_t i = 0; i < TagSlots; ++i) {
+                if (t.tags[i].used) {
+                    out.print(t.tags[i].tag != nullptr ? t.tags[i].tag : "untagged");
+                    out.print(' ');
+                    out.print(t.tags[i].switches);
+                    out.print(' ');
+                    printCounter(out, t.tags[i].counter);
+                }
+            }
+        }
+
+    private:
+        static const uint8_t RegSlots = 48;
+        static const uint8_t TagSlots = 16;
+
+        struct RegEntry
+        {
+            bool used;
+            uint8_t seg;
+            uint8_t offset;
+            Counter counter;
+        };
+
+        struct TagEntry
+        {
+            bool used;
+            const char *tag;
+            Counter counter;
+            uint32_t switches;
+        };
+
+        struct Tables
+        {
+            uint8_t segment;
+            RegEntry regs[RegSlots];
+            TagEntry tags[TagSlots];
+        };
+
+        static Tables &tables()
+        {
+            static Tables t;
+            return t;
+        }
+
+        static const char *&current()
+        {
+            static const char *tag = nullptr;
+            return tag;
+        }
+
+        static RegEntry &regSlot(Tables &t, uint8_t seg, uint8_t offset)
+        {
+            for (uint8_t i = 0; i < RegSlots - 1; ++i) {
+                RegEntry &e = t.regs[i];
+                if (!e.used) {
+                    e.used = true;
+                    e.seg = seg;
+                    e.offset = offset;
+                }
+                if (e.seg == seg && e.offset == offset) {
+                    return e;
+                }
+            }
+            t.regs[RegSlots - 1].used = true;
+            return t.regs[RegSlots - 1];
+        }
+
+        static TagEntry &tagSlot(Tables &t, const char *tag)
+        {
+            for (uint8_t i = 0; i < TagSlots - 1; ++i) {
+                TagEntry &e = t.tags[i];
+                if (!e.used) {
+                    e.used = true;
+                    e.tag = tag;
+                }
+                if (e.tag == tag) {
+                    return e;
+                }
+            }
+            t.tags[TagSlots - 1].used = true;
+            return t.tags[TagSlots - 1];
+        }
+
+        static void printCounter(Print &out, const Counter &c)
+        {
+            out.print(c.transactions);
+            out.print(' ');
+            out.print(c.bytes);
+            out.print(' ');
+            out.println(c.micros);
+        }
+    };
+
+#define TW_PROFILE_TAG(name) tw::Profile::Tag twProfileTag_(name)
+#define TW_PROFILE_WEAK_TAG(name) tw::Profile::Tag twProfileTag_(name, true)
+#else
+#define TW_PROFILE_TAG(name)
+#define TW_PROFILE_WEAK_TAG(name)
+#endif
+
     enum class Signage {
         UNSIGNED,
         SIGNED
@@ -65,15 +318,15 @@ namespace tw
 
         inline void rawRead(uint8_t addr, uint8_t reg, uint8_t *output, uint8_t size)
         {
-            Wire.beginTransmission(addr);
-            Wire.write(reg);
-            Wire.endTransmission();
-            Wire.requestFrom(addr, size, static_cast<uint8_t>(true));
-            uint8_t rcvBytes = 0;
-            while (Wire.available()) {
-                output[rcvBytes++] = Wire.read();
+#ifdef TW_PROFILE
+            uint32_t started = micros();
+#endif
+            if (TW_BUS::read(addr, reg, output, size) != 0) {
+                ++busErrors();
             }
-
+#ifdef TW_PROFILE
+            Profile::record(reg, size, micros() - started);
+#endif
 #if 0
   Serial.print("READ "); Serial.print(addr, HEX); Serial.print("@"); Serial.print(reg, HEX); Serial.print(": ");
   for (uint8_t i = 0; i < size; ++i) {
@@ -92,10 +345,15 @@ namespace tw
   }
   Serial.println();
 #endif
-            Wire.beginTransmission(addr);
-            Wire.write(reg);
-            Wire.write(input, size);
-            Wire.endTransmission();
+#ifdef TW_PROFILE
+            uint32_t started = micros();
+#endif
+            if (TW_BUS::write(addr, reg, input, size) != 0) {
+                ++busErrors();
+            }
+#ifdef TW_PROFILE
+            Profile::record(reg, size, micros() - started);
+#endif
         }
 
         // Number of bytes covered by a register with a particular offset and
@@ -175,15 +433,164 @@ namespace tw
             }
         }
 
+        // Register layout without an address, for working out byte coverage
+        // of a single register relative to its first byte
+        template <uint8_t ByteOffset, uint8_t BitOffset, uint8_t BitWidth>
+        struct RegShape
+        {
+            static const uint8_t byteOffset = ByteOffset;
+            static const uint8_t bitOffset = BitOffset;
+            static const uint8_t bitWidth = BitWidth;
+        };
+
+        static constexpr int minOf(int a, int b)
+        {
+            return a < b ? a : b;
+        }
+
+        static constexpr int maxOf(int a, int b)
+        {
+            return a > b ? a : b;
+        }
+
+        // Mask of bits lo up to (excluding) hi within a byte
+        static constexpr uint8_t bitMask(int lo, int hi)
+        {
+            return hi <= lo ? 0 : static_cast<uint8_t>(((1u << hi) - 1) & ~((1u << lo) - 1));
+        }
+
+        // Bits of a byte that a register covers, rel being the bit position
+        // of that byte relative to the register's first byte
+        template <class Reg>
+        constexpr uint8_t regByteMask(int rel)
+        {
+            return bitMask(maxOf(Reg::bitOffset, rel) - rel, minOf(Reg::bitOffset + Reg::bitWidth, rel + 8) - rel);
+        }
+
+        // Bits of the byte at offset pos that a register covers
+        template <class Reg>
+        constexpr uint8_t regCoverMask(uint8_t pos)
+        {
+            return pos < Reg::byteOffset || pos >= Reg::byteOffset + byteSize(Reg::bitOffset, Reg::bitWidth)
+                       ? 0
+                       : regByteMask<Reg>(8 * (pos - Reg::byteOffset));
+        }
+
+        // Template to compute which bits of each byte a list of registers
+        // covers, independent of the order they are listed in
+        template <class... Regs>
+        struct RegCover
+        {
+        };
+
+        template <>
+        struct RegCover<>
+        {
+            static constexpr uint8_t mask(uint8_t)
+            {
+                return 0;
+            }
+        };
+
+        template <class Reg, class... Tail>
+        struct RegCover<Reg, Tail...>
+        {
+            static constexpr uint8_t mask(uint8_t pos)
+            {
+                return regCoverMask<Reg>(pos) | RegCover<Tail...>::mask(pos);
+            }
+        };
+
+        // Scans over [pos, end) for the first byte that is covered at all,
+        // the first byte that isn't, and the first byte that is only
+        // partially covered.  Each returns end if there is no such byte.
+        template <class Cover>
+        constexpr uint8_t nextCovered(uint8_t pos, uint8_t end)
+        {
+            return pos >= end ? end : Cover::mask(pos) != 0 ? pos : nextCovered<Cover>(pos + 1, end);
+        }
+
+        template <class Cover>
+        constexpr uint8_t nextUncovered(uint8_t pos, uint8_t end)
+        {
+            return pos >= end ? end : Cover::mask(pos) == 0 ? pos : nextUncovered<Cover>(pos + 1, end);
+        }
+
+        template <class Cover>
+        constexpr uint8_t nextPartial(uint8_t pos, uint8_t end)
+        {
+            return pos >= end ? end : Cover::mask(pos) != 0xFF ? pos : nextPartial<Cover>(pos + 1, end);
+        }
+
+        // One past the last partially covered byte in [start, end), or
+        // start if there is none
+        template <class Cover>
+        constexpr uint8_t partialEnd(uint8_t end, uint8_t start)
+        {
+            return end <= start ? start : Cover::mask(end - 1) != 0xFF ? end : partialEnd<Cover>(end - 1, start);
+        }
+
+        // Splits [Pos, End) into runs of covered bytes at compile time.
+        // A write only touches the bytes its registers cover, and only the
+        // partially covered bytes of each run (plus whatever lies between
+        // them) have to be read back first.  Fully covered bytes are
+        // written blind.
+        template <class Cover, uint8_t Pos, uint8_t End, bool Done = (nextCovered<Cover>(Pos, End) >= End)>
+        struct CoverRuns
+        {
+        private:
+            static const uint8_t runStart = nextCovered<Cover>(Pos, End);
+            static const uint8_t runEnd = nextUncovered<Cover>(runStart, End);
+            static const uint8_t readStart = nextPartial<Cover>(runStart, runEnd);
+            static const uint8_t readEnd = partialEnd<Cover>(runEnd, readStart);
+            typedef CoverRuns<Cover, runEnd, End> Next;
+
+        public:
+            static const uint8_t count = 1 + Next::count;
+
+            // Calls read(pos, size) for every span that needs reading
+            template <class Read>
+            static void read(Read read)
+            {
+                if (readEnd > readStart) {
+                    read(readStart, readEnd - readStart);
+                }
+                Next::read(read);
+            }
+
+            // Calls write(pos, size) for every run
+            template <class Write>
+            static void write(Write write)
+            {
+                write(runStart, runEnd - runStart);
+                Next::write(write);
+            }
+        };
+
+        template <class Cover, uint8_t Pos, uint8_t End>
+        struct CoverRuns<Cover, Pos, End, true>
+        {
+            static const uint8_t count = 0;
+
+            template <class Read>
+            static void read(Read)
+            {
+            }
+
+            template <class Write>
+            static void write(Write)
+            {
+            }
+        };
+
         template <uint8_t BitOffset, uint8_t BitWidth>
         void regWrite(uint8_t addr, uint8_t offset, RegValue<BitWidth, Signage::UNSIGNED> value)
         {
             static const uint8_t bs = byteSize(BitOffset, BitWidth);
+            typedef CoverRuns<RegCover<RegShape<0, BitOffset, BitWidth>>, 0, bs> Runs;
             uint8_t data[bs];
-            if (BitOffset == 0 && BitWidth % 8 == 0)
-                memset(data, 0, sizeof(data));
-            else
-                rawRead(addr, offset, data, bs);
+            memset(data, 0, sizeof(data));
+            Runs::read([=, &data](uint8_t pos, uint8_t size) { rawRead(addr, offset + pos, data + pos, size); });
             regEncode<BitOffset, BitWidth>(value, data);
             rawWrite(addr, offset, data, bs);
         }
@@ -236,6 +643,151 @@ namespace tw
             static constexpr SegValue segment = Reg1::segment;
         };
 
+        // Template to check whether any register in a list bypasses the
+        // shadow copy.
+        template <class... Regs>
+        struct AnyVolatile
+        {
+            static const bool value = false;
+        };
+
+        template <class Reg, class... Tail>
+        struct AnyVolatile<Reg, Tail...>
+        {
+            static const bool value = Reg::isVolatile || AnyVolatile<Tail...>::value;
+        };
+
+        // RAM copy of a segmented register file.  Bytes become valid when
+        // they are written or read through the register templates and stay
+        // valid until invalidate() is called, so config registers only need
+        // to be fetched from the bus once.
+        //
+        // While a transaction is open (depth > 0) writes are only staged
+        // here and marked dirty; they reach the chip when the outermost
+        // transaction ends or something needs the bus.
+        template <uint8_t Segments>
+        class Shadow
+        {
+        public:
+            bool enabled;
+            uint8_t depth;
+            bool pending;
+
+            bool lookup(uint8_t seg, uint8_t offset, uint8_t *output, uint8_t size) const
+            {
+                if (!enabled || seg >= Segments) {
+                    return false;
+                }
+                for (uint8_t i = 0; i < size; ++i) {
+                    uint8_t pos = offset + i;
+                    if (!(valid[seg][pos >> 3] & (1 << (pos & 7)))) {
+                        return false;
+                    }
+                }
+                memcpy(output, &data[seg][offset], size);
+                return true;
+            }
+
+            void store(uint8_t seg, uint8_t offset, uint8_t const *input, uint8_t size)
+            {
+                if (!enabled || seg >= Segments) {
+                    return;
+                }
+                for (uint8_t i = 0; i < size; ++i) {
+                    uint8_t pos = offset + i;
+                    data[seg][pos] = input[i];
+                    valid[seg][pos >> 3] |= (1 << (pos & 7));
+                }
+            }
+
+            // Store and mark dirty instead of writing.  Returns false if the
+            // caller has to write through.
+            bool stage(uint8_t seg, uint8_t offset, uint8_t const *input, uint8_t size)
+            {
+                if (!enabled || depth == 0 || seg >= Segments) {
+                    return false;
+                }
+                store(seg, offset, input, size);
+                for (uint8_t i = 0; i < size; ++i) {
+                    uint8_t pos = offset + i;
+                    dirty[seg][pos >> 3] |= (1 << (pos & 7));
+                }
+                pending = true;
+                return true;
+            }
+
+            // Find the next run of dirty bytes in a segment at or after pos,
+            // at most maxSize long, and mark it clean.  pos is advanced past
+            // the run.
+            bool takeRun(uint8_t seg, uint16_t &pos, uint8_t &start, uint8_t &size, uint8_t maxSize)
+            {
+                while (pos < 256 && !isDirty(seg, pos)) {
+                    ++pos;
+                }
+                if (pos >= 256) {
+                    return false;
+                }
+                start = pos;
+                size = 0;
+                while (pos < 256 && size < maxSize && isDirty(seg, pos)) {
+                    dirty[seg][pos >> 3] &= ~(1 << (pos & 7));
+                    ++pos;
+                    ++size;
+                }
+                return true;
+            }
+
+            uint8_t const *bytes(uint8_t seg, uint8_t offset) const
+            {
+                return &data[seg][offset];
+            }
+
+            void invalidate()
+            {
+                memset(valid, 0, sizeof(valid));
+                memset(dirty, 0, sizeof(dirty));
+                pending = false;
+            }
+
+        private:
+            bool isDirty(uint8_t seg, uint16_t pos) const
+            {
+                return dirty[seg][pos >> 3] & (1 << (pos & 7));
+            }
+
+            uint8_t data[Segments][256];
+            uint8_t valid[Segments][32];
+            uint8_t dirty[Segments][32];
+        };
+
+        // No shadow copy configured: everything goes to the bus
+        template <>
+        class Shadow<0>
+        {
+        public:
+            bool enabled;
+            uint8_t depth;
+            bool pending;
+
+            bool lookup(uint8_t, uint8_t, uint8_t *, uint8_t) const { return false; }
+            void store(uint8_t, uint8_t, uint8_t const *, uint8_t) {}
+            bool stage(uint8_t, uint8_t, uint8_t const *, uint8_t) { return false; }
+            bool takeRun(uint8_t, uint16_t &, uint8_t &, uint8_t &, uint8_t) { return false; }
+            uint8_t const *bytes(uint8_t, uint8_t) const { return nullptr; }
+            void invalidate() {}
+        };
+
+        // Burst copy of a slave's volatile status block, see
+        // SegmentedSlave::StatusSnapshot
+        template <uint8_t Size>
+        struct StatusBlock
+        {
+            uint8_t data[Size];
+            uint8_t depth;  // nesting of held snapshots
+            bool valid;     // data was read and nothing was written since
+            uint32_t taken; // TW_BUS::now() of the burst
+        };
+
     } // namespace detail
 
     template <uint8_t Addr>
@@ -296,15 +848,13 @@ namespace tw
                 static const uint8_t start = detail::RegRange<Regs...>::start;
                 static const uint8_t end = detail::RegRange<Regs...>::end;
                 static const uint8_t size = end - start;
+                typedef detail::CoverRuns<detail::RegCover<Regs...>, start, end> Runs;
                 uint8_t data[size];
-                // FIXME: we can avoid this if registers are contiguous and
-                // aligned to byte boundaries at both start and end.  The
-                // template logic for determining this would be a bit complex
-                // since we would need to sort the register list first.
-                detail::rawRead(Addr, start, data, size);
+                memset(data, 0, sizeof(data));
+                Runs::read([&data](uint8_t pos, uint8_t n) { detail::rawRead(Addr, pos, data + pos - start, n); });
                 int dummy[] __attribute__((unused)) = {
                     (detail::regEncode<Regs::bitOffset, Regs::bitWidth>(values, data + Regs::byteOffset - start), 0)...};
-                detail::rawWrite(Addr, start, data, size);
+                Runs::write([&data](uint8_t pos, uint8_t n) { detail::rawWrite(Addr, pos, data + pos - start, n); });
             }
         };
     };
@@ -322,36 +872,180 @@ namespace tw
         typedef typename Segment::Value SegValue;
 
     private:
+        // Longest burst per transmission, leaving room for the register
+        // address in the Wire buffer
+#ifdef BUFFER_LENGTH
+        static const uint8_t maxBurst = BUFFER_LENGTH - 1;
+#else
+        static const uint8_t maxBurst = 31;
+#endif
+
+        // The segment the chip currently has selected, SegInitial if
+        // unknown.  Everything that writes the segment register updates
+        // it.
+        static SegValue &curSeg()
+        {
+            static SegValue seg = Attrs::SegInitial;
+            return seg;
+        }
+
+        static uint32_t &switchCount()
+        {
+            static uint32_t count = 0;
+            return count;
+        }
+
+        static void trackSeg(SegValue seg)
+        {
+            if (curSeg() != seg) {
+                curSeg() = seg;
+                ++switchCount();
+#ifdef TW_PROFILE
+                Profile::segment(seg);
+#endif
+            }
+        }
+
         static void setSeg(SegValue seg)
         {
-            static SegValue curSeg = Attrs::SegInitial;
-            if (curSeg != seg) {
+            if (curSeg() != seg) {
                 Segment::write(seg);
-                curSeg = seg;
+                trackSeg(seg);
+            }
+        }
+
+        static detail::StatusBlock<Attrs::StatusEnd - Attrs::StatusStart> &status()
+        {
+            static detail::StatusBlock<Attrs::StatusEnd - Attrs::StatusStart> s;
+            return s;
+        }
+
+        // Serve a volatile read from the status snapshot, if one is held
+        // and the read lies inside the status block.  The burst is (re)taken
+        // when there is none yet or it is too old.
+        static bool statusLookup(SegValue seg, uint8_t offset, uint8_t *output, uint8_t size)
+        {
+            detail::StatusBlock<Attrs::StatusEnd - Attrs::StatusStart> &st = status();
+            uint8_t rel = offset - Attrs::StatusStart; // wraps for offsets below the block
+            if (st.depth == 0 || seg != Attrs::StatusSegment || rel + size > sizeof(st.data)) {
+                return false;
+            }
+            if (!st.valid || TW_BUS::now() - st.taken >= Attrs::StatusMaxAge) {
+                flush();
+                setSeg(seg);
+                detail::rawRead(Addr, Attrs::StatusStart, st.data, sizeof(st.data));
+                st.valid = true;
+                st.taken = TW_BUS::now();
+            }
+            memcpy(output, st.data + rel, size);
+            return true;
+        }
+
+        static detail::Shadow<Attrs::ShadowSegments> &shadow()
+        {
+            static detail::Shadow<Attrs::ShadowSegments> s;
+            return s;
+        }
+
+        static bool unchanged(SegValue seg, uint8_t offset, uint8_t value)
+        {
+            uint8_t current;
+            return shadow().lookup(seg, offset, &current, 1) && current == value;
+        }
+
+        // Send one run of staged writes, preferring the selected segment.
+        // Returns false once nothing is pending.
+        static bool sendRun()
+        {
+            detail::Shadow<Attrs::ShadowSegments> &s = shadow();
+            if (!s.pending) {
+                return false;
+            }
+            if (curSeg() < Attrs::ShadowSegments && sendRun(curSeg())) {
+                return true;
+            }
+            for (uint8_t seg = 0; seg < Attrs::ShadowSegments; ++seg) {
+                if (sendRun(seg)) {
+                    return true;
+                }
+            }
+            s.pending = false;
+            return false;
+        }
+
+        static bool sendRun(SegValue seg)
+        {
+            detail::Shadow<Attrs::ShadowSegments> &s = shadow();
+            uint16_t pos = 0;
+            uint8_t start, size;
+            if (!s.takeRun(seg, pos, start, size, maxBurst)) {
+                return false;
+            }
+            setSeg(seg);
+            detail::rawWrite(Addr, start, s.bytes(seg, start), size);
+            return true;
+        }
+
+        static void (*&idleHook())()
+        {
+            static void (*hook)() = nullptr;
+            return hook;
+        }
+
+        static void idle()
+        {
+            static bool running = false;
+            if (idleHook() != nullptr && !running) {
+                running = true;
+                idleHook()();
+                running = false;
+            }
+        }
+
+        // Fill output with the current register contents, from the shadow
+        // copy if possible.  Volatile registers come from the bus (or a held
+        // status snapshot) and are never stored.
+        static void fetch(SegValue seg, uint8_t offset, uint8_t *output, uint8_t size, bool isVolatile)
+        {
+            if (isVolatile ? statusLookup(seg, offset, output, size) : shadow().lookup(seg, offset, output, size)) {
+                return;
+            }
+            flush();
+            setSeg(seg);
+            detail::rawRead(Addr, offset, output, size);
+            if (!isVolatile) {
+                shadow().store(seg, offset, output, size);
             }
         }
 
     public:
-        template <SegValue Seg, uint8_t ByteOffset, uint8_t BitOffset, uint8_t BitWidth, Signage Signed>
+        template <SegValue Seg, uint8_t ByteOffset, uint8_t BitOffset, uint8_t BitWidth, Signage Signed, bool Volatile = false>
         class Register : public BaseReg<ByteOffset, BitOffset, BitWidth, Signed>
         {
         private:
             typedef BaseReg<ByteOffset, BitOffset, BitWidth, Signed> Base;
+            static const uint8_t bs = detail::byteSize(BitOffset, BitWidth);
 
         public:
             typedef typename Base::Value Value;
             static const SegValue segment = Seg;
+            static const bool isVolatile = Volatile;
 
             static Value read(void)
             {
-                setSeg(Seg);
-                return Base::read();
+                uint8_t data[bs];
+                fetch(Seg, ByteOffset, data, bs, Volatile);
+                return detail::regDecode<BitOffset, BitWidth>(data);
             }
 
             static void write(Value value)
             {
-                setSeg(Seg);
-                Base::write(value);
+                typedef detail::CoverRuns<detail::RegCover<Base>, ByteOffset, ByteOffset + bs> Runs;
+                uint8_t data[bs];
+                memset(data, 0, sizeof(data));
+                Runs::read([&data](uint8_t pos, uint8_t n) { fetch(Seg, pos, data + pos - ByteOffset, n, Volatile); });
+                detail::regEncode<BitOffset, BitWidth>(value, data);
+                SegmentedSlave::write(Seg, ByteOffset, data, bs);
             }
         };
 
@@ -361,24 +1055,36 @@ namespace tw
         private:
             static_assert(detail::SegCompatible<SegValue, Regs...>::compatible, "Tied registers must all be in the same segment");
             static const SegValue segment = detail::SegCompatible<SegValue, Regs...>::segment;
-            typedef typename Base::template Tie<Regs...> BaseTie;
+            static const bool isVolatile = detail::AnyVolatile<Regs...>::value;
+            static const uint8_t start = detail::RegRange<Regs...>::start;
+            static const uint8_t end = detail::RegRange<Regs...>::end;
+            static const uint8_t size = end - start;
 
         public:
             static void read(typename Regs::Value &... values)
             {
-                setSeg(segment);
-                BaseTie::read(values...);
+                uint8_t data[size];
+                fetch(segment, start, data, size, isVolatile);
+                int dummy[] __attribute__((unused)) = {
+                    (values = detail::regDecode<Regs::bitOffset, Regs::bitWidth>(data + Regs::byteOffset - start), 0)...};
             }
 
             static void write(typename Regs::Value... values)
             {
-                setSeg(segment);
-                BaseTie::write(values...);
+                typedef detail::CoverRuns<detail::RegCover<Regs...>, start, end> Runs;
+                uint8_t data[size];
+                memset(data, 0, sizeof(data));
+                Runs::read([&data](uint8_t pos, uint8_t n) { fetch(segment, pos, data + pos - start, n, isVolatile); });
+                int dummy[] __attribute__((unused)) = {
+                    (detail::regEncode<Regs::bitOffset, Regs::bitWidth>(values, data + Regs::byteOffset - start), 0)...};
+                Runs::write([&data](uint8_t pos, uint8_t n) { SegmentedSlave::write(segment, pos, data + pos - start, n); });
             }
         };
 
+        // Raw reads always go to the bus
         static void read(SegValue seg, uint8_t offset, uint8_t *output, uint8_t size)
         {
+            flush();
             setSeg(seg);
             detail::rawRead(Addr, offset, output, size);
         }
@@ -392,14 +1098,201 @@ namespace tw
 
         static void write(SegValue seg, uint8_t offset, uint8_t const *input, uint8_t size)
         {
+            // Writes touching the segment register itself are never staged,
+            // a commit must not switch segments behind setSeg's back
+            bool coversSeg = offset <= Attrs::SegByteOffset && offset + size > Attrs::SegByteOffset;
+            status().valid = false; // the chip may report something else now
+            if (!coversSeg && shadow().stage(seg, offset, input, size)) {
+                return;
+            }
+            flush();
             setSeg(seg);
             detail::rawWrite(Addr, offset, input, size);
+            if (!coversSeg) {
+                shadow().store(seg, offset, input, size);
+                return;
+            }
+            // The chip switched segments in the middle of this burst, the
+            // bytes after the segment register went to the new one
+            uint8_t before = Attrs::SegByteOffset - offset;
+            uint8_t after = size - before - 1;
+            shadow().store(seg, offset, input, before);
+            trackSeg(input[before]);
+            shadow().store(input[before], Attrs::SegByteOffset + 1, input + before + 1, after);
         }
 
         static void write(SegValue seg, uint8_t offset, uint8_t value)
         {
             write(seg, offset, &value, sizeof(value));
         }
+
+        // Write only the bytes that differ from the shadow copy.  Bytes the
+        // shadow doesn't know count as changed.  Unchanged gaps of up to
+        // two bytes are sent along rather than starting a new burst.
+        // Returns the number of bytes sent.
+        static uint8_t writeChanged(SegValue seg, uint8_t offset, uint8_t const *input, uint8_t size)
+        {
+            uint8_t sent = 0;
+            uint8_t pos = 0;
+            while (pos < size) {
+                if (unchanged(seg, offset + pos, input[pos])) {
+                    ++pos;
+                    continue;
+                }
+                uint8_t start = pos;
+                uint8_t end = ++pos;
+                while (pos < size && pos - end <= 2) {
+                    if (!unchanged(seg, offset + pos, input[pos])) {
+                        end = pos + 1;
+                    }
+                    ++pos;
+                }
+                pos = end;
+                write(seg, offset + start, input + start, end - start);
+                sent += end - start;
+            }
+            return sent;
+        }
+
+        // Turning the shadow copy on or off always drops its contents and
+        // forgets the selected segment.  Call with false whenever the chip
+        // may have lost its registers.
+        static void shadowEnable(bool enable)
+        {
+            shadow().invalidate();
+            shadow().enabled = enable;
+            curSeg() = Attrs::SegInitial;
+        }
+
+        static void shadowInvalidate()
+        {
+            shadow().invalidate();
+        }
+
+        // Send all staged writes to the chip.  Each contiguous run of dirty
+        // bytes becomes one burst.  The selected segment is finished first,
+        // then the others in order, so every segment is selected at most
+        // once.  Repeated writes to the same byte collapse into the last
+        // value, so strobes, latches and writes that must settle before a
+        // delay() need an explicit flush().  The idle hook runs between
+        // bursts.
+        static void flush()
+        {
+            while (sendRun()) {
+                idle();
+            }
+        }
+
+        // Send at most bursts runs of staged writes, for draining a
+        // Deferred program from loop().  Returns true once nothing is left.
+        static bool pump(uint8_t bursts)
+        {
+            if (shadow().depth > 0) {
+                return false; // still being recorded
+            }
+            while (bursts-- > 0 && sendRun()) {
+            }
+            return !shadow().pending;
+        }
+
+        // Called between bursts while a long program is being sent, e.g.
+        // to keep the network stack serviced.  The hook may use the bus
+        // itself, it is just not called again from there.
+        static void setIdleHook(void (*hook)())
+        {
+            idleHook() = hook;
+        }
+
+        // Number of segment register writes so far, for comparing code
+        // paths
+        static uint32_t segmentSwitches()
+        {
+            return switchCount();
+        }
+
+        // Scoped transaction: register writes inside it are coalesced in
+        // the shadow copy and committed when the outermost one ends.
+        // Reads that have to go to the bus flush first, so they always see
+        // what was written before them.  Without a shadow copy (or while
+        // it is disabled) writes simply go straight through.
+        class Transaction
+        {
+        public:
+            Transaction()
+            {
+                ++shadow().depth;
+            }
+
+            ~Transaction()
+            {
+                if (--shadow().depth == 0) {
+                    flush();
+                }
+            }
+
+            Transaction(const Transaction &) = delete;
+            Transaction &operator=(const Transaction &) = delete;
+        };
+
+        // Scoped status snapshot: volatile reads inside the status block
+        // (StatusStart up to StatusEnd in StatusSegment, see Attrs) are
+        // decoded from one burst read, so they describe the chip at the same
+        // moment and cost one transaction together.  The burst is taken on
+        // the first such read and taken again after any write through this
+        // slave or once it is StatusMaxAge microseconds old, so polling
+        // loops that wait in between still see new values.
+        class StatusSnapshot
+        {
+        public:
+            StatusSnapshot()
+            {
+                ++status().depth;
+            }
+
+            ~StatusSnapshot()
+            {
+                if (--status().depth == 0) {
+                    status().valid = false;
+                }
+            }
+
+            // Same as Reg::read(), but only compiles for registers the
+            // snapshot covers
+            template <class Reg>
+            typename Reg::Value get() const
+            {
+                static_assert(Reg::isVolatile && Reg::segment == Attrs::StatusSegment &&
+                                  Reg::byteOffset >= Attrs::StatusStart &&
+                                  Reg::byteOffset + detail::byteSize(Reg::bitOffset, Reg::bitWidth) <= Attrs::StatusEnd,
+                              "Register is not part of the status block");
+                return Reg::read();
+            }
+
+            StatusSnapshot(const StatusSnapshot &) = delete;
+            StatusSnapshot &operator=(const StatusSnapshot &) = delete;
+        };
+
+        // Like a transaction, but ending it only queues the staged writes.
+        // They go out through pump() or, at the latest, right before the
+        // next bus access that isn't staged (any read that misses the
+        // shadow copy, write-throughs, flush()), so the chip always sees
+        // them before anything issued later.  flush() awaits completion.
+        class Deferred
+        {
+        public:
+            Deferred()
+            {
+                ++shadow().depth;
+            }
+
+            ~Deferred()
+            {
+                --shadow().depth;
+            }
+
+            Deferred(const Deferred &) = delete;
+            Deferred &operator=(const Deferred &) = delete;
+        };
     };
 
 } // namespace tw
@@ -1,5 +1,5 @@
 const uint8_t webui_html[] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x08, 0xe5, 0xc0, 0xf4, 0x64, 0x02, 0x03, 0x77, 0x65,
+  0x1f, 0x8b, 0x08, 0x08, 0xcb, 0x14, 0xd2, 0x6a, 0x02, 0x03, 0x77, 0x65,
   0x62, 0x75, 0x69, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x00, 0xbc, 0xfd, 0x6d,
   0xb3, 0xab, 0xba, 0x96, 0x2e, 0x08, 0x7e, 0xcf, 0x5f, 0xb1, 0xfb, 0x54,
   0x74, 0x44, 0xc7, 0x5d, 0x79, 0x62, 0xf2, 0x62, 0x3c, 0xa7, 0xf3, 0xe5,
@@ -13314,886 +13314,888 @@ const uint8_t webui_html[] PROGMEM = {
   0x7c, 0xbf, 0xbc, 0x4b, 0xf7, 0x2d, 0xe7, 0xbf, 0x8d, 0xd5, 0x3e, 0xa5,
   0x00, 0xcd, 0xb4, 0xea, 0x38, 0xac, 0x41, 0x28, 0x0e, 0xda, 0x9e, 0x06,
   0xb5, 0x82, 0x78, 0x78, 0x1e, 0x53, 0x7b, 0xb1, 0xc4, 0xaf, 0xf1, 0x9d,
-  0xff, 0xaf, 0xbd, 0xaf, 0x6d, 0x6b, 0x1b, 0x59, 0x16, 0xfc, 0x9e, 0x5f,
-  0xa1, 0xd1, 0xcd, 0x93, 0xd8, 0x83, 0x31, 0x98, 0xbc, 0x1e, 0x18, 0x92,
-  0x87, 0x40, 0x32, 0xe1, 0x4e, 0x12, 0xb8, 0x31, 0x99, 0xec, 0x5d, 0x0e,
-  0x0f, 0xc8, 0xb6, 0x00, 0x4d, 0x8c, 0xe5, 0x23, 0xc9, 0x21, 0x0c, 0xc7,
-  0xfb, 0xdb, 0xb7, 0xaa, 0xba, 0x5b, 0xea, 0x57, 0x49, 0xc6, 0x26, 0x21,
-  0x7b, 0x37, 0x1f, 0x14, 0x2c, 0x75, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
-  0x57, 0x57, 0x55, 0x27, 0xb4, 0xe5, 0x64, 0xb7, 0x70, 0x92, 0xf2, 0x3e,
-  0x1e, 0xe3, 0x4b, 0xdc, 0x90, 0x03, 0x90, 0xb0, 0x6a, 0x2b, 0x70, 0x70,
-  0x09, 0x7a, 0x53, 0x98, 0x9d, 0xc7, 0x03, 0x76, 0x03, 0x5a, 0xf0, 0x35,
-  0x88, 0x86, 0x38, 0xee, 0x6d, 0xef, 0x00, 0x26, 0x07, 0xe3, 0x05, 0xda,
-  0xea, 0xf3, 0x42, 0x11, 0x57, 0xd6, 0xb8, 0x2a, 0xe6, 0x9d, 0xc5, 0xcc,
-  0x60, 0x37, 0xfa, 0xe2, 0x89, 0x09, 0x96, 0xe6, 0xf6, 0xbe, 0xe1, 0x22,
-  0x36, 0x07, 0xb3, 0xb1, 0x87, 0xc4, 0x12, 0xc1, 0x60, 0x00, 0x98, 0x1f,
-  0x53, 0xb8, 0x27, 0x85, 0xc7, 0xa8, 0xc3, 0x3e, 0xcb, 0x94, 0xad, 0x39,
-  0x83, 0xca, 0x23, 0xc4, 0x6f, 0x2d, 0xea, 0xa0, 0xb0, 0xb7, 0x89, 0x0e,
-  0x62, 0xff, 0xee, 0xc0, 0x5c, 0x2d, 0x1b, 0x8c, 0x2e, 0xe1, 0x4c, 0x23,
-  0xe1, 0xbd, 0x27, 0xe6, 0xba, 0xcd, 0x01, 0x89, 0xbe, 0xc3, 0x80, 0xa4,
-  0xd9, 0x15, 0x7a, 0x5b, 0xf7, 0x27, 0x49, 0x1a, 0x27, 0xeb, 0xde, 0x38,
-  0xa6, 0x70, 0x83, 0x7a, 0xc3, 0x40, 0x77, 0x37, 0xd3, 0xcc, 0xbe, 0x6b,
-  0x22, 0x73, 0x27, 0x8f, 0x9a, 0x08, 0xf9, 0x38, 0xfd, 0x20, 0x8d, 0x80,
-  0xdd, 0xb2, 0x08, 0x12, 0x48, 0xa0, 0x33, 0x20, 0x87, 0x6b, 0xd8, 0x6a,
-  0x93, 0xe4, 0xc4, 0xfb, 0xd3, 0x60, 0x07, 0xc8, 0xc4, 0x0e, 0x67, 0xeb,
-  0xb4, 0x56, 0xcc, 0x47, 0xae, 0x86, 0xc7, 0x3d, 0xde, 0xc3, 0x75, 0x0f,
-  0xb8, 0x02, 0xcf, 0x2e, 0x08, 0x16, 0x6c, 0x2d, 0x15, 0x30, 0xb4, 0xd9,
-  0x04, 0x7e, 0x06, 0x04, 0x86, 0xc1, 0x19, 0x59, 0x37, 0x4f, 0x91, 0x37,
-  0xc2, 0x04, 0x54, 0x0a, 0x6e, 0x6b, 0xed, 0xc7, 0x17, 0x3d, 0x90, 0xcb,
-  0x03, 0xa6, 0x55, 0x4b, 0x51, 0x63, 0x65, 0x08, 0xbc, 0x8f, 0x69, 0x5d,
-  0xd8, 0x1a, 0x04, 0x63, 0x5c, 0xa6, 0xd6, 0x3d, 0xe6, 0xe3, 0x91, 0x0a,
-  0xf0, 0xd4, 0xcf, 0xf4, 0x3c, 0xbe, 0x4c, 0x99, 0xc1, 0x15, 0x74, 0xa0,
-  0x90, 0x05, 0xa1, 0x44, 0x23, 0x0f, 0x4a, 0xa2, 0x9c, 0x06, 0x2a, 0x81,
-  0x04, 0xaf, 0x68, 0x08, 0x76, 0xdc, 0xe3, 0x38, 0x4d, 0xd1, 0x0a, 0xdb,
-  0x42, 0x22, 0x9e, 0x46, 0x67, 0x98, 0xd7, 0x8f, 0x0e, 0x42, 0x68, 0xaf,
-  0x4d, 0xb6, 0x26, 0xd0, 0x93, 0xce, 0x60, 0x1f, 0x9d, 0xe2, 0x8a, 0xc9,
-  0xd6, 0xa5, 0xb6, 0xb7, 0x87, 0xfb, 0x83, 0xcb, 0x28, 0x85, 0x7a, 0xec,
-  0x94, 0x47, 0xc3, 0xb9, 0x9e, 0x4b, 0xfb, 0x8f, 0x11, 0xff, 0x1a, 0xaa,
-  0x37, 0x56, 0xd9, 0x92, 0x3b, 0xab, 0xb2, 0xf5, 0xe2, 0xde, 0x1d, 0x97,
-  0xfa, 0x30, 0xc7, 0x6e, 0x4c, 0xf7, 0x7f, 0xdd, 0x59, 0xba, 0x5f, 0x10,
-  0x67, 0x09, 0xc6, 0xfa, 0x9e, 0x43, 0x40, 0xd8, 0x0c, 0xc2, 0xaf, 0x1c,
-  0x95, 0xfa, 0xe6, 0x8f, 0xf0, 0x6b, 0x38, 0x8c, 0xc7, 0x20, 0x53, 0xde,
-  0xc7, 0x83, 0xf0, 0x7b, 0x4a, 0xf4, 0xd7, 0x23, 0x66, 0xb5, 0xce, 0xc8,
-  0xf0, 0x2d, 0xb0, 0x00, 0x71, 0x31, 0xc1, 0xcb, 0x71, 0x41, 0x23, 0x40,
-  0xa1, 0x1e, 0x44, 0x23, 0xd0, 0x22, 0x83, 0x24, 0x8a, 0x27, 0x28, 0xc3,
-  0x7b, 0x93, 0xb3, 0x33, 0x52, 0x7f, 0xe3, 0xd8, 0x2d, 0xda, 0x66, 0xdc,
-  0x98, 0x59, 0xbc, 0x4f, 0xf2, 0x11, 0x99, 0x75, 0x00, 0xe8, 0xaa, 0xf9,
-  0x3e, 0xdd, 0xd2, 0xbe, 0xcc, 0xc3, 0x5f, 0x6a, 0x8f, 0x44, 0x17, 0x4d,
-  0x30, 0x2c, 0xda, 0x10, 0xbb, 0xb8, 0x0f, 0xc4, 0xe8, 0x02, 0xb8, 0xef,
-  0x39, 0x24, 0x9f, 0xd1, 0x98, 0x94, 0x9f, 0x9f, 0xe3, 0x25, 0xe4, 0xb0,
-  0xcc, 0x00, 0x0e, 0x4c, 0x94, 0x7f, 0x65, 0x36, 0xd5, 0x28, 0xf1, 0xc8,
-  0xde, 0xca, 0xe2, 0x22, 0x25, 0xe5, 0xa1, 0xea, 0xa0, 0x9e, 0xee, 0x4f,
-  0xe6, 0x69, 0x0c, 0x54, 0xe8, 0x17, 0x30, 0xcc, 0x38, 0xd4, 0xe2, 0xb0,
-  0x4d, 0x00, 0x17, 0x0e, 0x63, 0xed, 0x3b, 0x33, 0xd4, 0xf0, 0x06, 0xf1,
-  0x5f, 0xc0, 0xd5, 0xe1, 0x39, 0xcb, 0x7f, 0x07, 0x87, 0x2c, 0xbf, 0xae,
-  0x3b, 0xa3, 0x2b, 0x28, 0x98, 0xfb, 0xe2, 0x71, 0x8c, 0xe7, 0x0a, 0x95,
-  0x9a, 0xfb, 0x02, 0x09, 0x9f, 0x20, 0x30, 0x3d, 0x84, 0xcb, 0xdf, 0xda,
-  0x39, 0x98, 0x40, 0xc4, 0x95, 0x79, 0x1b, 0x1e, 0x10, 0x34, 0x4c, 0x6b,
-  0x9c, 0xc6, 0x33, 0x25, 0x33, 0xbc, 0x9d, 0xab, 0x98, 0xca, 0x1d, 0x41,
-  0x97, 0x6f, 0xf9, 0xba, 0xe4, 0x72, 0x57, 0xd0, 0xb9, 0x6f, 0x3c, 0xb6,
-  0xa4, 0x62, 0x2a, 0x1b, 0x9a, 0xf7, 0xaf, 0xdf, 0x7b, 0xef, 0x5c, 0x65,
-  0xe6, 0x72, 0xa8, 0x5d, 0xfa, 0x7f, 0x8a, 0x8e, 0x14, 0x21, 0x56, 0x45,
-  0xc8, 0x8f, 0xce, 0x42, 0x73, 0x51, 0xb2, 0xf3, 0x3f, 0x8a, 0x23, 0xdf,
-  0x76, 0x6f, 0x89, 0x21, 0x57, 0xff, 0x67, 0x31, 0x24, 0xd0, 0x71, 0x56,
-  0x7e, 0xbc, 0xd5, 0x68, 0x84, 0x70, 0x21, 0x0e, 0xf6, 0xb5, 0x89, 0x7f,
-  0x53, 0x32, 0x0f, 0xa3, 0xb4, 0x94, 0xac, 0xef, 0xe0, 0xbb, 0xb7, 0xc7,
-  0xce, 0xef, 0x16, 0xcf, 0xa3, 0xd1, 0xf7, 0xe6, 0xd1, 0x9b, 0x92, 0xc9,
-  0x19, 0xa2, 0x91, 0x07, 0xc3, 0x80, 0xea, 0xe9, 0xdd, 0x4e, 0xa8, 0x46,
-  0xeb, 0x67, 0x21, 0x52, 0x30, 0x0c, 0x92, 0x8b, 0x32, 0x2a, 0xfd, 0x0e,
-  0x9a, 0xe8, 0x9f, 0xd1, 0x20, 0x8c, 0xbd, 0x03, 0x76, 0x20, 0x31, 0xfb,
-  0x64, 0xbd, 0xa5, 0xd9, 0xfa, 0xe6, 0xfb, 0xce, 0x56, 0x97, 0x06, 0x37,
-  0x47, 0x10, 0x67, 0x70, 0x3c, 0x3e, 0x8f, 0xb3, 0x52, 0x26, 0x7d, 0x93,
-  0x84, 0xe1, 0xdf, 0xa0, 0x97, 0x06, 0x63, 0xbc, 0x76, 0xe3, 0xe7, 0xa2,
-  0xfd, 0x5d, 0xe0, 0xef, 0xd2, 0x74, 0x10, 0x9c, 0xc6, 0x78, 0xb0, 0xfc,
-  0xc6, 0x9d, 0xed, 0x68, 0x2e, 0x41, 0x30, 0xfc, 0x39, 0x96, 0x94, 0x8b,
-  0xf0, 0x22, 0x4e, 0x4a, 0x89, 0xb4, 0x7d, 0xd5, 0x87, 0xfd, 0x51, 0x77,
-  0xe7, 0xe3, 0xd6, 0xfb, 0xbb, 0xb2, 0x5c, 0xef, 0xfc, 0x2c, 0x4c, 0xd8,
-  0x9b, 0x9c, 0x1d, 0x27, 0x21, 0x3a, 0xb3, 0x95, 0x07, 0xbc, 0x41, 0x39,
-  0x90, 0xb5, 0xe1, 0xe5, 0x5d, 0x21, 0x70, 0xf0, 0xd3, 0xac, 0x62, 0x33,
-  0x85, 0x13, 0xbf, 0x3d, 0x88, 0xb3, 0x60, 0xb8, 0xb4, 0xb4, 0xf8, 0xd9,
+  0xff, 0xaf, 0xbd, 0xaf, 0x6d, 0x6b, 0x5b, 0x57, 0x16, 0xfd, 0xde, 0x5f,
+  0xe1, 0xfa, 0xf4, 0x59, 0x4d, 0x16, 0x21, 0x10, 0xfa, 0xba, 0x61, 0xd1,
+  0x3e, 0x14, 0xda, 0x55, 0xce, 0xa2, 0x85, 0xd3, 0xd0, 0xd5, 0x7b, 0x2e,
+  0x9b, 0x07, 0x9c, 0xc4, 0x80, 0x17, 0x49, 0x9c, 0x1d, 0x3b, 0xa5, 0x2c,
+  0x76, 0xee, 0x6f, 0xbf, 0x33, 0xa3, 0x17, 0x4b, 0xb2, 0x64, 0x3b, 0x24,
+  0xb4, 0xf4, 0x9e, 0xdb, 0x0f, 0x2e, 0xb1, 0xa5, 0xd1, 0x68, 0x34, 0x1a,
+  0x8d, 0x46, 0x33, 0xa3, 0x31, 0x6d, 0x39, 0xd9, 0x2d, 0x9c, 0xa4, 0xbc,
+  0x8f, 0x46, 0xf8, 0x12, 0x37, 0xe4, 0x00, 0x24, 0x2c, 0xdb, 0x0a, 0x1c,
+  0x5e, 0x81, 0xde, 0x14, 0xa6, 0x17, 0x71, 0x8f, 0xdd, 0x80, 0x16, 0x7c,
+  0x0d, 0xa2, 0x3e, 0x8e, 0x7b, 0xd3, 0x3b, 0x84, 0xc9, 0xc1, 0x78, 0x81,
+  0xb6, 0xfa, 0xbc, 0x50, 0xc4, 0x95, 0x35, 0xae, 0x8a, 0x79, 0xe7, 0x31,
+  0x33, 0xd8, 0x0d, 0x2f, 0x3d, 0x31, 0xc1, 0x12, 0x69, 0xef, 0xeb, 0x2f,
+  0x62, 0x73, 0x30, 0x1b, 0x7b, 0x28, 0x2c, 0x11, 0xf4, 0x7a, 0x80, 0xf9,
+  0x09, 0x85, 0x7b, 0x52, 0x78, 0x8c, 0x3e, 0xec, 0xb3, 0x4c, 0xd9, 0x8a,
+  0x33, 0xa8, 0x38, 0x42, 0xfc, 0xce, 0xa2, 0x0e, 0x32, 0x7b, 0x9b, 0xe8,
+  0x20, 0xf6, 0xef, 0x1e, 0xcc, 0xd5, 0xa2, 0xc1, 0x68, 0x13, 0xce, 0x34,
+  0x12, 0xde, 0x07, 0x62, 0xae, 0xbb, 0x1c, 0x90, 0xe8, 0x3b, 0x0c, 0x48,
+  0x92, 0x5e, 0xa3, 0xb7, 0x75, 0x77, 0x32, 0x4e, 0xe2, 0xf1, 0xba, 0x37,
+  0x8a, 0x29, 0xdc, 0xa0, 0xda, 0x30, 0xd0, 0xdd, 0xcd, 0x34, 0xb3, 0xef,
+  0x9b, 0xc8, 0xdc, 0x91, 0x51, 0x13, 0x21, 0x1f, 0xa7, 0x1f, 0xa4, 0x11,
+  0xb0, 0x5b, 0x16, 0x41, 0x02, 0x09, 0x74, 0x7a, 0xe4, 0x70, 0x0d, 0x5b,
+  0x6d, 0x92, 0x9c, 0x78, 0x7f, 0x1a, 0xec, 0x00, 0x99, 0xd8, 0xe1, 0x6c,
+  0x9d, 0x54, 0x8a, 0xf9, 0x90, 0x6a, 0x78, 0xdc, 0xe1, 0x3d, 0x5c, 0xf7,
+  0x80, 0x2b, 0xf0, 0xec, 0x82, 0x60, 0xc1, 0xd6, 0x52, 0x03, 0x43, 0x9b,
+  0x4d, 0xe0, 0x67, 0x40, 0xa0, 0x1f, 0x9c, 0x93, 0x75, 0xf3, 0x0c, 0x79,
+  0x23, 0x1c, 0x83, 0x4a, 0xc1, 0x6d, 0xad, 0xdd, 0x78, 0xd0, 0x01, 0xb9,
+  0xdc, 0x63, 0x5a, 0xb5, 0x12, 0x35, 0x56, 0x84, 0xc0, 0x87, 0x98, 0xd6,
+  0x85, 0xad, 0x5e, 0x30, 0xc2, 0x65, 0x6a, 0xdd, 0x63, 0x3e, 0x1e, 0x89,
+  0x00, 0x4f, 0xfd, 0x4c, 0x2e, 0xe2, 0xab, 0x84, 0x19, 0x5c, 0x41, 0x07,
+  0x0a, 0x59, 0x10, 0x4a, 0x34, 0xf4, 0xa0, 0x24, 0xca, 0x69, 0xa0, 0x12,
+  0x48, 0xf0, 0x92, 0x86, 0x60, 0xc7, 0x3d, 0x8a, 0x93, 0x04, 0xad, 0xb0,
+  0x0d, 0x24, 0xe2, 0x59, 0x74, 0x8e, 0x79, 0xfd, 0xe8, 0x20, 0x84, 0xf6,
+  0xda, 0x64, 0x6b, 0x02, 0x3d, 0xe9, 0x1c, 0xf6, 0xd1, 0x09, 0xae, 0x98,
+  0x6c, 0x5d, 0x6a, 0x7a, 0xfb, 0xb8, 0x3f, 0xb8, 0x8a, 0x12, 0xa8, 0xc7,
+  0x4e, 0x79, 0x0c, 0x9c, 0xab, 0xb9, 0xb4, 0xff, 0x18, 0xf1, 0x6f, 0xa0,
+  0x7a, 0x6b, 0x95, 0x6d, 0x7c, 0x6f, 0x55, 0xb6, 0x4e, 0xdc, 0xb9, 0xe7,
+  0x52, 0x1f, 0xe6, 0xd8, 0xad, 0xe9, 0xfe, 0xaf, 0x7b, 0x4b, 0xf7, 0x01,
+  0x71, 0x96, 0x60, 0xac, 0xef, 0x39, 0x04, 0x84, 0x4d, 0x2f, 0xfc, 0xca,
+  0x51, 0xa9, 0x6e, 0xfe, 0x08, 0xbf, 0x86, 0xfd, 0x78, 0x04, 0x32, 0xe5,
+  0x43, 0xdc, 0x0b, 0xbf, 0xa7, 0x44, 0x7f, 0x3b, 0x64, 0x56, 0xeb, 0x94,
+  0x0c, 0xdf, 0x02, 0x0b, 0x10, 0x17, 0x13, 0xbc, 0x1c, 0x17, 0x34, 0x02,
+  0x14, 0xea, 0x41, 0x34, 0x04, 0x2d, 0x32, 0x18, 0x47, 0xf1, 0x04, 0x65,
+  0x78, 0x67, 0x72, 0x7e, 0x4e, 0xea, 0x6f, 0x1c, 0xbb, 0x45, 0xdb, 0x8c,
+  0x1b, 0x33, 0x8b, 0xf7, 0x89, 0x1c, 0x91, 0x59, 0x07, 0x80, 0xae, 0x9a,
+  0xef, 0xd2, 0x2d, 0xed, 0xcb, 0x3c, 0xfc, 0xa5, 0xf2, 0x48, 0xb4, 0xd1,
+  0x04, 0xc3, 0xa2, 0x0d, 0xb1, 0x8b, 0x07, 0x40, 0x8c, 0x36, 0x80, 0xfb,
+  0x9e, 0x43, 0xf2, 0x05, 0x8d, 0x49, 0xf2, 0xfc, 0x1c, 0x2f, 0x21, 0x87,
+  0x65, 0x06, 0x70, 0x60, 0xa2, 0xfc, 0x2b, 0xb3, 0xa9, 0x46, 0x63, 0x8f,
+  0xec, 0xad, 0x2c, 0x2e, 0x52, 0x51, 0x1e, 0xca, 0x0e, 0xea, 0xe9, 0xfe,
+  0x64, 0x9e, 0xc6, 0x40, 0x87, 0x3e, 0x80, 0x61, 0xc6, 0xa1, 0x16, 0x87,
+  0x6d, 0x02, 0xb8, 0x70, 0x18, 0x6b, 0xde, 0x9b, 0xa1, 0x86, 0x37, 0x88,
+  0xff, 0x02, 0xae, 0x0e, 0x97, 0x2c, 0xff, 0x1d, 0x1c, 0xb2, 0xfc, 0xaa,
+  0xee, 0x8c, 0xae, 0xa0, 0x60, 0xee, 0x8b, 0xc7, 0x31, 0x9e, 0x2b, 0x54,
+  0x6a, 0xee, 0x0b, 0x24, 0x7c, 0x82, 0xc0, 0xf4, 0x10, 0x2e, 0x7f, 0x2b,
+  0xe7, 0x60, 0x02, 0x11, 0x57, 0xe4, 0x6d, 0x78, 0x48, 0xd0, 0x30, 0xad,
+  0x71, 0x12, 0xcf, 0x94, 0xcc, 0xf0, 0x6e, 0xae, 0x62, 0x2a, 0x76, 0x04,
+  0x5d, 0xbe, 0xe3, 0xeb, 0x92, 0x8b, 0x5d, 0x41, 0xe7, 0xbe, 0xf1, 0xd8,
+  0x92, 0x8a, 0xa9, 0x68, 0x68, 0x3e, 0xbc, 0xfd, 0xe0, 0xed, 0xb9, 0xca,
+  0xcc, 0xe5, 0x50, 0xbb, 0xf4, 0xff, 0x14, 0x1d, 0x29, 0x42, 0xac, 0x8c,
+  0x90, 0x9f, 0x9c, 0x85, 0xe6, 0xa2, 0x64, 0xeb, 0x7f, 0x14, 0x47, 0xbe,
+  0x6f, 0xdf, 0x11, 0x43, 0xae, 0xfe, 0xcf, 0x62, 0x48, 0xa0, 0xe3, 0xac,
+  0xfc, 0x78, 0xa7, 0xd1, 0x08, 0xe1, 0x42, 0x1c, 0xec, 0x2b, 0x13, 0xff,
+  0xb6, 0x64, 0xee, 0x47, 0x49, 0x21, 0x59, 0xf7, 0xe0, 0xbb, 0xb7, 0xcf,
+  0xce, 0xef, 0x16, 0xcf, 0xa3, 0xd1, 0xf7, 0xe6, 0xd1, 0xdb, 0x92, 0xc9,
+  0x19, 0xa2, 0x21, 0x83, 0x61, 0x40, 0xf5, 0xf4, 0xee, 0x26, 0x54, 0xa3,
+  0xf1, 0xb3, 0x10, 0x29, 0xe8, 0x07, 0xe3, 0x41, 0x11, 0x95, 0x7e, 0x07,
+  0x4d, 0xf4, 0xcf, 0xa8, 0x17, 0xc6, 0xde, 0x21, 0x3b, 0x90, 0x98, 0x7d,
+  0xb2, 0xde, 0xd1, 0x6c, 0x7d, 0xf7, 0x7d, 0x67, 0xab, 0x4b, 0x83, 0x9b,
+  0x23, 0x88, 0x33, 0x38, 0x19, 0x5d, 0xc4, 0x69, 0x21, 0x93, 0xbe, 0x1b,
+  0x87, 0xe1, 0xdf, 0xa0, 0x97, 0x06, 0x23, 0xbc, 0x76, 0xe3, 0xe7, 0xa2,
+  0xfd, 0x7d, 0xe0, 0xef, 0xc2, 0x74, 0x10, 0x9c, 0xc6, 0x78, 0xb0, 0xfc,
+  0xce, 0x9d, 0xed, 0x68, 0x2e, 0x41, 0xd0, 0xff, 0x39, 0x96, 0x94, 0x41,
+  0x38, 0x88, 0xc7, 0x85, 0x44, 0xda, 0xbe, 0xee, 0xc2, 0xfe, 0xa8, 0xbd,
+  0xf3, 0x69, 0xeb, 0xc3, 0x7d, 0x59, 0xae, 0x77, 0x7e, 0x16, 0x26, 0xec,
+  0x4c, 0xce, 0x4f, 0xc6, 0x21, 0x3a, 0xb3, 0x15, 0x07, 0xbc, 0x41, 0x39,
+  0x90, 0xb5, 0xe1, 0xd5, 0x7d, 0x21, 0x70, 0xf0, 0xd3, 0xac, 0x62, 0x33,
+  0x85, 0x13, 0xbf, 0x3f, 0x8c, 0xd3, 0xa0, 0xbf, 0xb4, 0xb4, 0xf8, 0xd9,
   0xbe, 0xf5, 0xb3, 0x10, 0x6c, 0xe6, 0xc8, 0x61, 0x46, 0xb3, 0xe5, 0xe5,
-  0xc5, 0xd3, 0xac, 0xfd, 0x73, 0xef, 0x79, 0xd2, 0xab, 0x51, 0xff, 0x98,
-  0xbb, 0x13, 0x95, 0x11, 0xf0, 0x63, 0x88, 0x25, 0x3d, 0x46, 0xc7, 0xbb,
-  0x32, 0xc1, 0x47, 0x3f, 0x0b, 0xbf, 0xf6, 0x83, 0x61, 0x7f, 0x32, 0x0c,
-  0xb2, 0xf2, 0xe8, 0xf6, 0x77, 0xef, 0x3c, 0xf8, 0x1f, 0x94, 0xd5, 0xe4,
-  0x36, 0x26, 0xf7, 0xf3, 0x9f, 0x67, 0xe3, 0x83, 0xce, 0x37, 0xc7, 0xe4,
-  0xef, 0x96, 0x96, 0x11, 0x6c, 0x97, 0x0a, 0x7a, 0x5d, 0x60, 0xcc, 0xbb,
-  0xc2, 0x91, 0x17, 0x3f, 0x0b, 0x91, 0x07, 0xe1, 0xd7, 0x08, 0xdd, 0x26,
-  0xc8, 0x5b, 0xb6, 0x8c, 0xc8, 0x48, 0xdd, 0xcf, 0x14, 0x3c, 0x5a, 0xa5,
-  0x5e, 0xde, 0x9a, 0x7e, 0x79, 0x87, 0xa5, 0xe7, 0xec, 0x79, 0x01, 0x90,
-  0x9e, 0xfb, 0x49, 0x0c, 0xb4, 0x4f, 0xe3, 0xe4, 0xae, 0xb0, 0x6d, 0xfc,
-  0xf3, 0xc8, 0x86, 0x14, 0x2d, 0x6e, 0xa5, 0x62, 0x61, 0x0f, 0xa4, 0x42,
-  0x1a, 0x5c, 0x8c, 0x87, 0xae, 0x0c, 0x98, 0xb7, 0x9f, 0x71, 0xe5, 0x2e,
-  0x90, 0x2a, 0xe7, 0x4d, 0x3a, 0x1c, 0x3b, 0x3e, 0x1f, 0x5c, 0x44, 0x65,
-  0x54, 0x7b, 0xba, 0xba, 0x42, 0xbe, 0xf1, 0x18, 0x87, 0x75, 0x0b, 0x13,
-  0xfd, 0xf5, 0xcf, 0xb1, 0x91, 0xac, 0xb7, 0xd5, 0xd9, 0x7d, 0xe3, 0x6d,
-  0x4d, 0xb2, 0xd8, 0xdb, 0x23, 0x77, 0xee, 0xbb, 0x32, 0x89, 0xff, 0xfe,
-  0x39, 0x48, 0xcc, 0xc2, 0x9d, 0x8e, 0xc9, 0x2f, 0xf8, 0xf8, 0xaf, 0x49,
-  0x9a, 0x45, 0xa7, 0xa5, 0x3b, 0xf7, 0xee, 0xde, 0xef, 0xde, 0x3b, 0x3c,
-  0xc0, 0xad, 0xd4, 0xde, 0x6f, 0x42, 0xb4, 0x7f, 0xfd, 0xdc, 0x0b, 0x10,
-  0x46, 0x3c, 0x0e, 0x8f, 0x33, 0x4c, 0x47, 0x5b, 0x92, 0xef, 0x97, 0x2b,
-  0xf0, 0x61, 0xe6, 0x6d, 0x9f, 0x47, 0xe3, 0x79, 0xf8, 0xf5, 0x86, 0x2e,
-  0x03, 0xe9, 0x55, 0x9a, 0x85, 0x17, 0x77, 0xc7, 0x5f, 0xc0, 0x99, 0xd5,
-  0x9d, 0x2f, 0xd1, 0x88, 0xed, 0x0f, 0x48, 0xab, 0xda, 0xff, 0xa1, 0xcc,
-  0x38, 0x6f, 0x8e, 0x24, 0xa2, 0xda, 0xf1, 0x64, 0x3c, 0x80, 0x7d, 0x0e,
-  0x4c, 0xef, 0x52, 0x09, 0xca, 0x5c, 0xa8, 0xbc, 0xbd, 0x83, 0xad, 0xc5,
-  0xaf, 0xd0, 0xc1, 0x0f, 0x30, 0xac, 0xff, 0xb8, 0x3c, 0x53, 0x30, 0xaf,
-  0x31, 0x92, 0xe8, 0x07, 0x9d, 0x89, 0xdf, 0x2e, 0x19, 0xbf, 0x8b, 0xb2,
-  0x8e, 0x41, 0x59, 0x68, 0x3e, 0x3a, 0x2e, 0xb9, 0xea, 0x41, 0x92, 0xa0,
-  0x3c, 0xaf, 0x57, 0xba, 0x68, 0x29, 0xfa, 0x5d, 0x73, 0x59, 0xd5, 0x14,
-  0x93, 0xe9, 0xe0, 0xb8, 0x1f, 0x24, 0x03, 0xb7, 0xa4, 0x7c, 0x45, 0x94,
-  0xf4, 0x0e, 0xe9, 0x0e, 0x0c, 0xf4, 0x26, 0x47, 0xa7, 0xeb, 0x14, 0x03,
-  0x8d, 0xd9, 0xfe, 0xf2, 0xa8, 0xbe, 0x10, 0xad, 0xe3, 0x19, 0x58, 0x2b,
-  0x1d, 0x1a, 0xba, 0xc1, 0x33, 0xb4, 0x56, 0x30, 0x31, 0x09, 0x1f, 0xe2,
-  0xdc, 0x47, 0x9c, 0xe2, 0xc0, 0xd0, 0x4d, 0xcf, 0xee, 0xca, 0x2e, 0x55,
-  0x8f, 0xd0, 0x7f, 0x73, 0x18, 0xb1, 0x4e, 0x09, 0xff, 0x3e, 0xd6, 0x2f,
-  0x4a, 0x98, 0x63, 0xad, 0x8e, 0xdd, 0xb0, 0xc1, 0xe8, 0x85, 0xd9, 0x25,
-  0xa6, 0xe7, 0xe1, 0xfb, 0x6e, 0xe6, 0x54, 0x4f, 0xde, 0xea, 0x48, 0xad,
-  0x73, 0xa0, 0xf2, 0x25, 0x06, 0x2f, 0x25, 0xf0, 0x39, 0xa5, 0x9c, 0xde,
-  0x00, 0xc3, 0xec, 0xbf, 0xe1, 0x34, 0x38, 0xd7, 0xda, 0x33, 0xc7, 0x1c,
-  0x64, 0x6f, 0xa9, 0x8f, 0xf3, 0x9a, 0xc6, 0x86, 0xf1, 0x64, 0x40, 0x77,
-  0x4f, 0x0d, 0xe3, 0x60, 0x50, 0x32, 0xff, 0x3c, 0x16, 0xf1, 0xc1, 0x1c,
-  0xfa, 0x95, 0x1f, 0x1c, 0x11, 0x4e, 0xf3, 0x85, 0x48, 0xc2, 0x1f, 0x20,
-  0x9e, 0x18, 0x21, 0x26, 0xe3, 0x32, 0x32, 0xb0, 0x28, 0x3b, 0x26, 0x7a,
-  0x91, 0x85, 0x95, 0x68, 0x18, 0x3e, 0x1c, 0x54, 0x06, 0xef, 0x78, 0xec,
-  0x87, 0xe3, 0x6c, 0xd3, 0x6f, 0xf7, 0xa2, 0x91, 0xbf, 0x32, 0x33, 0x49,
-  0xb9, 0x70, 0x7c, 0xf1, 0xb1, 0x64, 0x05, 0xba, 0x4b, 0xd2, 0xae, 0x6e,
-  0x7a, 0xfd, 0xe8, 0x34, 0x72, 0x8b, 0xb3, 0xcf, 0xd1, 0xf2, 0x9b, 0xa8,
-  0x54, 0x64, 0xdd, 0xbe, 0x93, 0xa8, 0x55, 0x9d, 0xa0, 0x97, 0x88, 0xfb,
-  0x72, 0x30, 0xae, 0xed, 0x66, 0x13, 0xf7, 0x49, 0xd6, 0xb9, 0xae, 0xff,
-  0x12, 0xa7, 0xc7, 0x7d, 0x34, 0x45, 0x79, 0xfb, 0x18, 0xea, 0x75, 0x93,
-  0xa9, 0x33, 0x73, 0x0f, 0x40, 0x5d, 0x51, 0x33, 0x3e, 0x56, 0x1c, 0xf5,
-  0x04, 0x83, 0x28, 0xae, 0x12, 0x0b, 0x32, 0xe0, 0xe5, 0x34, 0x8d, 0x06,
-  0x2f, 0xba, 0xec, 0xc7, 0x9c, 0x7b, 0xf3, 0x52, 0x1e, 0x2d, 0x5a, 0x46,
-  0x8f, 0x26, 0xcb, 0xde, 0xe6, 0xa6, 0xac, 0xeb, 0x24, 0x45, 0x3c, 0xc9,
-  0x2a, 0x8c, 0xb5, 0x94, 0xef, 0xc6, 0xeb, 0x76, 0x77, 0x77, 0x1c, 0x3d,
-  0xb7, 0xad, 0xbd, 0xb6, 0x34, 0x93, 0xd8, 0x2f, 0x40, 0x10, 0x3a, 0xe6,
-  0xbf, 0xb0, 0xb8, 0x8e, 0xbb, 0x66, 0x75, 0xd5, 0xcd, 0x1a, 0x67, 0x69,
-  0x8f, 0x83, 0x86, 0x1e, 0x8d, 0x00, 0x57, 0xff, 0x3b, 0xd0, 0x6d, 0x18,
-  0x9f, 0x45, 0xa3, 0x8a, 0xe4, 0xee, 0x88, 0x0b, 0xe6, 0x85, 0x98, 0x9d,
-  0x74, 0x35, 0x6f, 0x39, 0x22, 0xb1, 0x5c, 0xfb, 0x06, 0x1b, 0x46, 0x23,
-  0x26, 0xca, 0x2d, 0x95, 0xc6, 0x18, 0x3c, 0x78, 0x1e, 0x0f, 0x07, 0x61,
-  0xb2, 0xe9, 0x23, 0xca, 0xb6, 0x42, 0x6c, 0x99, 0xc8, 0xc2, 0x6f, 0x56,
-  0x10, 0x49, 0x18, 0x0c, 0x50, 0x8b, 0x71, 0x84, 0x07, 0x51, 0xd3, 0xb0,
-  0x71, 0x87, 0xb9, 0x64, 0xd6, 0x5e, 0xa9, 0x77, 0x61, 0xcd, 0x0f, 0xa7,
-  0x0c, 0xe6, 0x89, 0xbb, 0x8c, 0x93, 0x81, 0x9b, 0x3a, 0x65, 0x25, 0x24,
-  0x32, 0xb8, 0x8b, 0x2d, 0x96, 0x14, 0xa5, 0xd7, 0x2f, 0x91, 0xa8, 0xe1,
-  0xd3, 0x66, 0xd9, 0x59, 0xf2, 0x07, 0xdd, 0x88, 0x34, 0x02, 0xfd, 0x36,
-  0x4e, 0xbe, 0x1c, 0xf7, 0xcf, 0x43, 0x8c, 0x4b, 0x2f, 0xbb, 0x19, 0x89,
-  0xcf, 0xb6, 0xf9, 0xef, 0x44, 0x72, 0x28, 0x16, 0x37, 0xcc, 0x33, 0x1c,
-  0x5f, 0x8c, 0xb3, 0xbb, 0x63, 0xa1, 0x12, 0xbe, 0xc8, 0x6e, 0x76, 0xe2,
-  0xea, 0x1a, 0x60, 0xbd, 0xcc, 0x83, 0x88, 0x5f, 0xec, 0xd3, 0xcf, 0xef,
-  0x13, 0xe4, 0x62, 0x9f, 0xb5, 0x95, 0x56, 0xe2, 0x72, 0xb1, 0x24, 0x4f,
-  0x39, 0xd6, 0x35, 0xc7, 0x44, 0xbf, 0x08, 0xbe, 0x0d, 0xc3, 0xd1, 0x59,
-  0x76, 0xbe, 0xe9, 0xaf, 0x19, 0x99, 0x0a, 0x56, 0x16, 0x6a, 0x74, 0x57,
-  0x08, 0x1d, 0x8c, 0xfa, 0xe1, 0xb0, 0xa6, 0xca, 0x33, 0x83, 0xe2, 0x9f,
-  0x96, 0xdf, 0x3d, 0xb2, 0xf5, 0x61, 0xfb, 0xf5, 0xbb, 0x85, 0x59, 0x78,
-  0x78, 0x5f, 0xe2, 0x2f, 0x77, 0x61, 0xd7, 0x03, 0x6b, 0x50, 0x69, 0xdf,
-  0xf7, 0xfe, 0xb8, 0x45, 0x73, 0xb5, 0x43, 0x16, 0x04, 0xc3, 0x30, 0xb9,
-  0x43, 0xa2, 0xe0, 0x32, 0x48, 0x9c, 0xc6, 0x7d, 0xa6, 0xc2, 0xbf, 0x7b,
-  0xfd, 0xf1, 0x60, 0xa6, 0x59, 0x7f, 0xcf, 0x39, 0xee, 0xb9, 0x0c, 0xc8,
-  0x03, 0x9f, 0xcf, 0xe3, 0x04, 0x04, 0x00, 0x93, 0x0b, 0xf1, 0x20, 0x18,
-  0x1e, 0x1f, 0x73, 0x13, 0xa0, 0x3e, 0xe4, 0x58, 0x82, 0x48, 0x27, 0xe4,
-  0x91, 0xf2, 0xfd, 0xc5, 0xbc, 0xd3, 0xb0, 0xe6, 0x3e, 0x23, 0xbf, 0x6e,
-  0xfa, 0x26, 0x53, 0x83, 0xa1, 0xff, 0xff, 0x67, 0xc6, 0x3d, 0x17, 0x6a,
-  0x2c, 0x78, 0xd1, 0xaf, 0x7f, 0x95, 0x9e, 0xfc, 0xc3, 0x56, 0x7b, 0x91,
-  0x13, 0xc5, 0x19, 0x24, 0xc9, 0xe8, 0x45, 0x8d, 0xdf, 0xca, 0xe2, 0x28,
-  0xc7, 0x75, 0xf6, 0x87, 0x61, 0x90, 0xcc, 0xc6, 0xc3, 0xc2, 0x23, 0x67,
-  0x18, 0x66, 0x92, 0x33, 0xe3, 0x42, 0xcf, 0x8f, 0x71, 0xb9, 0x0d, 0x40,
-  0xe5, 0x37, 0x58, 0x29, 0x1a, 0x6c, 0xfa, 0x0c, 0xf3, 0x03, 0x28, 0xb2,
-  0x05, 0x45, 0x4a, 0x6d, 0xf5, 0xac, 0xe8, 0xf1, 0xb1, 0x80, 0x67, 0x30,
-  0x37, 0xec, 0x15, 0xf9, 0xa7, 0x1b, 0x31, 0xa0, 0x54, 0x48, 0xfd, 0xa1,
-  0xf5, 0x12, 0x8d, 0x64, 0x61, 0x02, 0x5b, 0xd3, 0xe8, 0xe2, 0x0c, 0xd6,
-  0x7b, 0xa9, 0xac, 0xfc, 0xa7, 0x56, 0x89, 0x14, 0x68, 0x2e, 0x4d, 0x7d,
-  0xea, 0xf9, 0x65, 0xd8, 0x4b, 0xe3, 0xfe, 0x97, 0x30, 0xfb, 0xcc, 0xdf,
-  0xba, 0xda, 0xc3, 0x21, 0xf2, 0x30, 0xc7, 0xda, 0x17, 0x90, 0x7e, 0xfe,
-  0x8b, 0x34, 0x3a, 0x1b, 0x81, 0x24, 0xa4, 0xbd, 0x08, 0x45, 0x60, 0x5b,
-  0x9b, 0x4f, 0xfb, 0x49, 0x34, 0xce, 0xbb, 0x07, 0x10, 0x52, 0xd8, 0x9a,
-  0x67, 0xc9, 0x04, 0xd3, 0x9d, 0x6c, 0x7a, 0xd7, 0xf4, 0x9e, 0xc2, 0xc8,
-  0xd7, 0xbd, 0xc3, 0x9c, 0x06, 0xd7, 0xb4, 0x08, 0xad, 0x7b, 0x3e, 0xfe,
-  0xe7, 0xb7, 0x48, 0x5d, 0x82, 0x5f, 0x69, 0x86, 0xb1, 0xf5, 0xf0, 0x3b,
-  0x8d, 0xfe, 0x86, 0xdf, 0x6b, 0x4f, 0xbc, 0x69, 0xcb, 0xac, 0xc3, 0x92,
-  0x86, 0xc2, 0x76, 0x30, 0xaf, 0xd7, 0xbb, 0xca, 0xc2, 0xbc, 0x56, 0xc7,
-  0x5a, 0xa9, 0xb8, 0xca, 0xfc, 0x46, 0xb5, 0xa0, 0x47, 0xa4, 0x89, 0xcd,
-  0x56, 0x1b, 0xba, 0x3d, 0x53, 0x05, 0x4c, 0x4f, 0xfb, 0xa7, 0x72, 0x31,
-  0xf5, 0xac, 0xb5, 0xf1, 0x02, 0x52, 0x71, 0xff, 0xe8, 0xcc, 0x95, 0xf9,
-  0x4d, 0xa9, 0x55, 0xf5, 0x8e, 0x5a, 0xf7, 0xa6, 0x1b, 0xf7, 0xe4, 0x91,
-  0xde, 0x0f, 0x92, 0x34, 0x4c, 0xf2, 0xe1, 0x1e, 0xc7, 0x30, 0xd8, 0xab,
-  0xac, 0xf0, 0x18, 0x3f, 0xb1, 0x52, 0x5b, 0x49, 0x12, 0x5c, 0x35, 0x7a,
-  0x93, 0xd3, 0x53, 0x00, 0xc9, 0x38, 0x64, 0x27, 0x64, 0xec, 0x13, 0x63,
-  0x4a, 0x1e, 0xf6, 0xae, 0xc9, 0x81, 0x14, 0xdc, 0xc4, 0x4f, 0x25, 0x18,
-  0x10, 0x68, 0xc4, 0xac, 0x7b, 0xc8, 0x5e, 0x1d, 0x6d, 0xe4, 0x35, 0x31,
-  0x47, 0x60, 0x1b, 0xf0, 0x80, 0xe2, 0xab, 0xc5, 0x5b, 0x6c, 0x1b, 0xde,
-  0x8c, 0xc2, 0x4b, 0xef, 0x53, 0x34, 0xca, 0x9e, 0x17, 0x18, 0x35, 0x8b,
-  0x42, 0xd1, 0xa9, 0xd7, 0x50, 0x9a, 0x94, 0x31, 0x2a, 0xb0, 0x62, 0x4d,
-  0x76, 0x81, 0x34, 0x00, 0x51, 0x26, 0x43, 0xfb, 0x2c, 0xa4, 0xd7, 0x8d,
-  0x92, 0x3e, 0x6e, 0xdc, 0x53, 0xad, 0x14, 0xd9, 0x24, 0x19, 0x79, 0x87,
-  0xed, 0x76, 0xbb, 0xc0, 0xa8, 0x8d, 0xc4, 0x7f, 0x47, 0x4c, 0x87, 0xa9,
-  0xda, 0xf3, 0xd6, 0x9a, 0x47, 0xed, 0x8b, 0x60, 0xdc, 0x68, 0x34, 0xbd,
-  0xcd, 0x17, 0x1a, 0x62, 0x12, 0x2c, 0xa5, 0x03, 0xed, 0x24, 0x1c, 0x4c,
-  0xfa, 0x61, 0xa3, 0x11, 0xf4, 0xfb, 0x02, 0x85, 0xdd, 0x2c, 0xbc, 0x70,
-  0x80, 0xc0, 0x7f, 0x50, 0xf2, 0xb0, 0x28, 0xd8, 0x46, 0x26, 0x39, 0x82,
-  0x7e, 0x12, 0x59, 0xa1, 0x7f, 0x7f, 0x06, 0xc3, 0x49, 0xa8, 0x0c, 0x25,
-  0xc1, 0xdb, 0xb0, 0xc2, 0xe2, 0x28, 0x01, 0x48, 0xf3, 0xfb, 0xb4, 0xe5,
-  0x5d, 0x4f, 0xb5, 0x7a, 0xf2, 0xef, 0xe9, 0x3d, 0x0d, 0xca, 0x68, 0x32,
-  0x1c, 0xb2, 0xcf, 0x9c, 0x1b, 0xdd, 0xd8, 0x48, 0x5d, 0x63, 0x59, 0x57,
-  0xbc, 0x86, 0xd4, 0x25, 0x64, 0x71, 0x63, 0x64, 0x31, 0x0b, 0x25, 0xe3,
-  0xfa, 0x75, 0x17, 0x65, 0xb1, 0x99, 0x43, 0xc1, 0x5e, 0x4b, 0x4b, 0x47,
-  0x1b, 0x16, 0x08, 0x5c, 0x8e, 0x99, 0x30, 0x14, 0x86, 0xde, 0x27, 0xf6,
-  0x14, 0xa0, 0x4c, 0xda, 0xe4, 0x3c, 0xbc, 0xb4, 0x29, 0x75, 0xab, 0x8d,
-  0xb3, 0x71, 0xc3, 0x85, 0x5d, 0xc1, 0x43, 0x5a, 0x8d, 0xe6, 0x91, 0x75,
-  0x6c, 0x24, 0x5e, 0xf2, 0x3d, 0xbf, 0x59, 0x52, 0xe6, 0xb8, 0x7f, 0x1e,
-  0x24, 0x2d, 0x2f, 0x1a, 0x0d, 0xc2, 0x6f, 0x25, 0x8c, 0x83, 0xb3, 0x87,
-  0x48, 0x24, 0x75, 0x72, 0x89, 0xd5, 0x3a, 0xf2, 0x5e, 0x78, 0x8f, 0x3a,
-  0x4d, 0x47, 0x45, 0xa9, 0x13, 0x5d, 0x22, 0x5f, 0xfb, 0x14, 0xb6, 0x70,
-  0xdb, 0xd0, 0xe8, 0x36, 0x68, 0x3c, 0x4e, 0x98, 0x0e, 0x9e, 0x9b, 0x96,
-  0x71, 0xa2, 0xef, 0x5b, 0x18, 0xd1, 0xd1, 0xf7, 0xbf, 0xe2, 0x68, 0xd4,
-  0xf0, 0x5d, 0x94, 0x01, 0x44, 0x2f, 0x1a, 0x06, 0xbb, 0x16, 0x9c, 0x59,
-  0x25, 0x07, 0x16, 0x22, 0xeb, 0xaa, 0xa7, 0x3c, 0x6c, 0x86, 0xc7, 0x96,
-  0x31, 0x83, 0x6f, 0xc8, 0x5b, 0xf8, 0xd5, 0xc2, 0x55, 0xb6, 0x69, 0x0b,
-  0xd3, 0x75, 0xb5, 0x99, 0x4f, 0x3f, 0x58, 0x05, 0x56, 0x7e, 0xf5, 0x7e,
-  0x7f, 0xd5, 0xdd, 0xe6, 0x5b, 0x83, 0xdf, 0x87, 0x71, 0x2f, 0x18, 0x7a,
-  0x7b, 0xbd, 0xbf, 0x40, 0xc5, 0xfe, 0x75, 0x85, 0xaf, 0x11, 0x52, 0x01,
-  0xb1, 0x42, 0x30, 0xb5, 0xef, 0x7d, 0x30, 0x1e, 0xc3, 0x40, 0xaf, 0x4b,
-  0x68, 0x75, 0x70, 0xd5, 0xa1, 0x8f, 0xe2, 0x9a, 0x24, 0xbf, 0x58, 0xac,
-  0xd6, 0xd4, 0x8f, 0x78, 0x55, 0x92, 0xf4, 0xf5, 0x91, 0xfa, 0xf5, 0xd9,
-  0x9a, 0x5c, 0xf5, 0x71, 0xfe, 0x11, 0xde, 0xe3, 0x6d, 0x10, 0xd2, 0xb7,
-  0x27, 0x45, 0xc5, 0x7f, 0xac, 0x21, 0x58, 0xe5, 0xeb, 0xd3, 0xe2, 0xeb,
-  0x93, 0x2f, 0x6f, 0xff, 0xc6, 0xab, 0x12, 0xc2, 0x9d, 0xf8, 0x72, 0x24,
-  0x15, 0x79, 0x9e, 0x17, 0xe9, 0x52, 0x56, 0x36, 0xbc, 0x13, 0xe4, 0x80,
-  0x5d, 0x09, 0x22, 0x95, 0xfa, 0x47, 0x5e, 0xea, 0x1d, 0xe8, 0x75, 0xdb,
-  0x94, 0x85, 0x88, 0xdd, 0x4b, 0xc5, 0x0b, 0x71, 0xb6, 0xe1, 0xfb, 0xac,
-  0x3f, 0xc2, 0xab, 0xf4, 0x7d, 0xdc, 0x8b, 0x86, 0x21, 0x66, 0x7e, 0x82,
-  0xba, 0x18, 0x0c, 0xe4, 0x3b, 0x8a, 0xc8, 0x24, 0xc4, 0x72, 0xeb, 0xda,
-  0x48, 0xf3, 0xf5, 0x1c, 0x15, 0xca, 0x9d, 0xb8, 0x2f, 0x21, 0x85, 0xff,
-  0x30, 0x93, 0x02, 0x7c, 0x7c, 0xa6, 0xbd, 0x9e, 0x8c, 0xe1, 0xe5, 0xaf,
-  0xda, 0x4b, 0x4a, 0x17, 0x00, 0xef, 0x9f, 0x6a, 0xef, 0xf1, 0x68, 0x1b,
-  0x5e, 0xaf, 0x48, 0xaf, 0x25, 0x2d, 0x83, 0xae, 0x2b, 0xb9, 0x09, 0x4e,
-  0xe7, 0x36, 0x9c, 0x1e, 0x3b, 0x70, 0xfa, 0xdb, 0x8e, 0xd3, 0x13, 0x3b,
-  0x4e, 0xec, 0x16, 0x94, 0xb4, 0x04, 0xab, 0x4f, 0xe8, 0xf6, 0x63, 0x45,
-  0xeb, 0x95, 0x0d, 0xad, 0x6d, 0x07, 0x5a, 0x5b, 0x76, 0xb4, 0x76, 0x4c,
-  0xb4, 0xf8, 0x7f, 0x83, 0x20, 0x0b, 0xfe, 0x6b, 0x12, 0x4e, 0xc2, 0x41,
-  0xae, 0x45, 0x45, 0xe9, 0xe7, 0x94, 0xe5, 0xc4, 0x5d, 0xf7, 0x4e, 0x83,
-  0x61, 0x1a, 0xb2, 0xd7, 0x17, 0xc1, 0xb7, 0x2e, 0x53, 0xad, 0x9f, 0xad,
-  0xb1, 0x37, 0xff, 0xa2, 0x7a, 0xb8, 0xcb, 0x81, 0x26, 0x78, 0x0b, 0xa8,
-  0xc4, 0xe2, 0xf1, 0xc9, 0x0e, 0xec, 0xb5, 0x95, 0xea, 0xd0, 0xbf, 0xaf,
-  0x61, 0xb2, 0xbb, 0x2f, 0x15, 0x65, 0xe2, 0x66, 0x9d, 0x96, 0x59, 0xf6,
-  0x0a, 0xb3, 0xd3, 0xc2, 0xae, 0xf2, 0x73, 0xa1, 0xd2, 0x4d, 0x22, 0x99,
-  0x68, 0xec, 0x40, 0xfe, 0x15, 0x31, 0xb6, 0x5c, 0xaf, 0xf8, 0xb6, 0xcb,
-  0x6e, 0xca, 0x51, 0x3f, 0xb1, 0x2c, 0x5c, 0x88, 0x3d, 0xd3, 0x74, 0x53,
-  0xbd, 0x40, 0x9e, 0x80, 0x89, 0x25, 0x20, 0xd5, 0x3f, 0xb3, 0xbd, 0x91,
-  0xfe, 0x96, 0xed, 0xdc, 0xb6, 0x71, 0x77, 0xaa, 0x7f, 0x62, 0xbb, 0x06,
-  0x86, 0x27, 0x26, 0x5f, 0x30, 0xbf, 0x33, 0xa7, 0x00, 0xe6, 0x5f, 0xe1,
-  0xfa, 0xca, 0x3d, 0x05, 0xf4, 0xcf, 0xa8, 0xe9, 0xbb, 0x41, 0xe3, 0xd7,
-  0x6d, 0x96, 0x2d, 0xcd, 0x44, 0x19, 0xfa, 0x7e, 0x11, 0xc1, 0x3e, 0xcb,
-  0x78, 0x4f, 0xc9, 0x8e, 0x6c, 0xe0, 0xd8, 0x17, 0x20, 0x4b, 0xff, 0xdc,
-  0xf6, 0x19, 0xb6, 0x7b, 0x5d, 0xda, 0xee, 0xf1, 0x23, 0x88, 0x28, 0x1e,
-  0xf1, 0x8d, 0x9f, 0x51, 0x12, 0x76, 0x76, 0xbc, 0x50, 0xc9, 0x27, 0xfb,
-  0xd0, 0x62, 0x01, 0x6b, 0xeb, 0xfc, 0xfd, 0x01, 0xda, 0xa7, 0x6c, 0x1f,
-  0xf7, 0xf9, 0x29, 0x93, 0x95, 0x2b, 0xb0, 0x40, 0xb7, 0xbb, 0xe3, 0xfc,
-  0xb6, 0x35, 0x76, 0x63, 0xd3, 0xcd, 0x82, 0xd2, 0x8f, 0x38, 0x05, 0xf4,
-  0x4f, 0x64, 0x0a, 0xb3, 0xbe, 0xdc, 0xfb, 0x62, 0x7d, 0xbd, 0xcd, 0x8c,
-  0x7e, 0x16, 0xf6, 0xb8, 0x18, 0x3b, 0xde, 0x9a, 0x90, 0xd8, 0xfb, 0x6d,
-  0x32, 0xb3, 0x3b, 0xbe, 0x95, 0x35, 0x63, 0x50, 0x87, 0xcb, 0x0d, 0xe6,
-  0x94, 0x7a, 0xc0, 0xf9, 0x09, 0xd3, 0x0b, 0x27, 0xf9, 0x9c, 0xcd, 0x99,
-  0xa2, 0x4b, 0x73, 0xfe, 0x53, 0x32, 0x2c, 0x26, 0x3d, 0xd2, 0x47, 0x5d,
-  0x40, 0x68, 0xbd, 0x09, 0xc6, 0x92, 0x84, 0xc2, 0x23, 0xd2, 0xa2, 0x06,
-  0x6f, 0xf0, 0x52, 0x99, 0xb4, 0x97, 0xe9, 0x36, 0x1e, 0x8b, 0x69, 0xed,
-  0xa6, 0x9c, 0x8b, 0xb6, 0xe3, 0x09, 0x66, 0x66, 0x95, 0x3e, 0x7c, 0x88,
-  0xbb, 0x13, 0x72, 0xcb, 0x10, 0x7c, 0x3a, 0x3a, 0x33, 0x0b, 0x21, 0xb4,
-  0x18, 0x7b, 0xbb, 0xca, 0xd5, 0x8d, 0x5f, 0xbd, 0xdc, 0x9c, 0x41, 0xf2,
-  0x8b, 0xfc, 0xcc, 0x72, 0x55, 0x83, 0x0e, 0xe6, 0x3e, 0xab, 0x7d, 0x05,
-  0xa5, 0x43, 0xde, 0x2c, 0xa1, 0x82, 0xfa, 0x4b, 0xa1, 0x92, 0xb4, 0x0b,
-  0xd1, 0x2a, 0x6b, 0x63, 0x58, 0x4a, 0x2a, 0x74, 0x99, 0xea, 0x6a, 0xeb,
-  0xca, 0xaf, 0x4e, 0x2d, 0x96, 0xfd, 0x5b, 0xa5, 0xe7, 0xf6, 0xde, 0x87,
-  0x0f, 0xaf, 0xb7, 0x0f, 0x76, 0x3f, 0xfc, 0x5e, 0x51, 0xbc, 0x43, 0xcf,
-  0xbd, 0xfd, 0xd7, 0x1f, 0x2a, 0x0a, 0xae, 0x31, 0xb8, 0xef, 0xf6, 0xba,
-  0xd5, 0x40, 0x1f, 0xe5, 0x65, 0x5f, 0xef, 0x54, 0x14, 0x05, 0x12, 0xca,
-  0x3f, 0xc5, 0x86, 0x49, 0xa1, 0x41, 0x1b, 0x8f, 0xd3, 0xaf, 0xd0, 0xe9,
-  0x24, 0xb4, 0x69, 0xf1, 0xb4, 0xf7, 0xe9, 0xac, 0xdb, 0xdf, 0xaf, 0xad,
-  0x5b, 0x11, 0x50, 0xe1, 0xd3, 0x21, 0x51, 0xc3, 0xa1, 0xd2, 0xf7, 0xa0,
-  0xf5, 0x2f, 0x1b, 0x76, 0xe8, 0x8f, 0x6a, 0x40, 0xc7, 0x8d, 0x7f, 0xbe,
-  0x79, 0xac, 0x01, 0x7c, 0x6a, 0xd9, 0x84, 0xea, 0xcc, 0x63, 0xf2, 0x45,
-  0x1f, 0x00, 0x65, 0x61, 0xce, 0x82, 0x96, 0xcd, 0x41, 0x61, 0x3c, 0xc9,
-  0x97, 0x56, 0x8d, 0x45, 0xfb, 0x2c, 0xc1, 0x5d, 0x7b, 0x18, 0x9f, 0x35,
-  0xfc, 0xbc, 0x90, 0xcf, 0x41, 0x95, 0xb2, 0x66, 0x09, 0x3d, 0x59, 0xf3,
-  0x56, 0xce, 0x87, 0xf6, 0x49, 0x2d, 0x60, 0x05, 0x79, 0xca, 0xf8, 0xcf,
-  0x20, 0x16, 0xf8, 0xc2, 0xd1, 0x00, 0xb5, 0x20, 0x04, 0x30, 0x39, 0xe6,
-  0x5a, 0x2f, 0x2d, 0x53, 0x4c, 0x25, 0xfd, 0x83, 0x07, 0x6c, 0x6a, 0x7e,
-  0xcc, 0x19, 0xa8, 0xd1, 0x94, 0xd1, 0x66, 0x7b, 0x0d, 0x07, 0x9e, 0x65,
-  0xa2, 0xa2, 0xb0, 0xef, 0x18, 0x63, 0x1d, 0x5e, 0x7a, 0xc5, 0x30, 0xc8,
-  0x5f, 0x0d, 0x51, 0xd8, 0xf2, 0x0e, 0xfd, 0x20, 0x19, 0x4c, 0xa2, 0x51,
-  0xec, 0x8b, 0x0d, 0xa5, 0x4a, 0xc8, 0x78, 0x04, 0x9a, 0xc8, 0x48, 0xeb,
-  0xa6, 0x31, 0x54, 0x97, 0x78, 0xe7, 0x05, 0x16, 0xf4, 0xa5, 0x51, 0xb7,
-  0x50, 0x93, 0x68, 0x2d, 0x15, 0x51, 0xda, 0x52, 0xe5, 0xe5, 0xd2, 0x52,
-  0x51, 0x8c, 0x8c, 0xee, 0x5c, 0x20, 0xaa, 0xf4, 0xe5, 0x2f, 0x5d, 0x20,
-  0xf9, 0x67, 0xdc, 0x4e, 0x86, 0x99, 0x00, 0x90, 0xf3, 0x55, 0xcb, 0x7b,
-  0xba, 0xba, 0xba, 0x6a, 0xaf, 0xab, 0xb0, 0x08, 0x32, 0x81, 0xa3, 0x85,
-  0x3a, 0x03, 0x34, 0xb5, 0x13, 0x96, 0x78, 0xb4, 0x9a, 0xb2, 0xa2, 0xa4,
-  0x4c, 0xda, 0x1b, 0x12, 0xc4, 0xc5, 0xf7, 0x0e, 0x04, 0xf9, 0x41, 0x20,
-  0xa2, 0xc8, 0xff, 0xd4, 0x31, 0xbd, 0xad, 0x71, 0x59, 0x7b, 0x76, 0x83,
-  0x71, 0x61, 0x13, 0xf4, 0x90, 0xa3, 0xba, 0x03, 0x7b, 0x89, 0xad, 0x6c,
-  0xb5, 0xe5, 0x29, 0xbf, 0x3b, 0xda, 0xef, 0x35, 0xed, 0xf7, 0x23, 0xed,
-  0xf7, 0x63, 0xed, 0xf7, 0x93, 0x16, 0x1a, 0x03, 0xf9, 0xab, 0x36, 0xee,
-  0x57, 0x54, 0xf3, 0xa9, 0xda, 0xb8, 0xf7, 0xcb, 0xa6, 0xe7, 0xff, 0x87,
-  0xaf, 0x4b, 0x4a, 0xa9, 0x3b, 0xc5, 0xae, 0x05, 0xed, 0x11, 0x76, 0xb8,
-  0x5a, 0x95, 0x62, 0x93, 0xa4, 0x57, 0x69, 0x33, 0x9f, 0x09, 0xb5, 0xa6,
-  0x26, 0x92, 0xa4, 0xda, 0x2f, 0x36, 0x3d, 0x20, 0x33, 0x10, 0xda, 0xb2,
-  0xa2, 0x49, 0x35, 0x26, 0x51, 0x5b, 0x68, 0xea, 0xed, 0xaf, 0x68, 0x6f,
-  0x04, 0x02, 0xd8, 0xec, 0x48, 0xf6, 0x46, 0x14, 0x2b, 0xb4, 0x6b, 0x71,
-  0x09, 0x81, 0x13, 0xad, 0xa6, 0x66, 0x7e, 0xe0, 0x81, 0x60, 0x24, 0xf0,
-  0x8a, 0x0d, 0x45, 0x1d, 0xef, 0x8e, 0x6e, 0x95, 0x94, 0xc0, 0xbc, 0x46,
-  0x2b, 0xcc, 0x20, 0xee, 0x4f, 0xf0, 0x52, 0x41, 0xa4, 0x7c, 0x72, 0xc5,
-  0x1c, 0x2a, 0xe3, 0xa4, 0x71, 0x72, 0x88, 0xc7, 0x40, 0xf0, 0x0b, 0xbf,
-  0x2d, 0x27, 0xe1, 0xe9, 0xa6, 0x7f, 0xff, 0x5a, 0xb4, 0x3e, 0xf5, 0x8f,
-  0x4e, 0x9a, 0x36, 0xb8, 0xec, 0x4a, 0xcd, 0x7d, 0x69, 0x7f, 0xe5, 0x6d,
-  0xe6, 0x8d, 0x19, 0x04, 0x7a, 0x99, 0x7f, 0x42, 0x43, 0xf2, 0x56, 0x96,
-  0x25, 0x11, 0xf4, 0x24, 0x6c, 0xf8, 0x5a, 0xd3, 0x16, 0x93, 0x1b, 0x9e,
-  0x17, 0xc1, 0x1e, 0xd6, 0x77, 0x32, 0x05, 0x0c, 0x92, 0xbe, 0xcd, 0x6b,
-  0x9f, 0xc6, 0xc9, 0xeb, 0xa0, 0x7f, 0xde, 0x60, 0xbb, 0x26, 0xf6, 0x81,
-  0x4d, 0x9d, 0x86, 0x89, 0x78, 0xd3, 0xda, 0x41, 0xdc, 0xbf, 0x11, 0xf5,
-  0xe9, 0x44, 0x67, 0xd9, 0xf7, 0x96, 0xb4, 0xe9, 0xe3, 0xa6, 0x4a, 0x37,
-  0xdf, 0x18, 0xce, 0x48, 0x75, 0xd6, 0xa6, 0x85, 0xe6, 0xc8, 0xc9, 0x3a,
-  0xec, 0x6a, 0xde, 0x55, 0x37, 0xa8, 0x65, 0x44, 0x61, 0x0d, 0xeb, 0x84,
-  0x98, 0x1a, 0x38, 0xa8, 0x02, 0x03, 0x57, 0x78, 0x55, 0x64, 0x18, 0x6f,
-  0x9e, 0x58, 0x75, 0x46, 0xa2, 0x15, 0xbb, 0x68, 0xe7, 0xd5, 0x55, 0x16,
-  0xae, 0x16, 0x72, 0x85, 0x43, 0x6e, 0xf7, 0xb9, 0x09, 0x78, 0x2b, 0x6b,
-  0xac, 0x5a, 0x54, 0x43, 0x1d, 0x42, 0x47, 0x87, 0xf0, 0x78, 0x56, 0x08,
-  0x6b, 0x3a, 0x84, 0x27, 0x33, 0x41, 0xc8, 0xa9, 0x0c, 0x60, 0x0e, 0xed,
-  0x66, 0xe3, 0x76, 0x7b, 0x84, 0x21, 0xad, 0xb8, 0x4d, 0x8e, 0x99, 0xb5,
-  0x5e, 0x93, 0x34, 0xf9, 0xde, 0xbf, 0xd9, 0x9a, 0x07, 0x42, 0x6e, 0x23,
-  0xb0, 0x80, 0x39, 0x72, 0x75, 0x83, 0x55, 0x65, 0x17, 0x6c, 0xe0, 0xa2,
-  0xc7, 0xe4, 0x4c, 0x8b, 0xb6, 0x85, 0x95, 0x86, 0x7f, 0x2c, 0xda, 0xce,
-  0x82, 0xb3, 0x0f, 0x18, 0xf0, 0xb3, 0xb9, 0x09, 0x53, 0xe6, 0x60, 0xc7,
-  0x2f, 0x33, 0xf9, 0xf3, 0x2a, 0x11, 0xa8, 0x0d, 0x09, 0x2d, 0x00, 0x9b,
-  0xec, 0x82, 0xd3, 0x97, 0x9e, 0x2f, 0x92, 0x7f, 0x8f, 0x7c, 0x9c, 0xf9,
-  0x45, 0x2a, 0x70, 0x7f, 0x16, 0x93, 0x7f, 0x4f, 0x4c, 0x3e, 0x0d, 0xb7,
-  0x5f, 0x38, 0x6e, 0xd0, 0x10, 0x2f, 0xb2, 0x2e, 0x8a, 0x8c, 0x03, 0xb4,
-  0xa3, 0xbf, 0x66, 0xf3, 0x71, 0xc3, 0xd9, 0x59, 0x46, 0x8f, 0xca, 0x9e,
-  0xa5, 0x8a, 0x90, 0x63, 0x33, 0xd7, 0x6f, 0xc1, 0xda, 0x31, 0xd3, 0xc9,
-  0x85, 0x65, 0x6d, 0xb0, 0xb4, 0xc5, 0x32, 0x46, 0x99, 0xcd, 0xd5, 0x6e,
-  0x6a, 0x6a, 0x16, 0xd4, 0xb9, 0x3a, 0x97, 0x1d, 0x7c, 0xb4, 0x4b, 0x58,
-  0x42, 0xe6, 0x27, 0x9c, 0x49, 0xc5, 0x28, 0x98, 0x92, 0x9f, 0x95, 0x02,
-  0x56, 0xf9, 0xf7, 0xbf, 0xab, 0x7a, 0xe9, 0xaa, 0xcc, 0xef, 0x56, 0x70,
-  0xf5, 0x56, 0x6c, 0x69, 0x0b, 0x7c, 0xca, 0x46, 0x8f, 0x1d, 0xe4, 0x05,
-  0x83, 0x3e, 0xe6, 0x40, 0xf8, 0x3d, 0x88, 0x46, 0xfe, 0x7a, 0xe9, 0x0e,
-  0x5a, 0x9e, 0x35, 0xf9, 0x94, 0x69, 0xc8, 0x82, 0xed, 0x81, 0xb7, 0xfa,
-  0x6d, 0xb5, 0x03, 0xe4, 0xda, 0x64, 0x7f, 0x6c, 0x94, 0xc2, 0x73, 0xec,
-  0x76, 0xb5, 0x73, 0xc6, 0xdc, 0xa9, 0x61, 0x21, 0xc8, 0xad, 0x09, 0xe4,
-  0xd6, 0x16, 0x81, 0xdc, 0x57, 0xc5, 0x91, 0x61, 0x21, 0x08, 0x3e, 0x16,
-  0x08, 0x3e, 0x5e, 0x04, 0x82, 0x63, 0xee, 0xee, 0xb0, 0x10, 0xd4, 0x9e,
-  0x0b, 0xd4, 0x9e, 0x2f, 0x04, 0xb5, 0xe2, 0x52, 0xd6, 0x45, 0x60, 0xd7,
-  0x59, 0xe5, 0xd8, 0x75, 0x56, 0x17, 0x81, 0x9d, 0xed, 0x16, 0xe5, 0x45,
-  0xa0, 0xb9, 0x26, 0xd0, 0x5c, 0x9b, 0x13, 0x4d, 0x34, 0x13, 0x76, 0x74,
-  0x93, 0x96, 0xd9, 0x8f, 0x0b, 0xca, 0xf8, 0x34, 0x98, 0x13, 0xf7, 0xce,
-  0x6d, 0xcc, 0x6c, 0xf5, 0x86, 0xb8, 0x85, 0x20, 0xb8, 0xd8, 0xd9, 0xad,
-  0x5d, 0xa5, 0xb3, 0x10, 0x0c, 0x17, 0x3b, 0xbd, 0xf1, 0x92, 0xa5, 0x45,
-  0xa1, 0xf5, 0xcb, 0x22, 0xd0, 0x5a, 0x59, 0xe1, 0x98, 0x65, 0xc1, 0xf8,
-  0x69, 0x09, 0x6a, 0x50, 0xae, 0x36, 0x6e, 0xcf, 0xeb, 0xe0, 0x46, 0x00,
-  0xeb, 0x2d, 0x28, 0x59, 0x38, 0x5e, 0x08, 0xd1, 0x16, 0x2c, 0x71, 0x4e,
-  0x27, 0xc3, 0xe1, 0xdb, 0x10, 0x0f, 0x54, 0x17, 0x82, 0xdd, 0x42, 0x05,
-  0xcd, 0x5a, 0xb5, 0xa0, 0xb1, 0x5e, 0xd1, 0x3a, 0x5f, 0x47, 0xd6, 0x6e,
-  0x43, 0xea, 0xb0, 0xdb, 0x82, 0xd0, 0xc5, 0x01, 0xd6, 0xc5, 0x8f, 0x67,
-  0xbd, 0xf3, 0xaf, 0x8b, 0xc1, 0x72, 0xb1, 0xa2, 0xa7, 0xfc, 0xaa, 0xe6,
-  0x85, 0x20, 0xbc, 0x08, 0x49, 0x64, 0xd1, 0xae, 0x9b, 0xe5, 0x46, 0xa0,
-  0xa9, 0x6c, 0x61, 0x57, 0xcd, 0xe5, 0x55, 0x16, 0x76, 0xe9, 0x68, 0x06,
-  0x31, 0x5f, 0x73, 0x9e, 0x09, 0xb8, 0x2d, 0xb5, 0xb2, 0xa9, 0xd9, 0x80,
-  0x5f, 0x62, 0xe0, 0x45, 0x03, 0x9a, 0xcd, 0x45, 0x52, 0x36, 0x8b, 0xa7,
-  0x59, 0x34, 0xa4, 0x7b, 0xd2, 0x53, 0xba, 0x97, 0xf1, 0x94, 0x6e, 0x2a,
-  0x37, 0xec, 0xb9, 0xf5, 0x8e, 0x6c, 0x66, 0x36, 0x3c, 0x17, 0x93, 0x15,
-  0xad, 0xbd, 0x43, 0x2f, 0x63, 0xae, 0x39, 0xfa, 0xb4, 0x2d, 0x39, 0xb9,
-  0x91, 0xdc, 0xa1, 0x24, 0x7b, 0x71, 0xa5, 0xf5, 0x8e, 0x57, 0x51, 0xed,
-  0xb3, 0x53, 0xe9, 0x90, 0x83, 0xea, 0x54, 0x8d, 0xe5, 0xea, 0xf7, 0x1d,
-  0xcb, 0xce, 0xe3, 0x9a, 0x83, 0x99, 0x57, 0x6e, 0x61, 0x47, 0x93, 0xab,
-  0xd2, 0x91, 0xb4, 0x1f, 0xed, 0xdd, 0x68, 0x28, 0x0d, 0x97, 0xd0, 0x82,
-  0xbe, 0x12, 0x55, 0xaf, 0xcb, 0x4a, 0x69, 0xe7, 0x58, 0xbb, 0xd8, 0xc8,
-  0x57, 0x90, 0x24, 0x38, 0xe7, 0xf4, 0xc3, 0x38, 0xf5, 0x70, 0x26, 0x3f,
-  0xe1, 0x66, 0x46, 0x7b, 0x51, 0xb3, 0x61, 0x3b, 0x78, 0x6e, 0x79, 0x4f,
-  0x72, 0xfb, 0xbd, 0x6c, 0x9d, 0x31, 0x8f, 0xe9, 0x35, 0x60, 0x6a, 0x09,
-  0x04, 0xc3, 0xce, 0xde, 0x80, 0x81, 0xb7, 0xf6, 0x77, 0x2d, 0xc7, 0xde,
-  0xdc, 0x87, 0x0a, 0x31, 0x47, 0xef, 0x7d, 0x09, 0x7b, 0xc1, 0xb5, 0x21,
-  0x68, 0xba, 0x8d, 0x93, 0xf3, 0x2c, 0x1b, 0xaf, 0xaf, 0xac, 0xdc, 0xbf,
-  0x96, 0xd0, 0x11, 0x4e, 0x40, 0xd3, 0x95, 0xb4, 0xff, 0xf2, 0xfe, 0x35,
-  0xd6, 0x9f, 0x3e, 0x18, 0xc5, 0x7d, 0xd8, 0xe2, 0x87, 0x9b, 0xf7, 0xaf,
-  0xf1, 0x18, 0x6d, 0x87, 0xce, 0xeb, 0x70, 0xdf, 0x8d, 0xd8, 0x36, 0x9a,
-  0xd3, 0x13, 0xf9, 0x2c, 0x50, 0xb8, 0x4a, 0x59, 0x5a, 0x47, 0xd6, 0xc3,
-  0x57, 0xc8, 0xc6, 0x7e, 0xe0, 0xc3, 0xde, 0xde, 0xcb, 0x7f, 0x76, 0x7c,
-  0x07, 0x5f, 0xbb, 0x8e, 0x67, 0x2a, 0x0d, 0xf2, 0x4b, 0x00, 0xf5, 0x9f,
-  0x23, 0x9e, 0x2a, 0xea, 0x9f, 0x23, 0xbf, 0xb2, 0x5a, 0xda, 0x87, 0x37,
-  0xc3, 0x83, 0x78, 0xac, 0x1a, 0xd6, 0xcd, 0x22, 0x4c, 0xf5, 0x90, 0x79,
-  0x6c, 0x16, 0xba, 0x4e, 0x66, 0xa5, 0x2b, 0x6a, 0x15, 0xdd, 0x77, 0x7b,
-  0x07, 0xde, 0x45, 0x30, 0x0a, 0xce, 0xc8, 0x0c, 0x55, 0x8c, 0x35, 0x5e,
-  0xcc, 0xc7, 0x4c, 0xd6, 0x96, 0x53, 0xe3, 0xc2, 0x81, 0x74, 0x18, 0x67,
-  0x6e, 0x8b, 0xf3, 0x43, 0xb2, 0x38, 0x03, 0x96, 0x98, 0xb5, 0x0e, 0x83,
-  0x14, 0x8e, 0x0e, 0x99, 0xa5, 0xe8, 0xe8, 0xa1, 0x74, 0xc8, 0xfc, 0x8b,
-  0x04, 0xab, 0xfc, 0xb0, 0x96, 0x35, 0xfd, 0x25, 0xbc, 0x82, 0x26, 0xa5,
-  0x4a, 0x55, 0x06, 0xfe, 0x0d, 0x13, 0xef, 0x5d, 0x74, 0xea, 0xad, 0x84,
-  0x42, 0x66, 0xf8, 0x68, 0x20, 0x20, 0xc0, 0x2b, 0x16, 0x14, 0xdc, 0xf0,
-  0xb7, 0x52, 0x8c, 0x5a, 0xf1, 0x02, 0xb2, 0xd9, 0x7b, 0x3c, 0xba, 0x44,
-  0x1e, 0x15, 0xe6, 0xe0, 0x46, 0xf6, 0xf0, 0xf4, 0x50, 0x6e, 0xf4, 0x88,
-  0x9c, 0xdc, 0x91, 0x45, 0xa1, 0x1f, 0xc5, 0xd9, 0x43, 0x3b, 0x3b, 0x0f,
-  0x47, 0x0d, 0x11, 0x10, 0x80, 0xa6, 0x43, 0xcd, 0xe0, 0x25, 0x85, 0x0b,
-  0x90, 0x61, 0x11, 0x8f, 0xba, 0x8b, 0x9f, 0xdc, 0x43, 0x98, 0x99, 0x1b,
-  0x5f, 0x03, 0x8a, 0x57, 0x86, 0x35, 0x54, 0xee, 0x6a, 0x6a, 0x74, 0x95,
-  0x77, 0x41, 0x6e, 0x5f, 0x95, 0xa1, 0x9c, 0x05, 0x57, 0xb0, 0x47, 0x2b,
-  0xc8, 0x1c, 0x2f, 0xc9, 0x31, 0x1a, 0x58, 0x4c, 0xee, 0x1d, 0xb0, 0x1e,
-  0x46, 0x7d, 0xe6, 0x2f, 0x09, 0xb7, 0x74, 0xd2, 0x63, 0x9e, 0xea, 0x8d,
-  0xd5, 0x96, 0xb7, 0xf6, 0xb8, 0x39, 0x7d, 0x70, 0xff, 0x7a, 0xa9, 0x60,
-  0x4c, 0x60, 0x47, 0xde, 0x7b, 0x87, 0x8d, 0x4f, 0xcc, 0xfc, 0x86, 0xff,
-  0xd8, 0xaf, 0x28, 0xca, 0xdc, 0x0d, 0xf3, 0x43, 0xce, 0xb2, 0x62, 0x79,
-  0xa7, 0x90, 0x22, 0x88, 0x67, 0xda, 0x10, 0xc0, 0x53, 0xb6, 0x40, 0x54,
-  0x54, 0x16, 0xa3, 0x92, 0x97, 0xbe, 0xae, 0xf0, 0x7d, 0x11, 0xae, 0x53,
-  0x52, 0x83, 0xe5, 0x5a, 0xdf, 0xd4, 0xf9, 0x75, 0xea, 0x32, 0xb5, 0xca,
-  0x8b, 0x41, 0xa9, 0x4e, 0x68, 0x3a, 0x8c, 0x48, 0xcc, 0xd8, 0x47, 0x8b,
-  0x85, 0xa0, 0x1e, 0x95, 0x55, 0xc4, 0xb0, 0x55, 0x2e, 0x14, 0xa3, 0xf4,
-  0xc8, 0x35, 0x4a, 0x5c, 0x45, 0xe8, 0x82, 0x6c, 0xc0, 0x53, 0x54, 0xd4,
-  0x3f, 0x1a, 0xbe, 0xe1, 0xa1, 0xe9, 0x37, 0xc9, 0xa2, 0x4f, 0xbe, 0x20,
-  0x1a, 0x4d, 0x6b, 0x0c, 0xad, 0xe0, 0x53, 0x60, 0xea, 0x15, 0x9e, 0x77,
-  0x49, 0xdc, 0xc1, 0xfa, 0x52, 0x67, 0x3b, 0x8d, 0x24, 0xc0, 0x9c, 0x4f,
-  0x56, 0x2d, 0x74, 0x91, 0x7a, 0xcf, 0x2c, 0xdf, 0xd6, 0xfe, 0x2b, 0x13,
-  0x84, 0x95, 0x7b, 0xb9, 0x5a, 0x2d, 0x89, 0xed, 0x94, 0xaa, 0xe8, 0xe8,
-  0x2c, 0xae, 0x00, 0x7c, 0x67, 0x7e, 0x03, 0x4f, 0x0d, 0xa8, 0x76, 0xb0,
-  0xb7, 0xb3, 0xb7, 0xee, 0x61, 0xc6, 0x7d, 0xf2, 0x22, 0x8a, 0xb5, 0x2c,
-  0x05, 0xb6, 0x3e, 0x77, 0x6e, 0xda, 0xe7, 0x19, 0xe7, 0xef, 0x5c, 0x73,
-  0x77, 0x86, 0x79, 0x3b, 0xc3, 0x9c, 0xb5, 0xcf, 0x57, 0xdb, 0x5c, 0xb5,
-  0xce, 0x53, 0x65, 0x4e, 0x02, 0x33, 0xe6, 0x05, 0x14, 0x16, 0xc4, 0x70,
-  0x0f, 0x5c, 0x55, 0xde, 0x1e, 0xbc, 0x7f, 0xa7, 0xb1, 0x20, 0x0c, 0xb3,
-  0x96, 0xf5, 0x4f, 0x56, 0x22, 0x8a, 0x43, 0xc2, 0x87, 0x5b, 0x0f, 0x5b,
-  0xde, 0xc3, 0x57, 0xf8, 0xd8, 0xc6, 0xc7, 0x0e, 0x3e, 0x5e, 0xe3, 0xe3,
-  0x0d, 0x3e, 0x7e, 0xc7, 0xc7, 0x5b, 0x7c, 0xec, 0xe2, 0xe3, 0x3f, 0xf1,
-  0xf1, 0x07, 0x3e, 0xde, 0xe1, 0xe3, 0x3d, 0x3e, 0x3e, 0xe0, 0x63, 0x0f,
-  0x1f, 0xfb, 0xf8, 0xf8, 0x2f, 0x7c, 0x7c, 0xc4, 0x47, 0x17, 0x1f, 0x07,
-  0xf8, 0xf8, 0x84, 0x8f, 0x3f, 0xf1, 0xf1, 0x19, 0x1f, 0xff, 0x0b, 0x1f,
-  0xff, 0x8d, 0x8f, 0xff, 0xfd, 0xb0, 0x38, 0x25, 0x7c, 0x18, 0xe0, 0x9b,
-  0x1e, 0x3e, 0xfa, 0xf8, 0x18, 0xe0, 0x23, 0xc4, 0xc7, 0x29, 0x3e, 0xce,
-  0xf0, 0x71, 0x8e, 0x8f, 0x08, 0x1f, 0x7f, 0xe1, 0xe3, 0x0b, 0x3e, 0x86,
-  0xf8, 0xb8, 0xc0, 0xc7, 0x08, 0x1f, 0x31, 0x3e, 0xc6, 0xf8, 0xf8, 0x17,
-  0x3e, 0x12, 0x7c, 0xa4, 0xf8, 0xc8, 0xf0, 0x31, 0xc1, 0xc7, 0x57, 0x7c,
-  0x5c, 0xe2, 0xe3, 0x1b, 0x3e, 0xae, 0xf0, 0xf1, 0xb7, 0x8c, 0xc9, 0x2a,
-  0xbe, 0xe9, 0xe0, 0x63, 0x0d, 0x1f, 0x8f, 0xf0, 0xf1, 0x18, 0x1f, 0x4f,
-  0xf0, 0xf1, 0x14, 0x1f, 0xcf, 0xf0, 0xf1, 0x1c, 0x1f, 0xff, 0xc0, 0xc7,
-  0x32, 0x3e, 0xda, 0xf8, 0x38, 0xc6, 0xc7, 0xff, 0xc1, 0x47, 0x03, 0x1f,
-  0x4d, 0x7c, 0xfc, 0x82, 0x8f, 0x5f, 0xf1, 0xb1, 0x8e, 0x8f, 0xd6, 0x43,
-  0x16, 0xd4, 0xc8, 0xa2, 0x9c, 0xfa, 0xe7, 0x18, 0xe3, 0x34, 0xd0, 0x23,
-  0x9c, 0xf8, 0x48, 0x9d, 0xc8, 0x61, 0xf5, 0x15, 0x49, 0x8f, 0x51, 0xad,
-  0x12, 0xda, 0x89, 0x50, 0x58, 0xf0, 0x60, 0x1f, 0x80, 0x4f, 0x8b, 0x0f,
-  0x79, 0x22, 0x52, 0x58, 0x99, 0xcf, 0x13, 0xf3, 0x03, 0xcf, 0x40, 0x9a,
-  0x32, 0xde, 0x2a, 0x3e, 0x5b, 0x12, 0x8f, 0x1a, 0x4e, 0x04, 0xd4, 0xa8,
-  0x09, 0x37, 0x0b, 0x36, 0x7d, 0x0c, 0x9d, 0x79, 0xf0, 0x1f, 0xdf, 0x82,
-  0x8d, 0x6f, 0xcf, 0x9e, 0x3e, 0x2f, 0x3e, 0x4a, 0x1a, 0x61, 0xfe, 0x8e,
-  0xe7, 0x36, 0x66, 0xb0, 0x04, 0xf2, 0x45, 0xde, 0x81, 0x13, 0x31, 0x13,
-  0x58, 0xa4, 0xd4, 0xc3, 0x87, 0xf2, 0x94, 0xe0, 0x68, 0xe3, 0x6c, 0x48,
-  0x49, 0x89, 0xb4, 0x0b, 0x65, 0x28, 0xf6, 0x12, 0xff, 0xd8, 0x64, 0x6e,
-  0x0f, 0xa6, 0x1a, 0x22, 0x81, 0xd4, 0x66, 0xbd, 0x2e, 0xeb, 0xe3, 0x04,
-  0x76, 0x1c, 0xb0, 0x04, 0x44, 0xb4, 0x67, 0x84, 0xff, 0x7e, 0x93, 0x05,
-  0xac, 0x88, 0x97, 0x80, 0x0f, 0x4b, 0x4b, 0x66, 0xf0, 0x55, 0x58, 0xe9,
-  0x1a, 0x23, 0x8f, 0xa3, 0xe6, 0x9b, 0x11, 0x0e, 0xdd, 0xda, 0x9b, 0x53,
-  0x01, 0x8d, 0x98, 0xd6, 0x59, 0x05, 0x06, 0x07, 0x0d, 0xc0, 0x70, 0x09,
-  0xc3, 0x56, 0x39, 0xec, 0x7e, 0x83, 0xa2, 0x6b, 0x61, 0xdf, 0xd8, 0x28,
-  0x6b, 0x41, 0xc4, 0x4b, 0xb7, 0xbc, 0xce, 0x6a, 0xb3, 0xd9, 0x34, 0x36,
-  0xc1, 0xaa, 0xc0, 0xd6, 0x28, 0xaa, 0x6e, 0x74, 0x56, 0x7a, 0xd1, 0x88,
-  0xc6, 0x2c, 0xc5, 0x8c, 0x8b, 0xc6, 0xba, 0xad, 0x6b, 0xcd, 0x09, 0x8f,
-  0x44, 0x26, 0x78, 0xe2, 0x47, 0x3b, 0x40, 0x7f, 0x85, 0x57, 0x93, 0xd3,
-  0x53, 0xd0, 0x49, 0x9a, 0x46, 0x1d, 0xe9, 0xab, 0x45, 0x4b, 0x91, 0xbe,
-  0xca, 0x01, 0xb2, 0xa0, 0x97, 0x28, 0x12, 0xdb, 0x1a, 0x8f, 0xcb, 0xa3,
-  0xd2, 0x5b, 0xcc, 0x8d, 0x07, 0xd5, 0x99, 0x5f, 0x6d, 0xcc, 0x51, 0xe2,
-  0xa7, 0x96, 0x6a, 0x71, 0xed, 0xca, 0xea, 0xc8, 0x02, 0x71, 0x94, 0x96,
-  0x8d, 0xe0, 0x67, 0x09, 0xfd, 0x96, 0x67, 0xe0, 0xa3, 0x3a, 0x69, 0x4c,
-  0x37, 0xea, 0x1a, 0x93, 0xec, 0xe6, 0x29, 0xdb, 0xe2, 0x54, 0xb0, 0x0e,
-  0x0e, 0xb3, 0x60, 0x0c, 0x89, 0xce, 0xe2, 0x90, 0xbc, 0xf8, 0x24, 0x4d,
-  0x12, 0xb4, 0xbe, 0xa2, 0xa9, 0x79, 0xdd, 0x7c, 0xa5, 0xb9, 0x7d, 0x8b,
-  0x40, 0xcb, 0x3c, 0x88, 0x6f, 0xc3, 0xa8, 0xb2, 0x66, 0x81, 0xb2, 0x56,
-  0x02, 0x85, 0xa2, 0xfd, 0x4c, 0x30, 0x8f, 0x2c, 0x60, 0x1e, 0x95, 0x80,
-  0xc1, 0xb0, 0x40, 0x13, 0xca, 0x13, 0x0b, 0x94, 0x27, 0x0e, 0x28, 0x79,
-  0x8c, 0xa0, 0x09, 0xe6, 0xa9, 0x05, 0xcc, 0x53, 0x3b, 0x98, 0x9d, 0xbd,
-  0xcf, 0x1f, 0xba, 0xdb, 0x5b, 0xef, 0x5e, 0x5b, 0xc0, 0x3c, 0xb6, 0x57,
-  0x11, 0x91, 0x8b, 0x46, 0x85, 0x8e, 0xab, 0xc2, 0xd3, 0xe7, 0xdf, 0x9e,
-  0x3c, 0x7b, 0x6a, 0x56, 0x58, 0xeb, 0xac, 0xa3, 0x4e, 0xd2, 0xbb, 0xc2,
-  0x94, 0x6f, 0x5e, 0xc7, 0xf8, 0xbc, 0x26, 0x7f, 0x5e, 0xb3, 0xc2, 0x7e,
-  0xf5, 0xdf, 0xfb, 0x5b, 0xdd, 0xae, 0x04, 0x7a, 0xc0, 0x52, 0x46, 0xdb,
-  0x31, 0xd9, 0xfe, 0xd4, 0x3d, 0xd8, 0x7b, 0xef, 0x57, 0x88, 0x9e, 0xd7,
-  0x49, 0x12, 0x27, 0x1f, 0xd1, 0x96, 0xa8, 0x09, 0x21, 0x49, 0xf3, 0x54,
-  0x6b, 0x6c, 0x8d, 0x06, 0xbb, 0xa3, 0x28, 0x43, 0xc9, 0xb6, 0xba, 0x2a,
-  0xf3, 0xbb, 0xb5, 0x98, 0x6d, 0x63, 0x20, 0xe9, 0x8f, 0xba, 0x24, 0xb2,
-  0x6b, 0xac, 0x64, 0x19, 0x71, 0xa8, 0xa8, 0xae, 0xee, 0xd8, 0x6d, 0xc9,
-  0xb6, 0x69, 0x1c, 0x01, 0x9a, 0x9f, 0x76, 0xb9, 0xef, 0x91, 0xa2, 0xd3,
-  0x62, 0x94, 0xce, 0xef, 0x30, 0x8b, 0xb3, 0x20, 0x9b, 0x14, 0x5a, 0xb5,
-  0x45, 0x9d, 0x66, 0x20, 0xf4, 0x26, 0x2b, 0xb4, 0xe5, 0x0a, 0xe3, 0xb7,
-  0xcd, 0x4e, 0xaa, 0x97, 0x91, 0x06, 0xe9, 0x3c, 0x1a, 0x84, 0x18, 0xe4,
-  0x4a, 0xc6, 0xe1, 0x8e, 0xea, 0x5d, 0x3e, 0xcd, 0xe3, 0x87, 0x9d, 0xe4,
-  0x32, 0x36, 0xbc, 0xce, 0x82, 0xb9, 0xb9, 0x0c, 0xed, 0x3f, 0x51, 0x2a,
-  0xdb, 0x44, 0x41, 0xfe, 0x46, 0x01, 0x2e, 0xe8, 0x8d, 0xd3, 0xc9, 0xa8,
-  0xcf, 0x46, 0x91, 0xfe, 0xca, 0x43, 0xa3, 0xc7, 0xac, 0x4e, 0x8b, 0x5e,
-  0xd3, 0x77, 0xfe, 0xa6, 0x58, 0xbd, 0x80, 0xa1, 0xf3, 0x8a, 0x82, 0xe6,
-  0x24, 0xc9, 0x61, 0x51, 0x8d, 0xb3, 0x18, 0x95, 0xb3, 0x36, 0x34, 0x07,
-  0x58, 0xe2, 0x7a, 0x38, 0x10, 0x55, 0x9a, 0xcd, 0x96, 0xc0, 0x08, 0x5a,
-  0x4b, 0xe3, 0xe1, 0xd7, 0xb0, 0x71, 0x78, 0x84, 0x4b, 0x2f, 0xe2, 0x8a,
-  0x19, 0xbd, 0x61, 0xd7, 0x5b, 0xa0, 0xca, 0x0e, 0xa5, 0xde, 0xc2, 0x6b,
-  0x7d, 0xeb, 0x0e, 0x9a, 0xcc, 0x39, 0x7b, 0x6d, 0x6c, 0xcf, 0x29, 0x2f,
-  0x38, 0xba, 0x4b, 0xc9, 0x32, 0x5f, 0x2a, 0x75, 0x99, 0x44, 0xa8, 0x3e,
-  0x50, 0xb1, 0x96, 0xf7, 0x0b, 0xfe, 0xcf, 0x29, 0xcf, 0x58, 0x01, 0x9b,
-  0x6b, 0x88, 0xd7, 0x45, 0x48, 0x0a, 0x73, 0x8e, 0x12, 0xb1, 0x97, 0x18,
-  0x7a, 0x6c, 0x35, 0x33, 0x0e, 0xb4, 0x12, 0x06, 0x7a, 0x4a, 0x81, 0x1a,
-  0x78, 0xaa, 0xe5, 0x01, 0x61, 0xe5, 0x85, 0x82, 0xb9, 0x82, 0x5d, 0xc3,
-  0x28, 0xa8, 0xf5, 0x65, 0x5b, 0x37, 0x63, 0x38, 0xcc, 0xa6, 0x66, 0xa9,
-  0x3a, 0x16, 0x11, 0x57, 0x77, 0xcc, 0xa2, 0xd0, 0x25, 0xe3, 0xa5, 0xd2,
-  0x2d, 0x03, 0xd1, 0x86, 0xb5, 0x82, 0xa6, 0x09, 0x0b, 0xae, 0xa1, 0x81,
-  0x54, 0x2d, 0xef, 0xec, 0x55, 0x21, 0x1c, 0x72, 0xcd, 0xb6, 0x17, 0x0f,
-  0xae, 0xda, 0xb4, 0x7d, 0x21, 0x87, 0x3e, 0x66, 0x1f, 0x68, 0xe4, 0xd9,
-  0xe6, 0x97, 0x71, 0xfa, 0xfa, 0xcd, 0x92, 0x23, 0x15, 0x17, 0xa4, 0x60,
-  0x30, 0x70, 0x82, 0xd1, 0xf0, 0x36, 0x58, 0x4c, 0x1d, 0x46, 0x7d, 0x7c,
-  0xca, 0x54, 0x73, 0x66, 0xcd, 0xe6, 0x59, 0xbd, 0x36, 0x0b, 0x4e, 0xf2,
-  0x15, 0x6b, 0xb6, 0x06, 0xff, 0x5a, 0xd6, 0xb8, 0x0d, 0xbf, 0x49, 0x96,
-  0x15, 0xcf, 0x6f, 0xba, 0x8e, 0x10, 0xb4, 0xe0, 0xe4, 0x5a, 0x4e, 0x9e,
-  0x75, 0xc8, 0xcf, 0xd3, 0x6b, 0x55, 0x0e, 0x80, 0xb1, 0x4b, 0xe0, 0x08,
-  0x6b, 0x4d, 0x96, 0x23, 0x5d, 0xc3, 0x5b, 0xb4, 0x72, 0xa0, 0x9d, 0x08,
-  0x97, 0x37, 0xad, 0x0e, 0xa0, 0xdf, 0xce, 0x13, 0x84, 0x35, 0x15, 0x4f,
-  0x60, 0x55, 0xca, 0x94, 0xbb, 0x04, 0x6b, 0xfc, 0x65, 0x9d, 0xf6, 0x6c,
-  0x3e, 0xcd, 0x36, 0xc3, 0x25, 0x9b, 0xa7, 0x32, 0xbb, 0x14, 0x58, 0x8e,
-  0xa3, 0x2c, 0xe8, 0xb9, 0x01, 0xb1, 0x92, 0x57, 0xac, 0x03, 0x5e, 0x05,
-  0xb4, 0x62, 0x2c, 0x6d, 0x63, 0x62, 0x02, 0xa9, 0x39, 0x2a, 0x2a, 0x15,
-  0x6b, 0x8e, 0x4a, 0x41, 0xea, 0x7c, 0xf7, 0x34, 0x4c, 0x59, 0xa2, 0x90,
-  0x75, 0xef, 0x5a, 0x04, 0x14, 0x93, 0xf0, 0xfc, 0x12, 0x5e, 0xb5, 0x3c,
-  0x3a, 0xd2, 0xd3, 0xc8, 0x2a, 0xc6, 0x4a, 0x54, 0x54, 0x47, 0x30, 0x7f,
-  0x0b, 0x4b, 0xcd, 0xf5, 0x74, 0xa3, 0xac, 0xe2, 0x21, 0x34, 0x81, 0x11,
-  0x4c, 0xd4, 0xc8, 0x86, 0x94, 0x53, 0xa0, 0x1f, 0x0c, 0x45, 0x59, 0xdc,
-  0xfe, 0x64, 0xe1, 0x45, 0xc3, 0x2f, 0xa8, 0x96, 0x6b, 0x20, 0x30, 0x5c,
-  0xff, 0xd9, 0xdd, 0xfb, 0xd0, 0x66, 0xa7, 0x27, 0xd1, 0xe9, 0x55, 0xc3,
-  0xd2, 0x48, 0xb3, 0xa9, 0xe4, 0x29, 0x22, 0x06, 0xc3, 0xa3, 0xa5, 0xca,
-  0x3e, 0x11, 0x68, 0xda, 0x3a, 0x36, 0x14, 0x8c, 0xce, 0xca, 0x30, 0xa2,
-  0x15, 0xd6, 0xbf, 0x9e, 0xca, 0xb3, 0x97, 0x6b, 0xdf, 0x2e, 0x02, 0xc8,
-  0x79, 0x5c, 0xd8, 0x20, 0x69, 0x31, 0x05, 0x38, 0x65, 0xc4, 0x2b, 0xd3,
-  0x24, 0xa0, 0xeb, 0x41, 0xe9, 0x30, 0xea, 0x83, 0x36, 0x14, 0x0c, 0x87,
-  0x45, 0x25, 0x63, 0x35, 0x96, 0x43, 0x4d, 0x10, 0x7c, 0x34, 0x20, 0xc0,
-  0xb9, 0x2b, 0xce, 0x31, 0x1d, 0x5e, 0xc1, 0xff, 0xb4, 0x53, 0x96, 0x1a,
-  0xad, 0xe7, 0xe1, 0x2e, 0x05, 0x21, 0x54, 0x9c, 0x3d, 0xd2, 0xb4, 0xc6,
-  0xd6, 0xa5, 0x4c, 0x16, 0xf5, 0x1c, 0xf6, 0xa5, 0xa5, 0xcc, 0x8c, 0xed,
-  0xa4, 0x28, 0x41, 0x75, 0x01, 0x53, 0x67, 0x9d, 0x3b, 0x3b, 0x03, 0x70,
-  0xd3, 0xd5, 0x30, 0x6c, 0x73, 0x98, 0x3c, 0x0e, 0xe2, 0x5e, 0x11, 0x36,
-  0xe5, 0xf7, 0xd0, 0xd1, 0xa9, 0xc8, 0x45, 0x58, 0x44, 0x43, 0x69, 0xa2,
-  0x4f, 0x38, 0x0e, 0x94, 0xfb, 0x0c, 0x15, 0x31, 0x77, 0x3c, 0x60, 0xce,
-  0x7b, 0xa1, 0xba, 0x9a, 0x24, 0x21, 0x14, 0x49, 0xb3, 0xad, 0x51, 0x74,
-  0x41, 0x3e, 0x6b, 0x6f, 0xd0, 0x25, 0xd5, 0xba, 0xe3, 0xa8, 0x3a, 0x95,
-  0xb7, 0xb6, 0xba, 0x51, 0x07, 0xc4, 0x8d, 0x4e, 0xe8, 0xcb, 0x03, 0x0c,
-  0xd5, 0xb0, 0xbd, 0xa9, 0x4b, 0x3f, 0xc1, 0x2b, 0xde, 0xf7, 0xe3, 0x44,
-  0xdf, 0x33, 0xe6, 0x0b, 0xa2, 0xf8, 0x83, 0x6f, 0xd5, 0xf8, 0xe0, 0x01,
-  0xef, 0x80, 0xde, 0x0f, 0x0b, 0x56, 0x76, 0xd5, 0xf0, 0x97, 0x97, 0xbf,
-  0x02, 0x10, 0xbc, 0x66, 0x11, 0xf4, 0x21, 0xf2, 0x5d, 0x6c, 0xc1, 0x2e,
-  0x6e, 0x34, 0x88, 0x2f, 0x99, 0x38, 0x65, 0x38, 0x7b, 0x4b, 0x9e, 0x3f,
-  0xfe, 0xe6, 0xcb, 0x53, 0x45, 0xda, 0x3e, 0xb9, 0x9d, 0x51, 0x80, 0x06,
-  0x2c, 0x07, 0x8a, 0xc6, 0xb0, 0x84, 0x08, 0xf2, 0x2b, 0x67, 0xa4, 0x75,
-  0x62, 0x92, 0xa6, 0xee, 0x5a, 0xf6, 0x06, 0xb7, 0x54, 0x22, 0x53, 0x20,
-  0xdb, 0x54, 0x62, 0x5b, 0x8a, 0xc5, 0x4e, 0x4a, 0x98, 0x90, 0x1b, 0xef,
-  0xe2, 0x2f, 0x32, 0x8f, 0xa0, 0x2b, 0xd5, 0x25, 0x85, 0x5a, 0xd3, 0xa6,
-  0xac, 0x71, 0xf2, 0xf6, 0xe0, 0x60, 0xdf, 0xbb, 0x7f, 0x9d, 0x17, 0x4f,
-  0x09, 0xf2, 0xd4, 0x5b, 0x36, 0x5f, 0xe2, 0x68, 0xe4, 0x67, 0x7d, 0x8a,
-  0x57, 0x85, 0x28, 0xa8, 0x9c, 0xef, 0x05, 0x83, 0x77, 0x28, 0x0c, 0x61,
-  0xd9, 0x21, 0xc1, 0x81, 0x17, 0xc3, 0x18, 0x5a, 0x22, 0x96, 0x22, 0x47,
-  0x14, 0xc4, 0x08, 0x4b, 0x7e, 0xa4, 0x17, 0x62, 0xa7, 0xca, 0x3e, 0xa3,
-  0xf2, 0xf2, 0xfa, 0x2b, 0x8c, 0x19, 0x6a, 0x32, 0xe8, 0x36, 0xd8, 0xa0,
-  0x6c, 0x3f, 0x40, 0xb2, 0x46, 0x88, 0xaf, 0x35, 0x06, 0x1f, 0xc4, 0x3c,
-  0xe7, 0x4b, 0x83, 0x57, 0xe7, 0x7b, 0xbc, 0xc2, 0xc8, 0x26, 0x81, 0xc6,
-  0xff, 0xb6, 0xd2, 0x2d, 0xc9, 0xc0, 0x49, 0x78, 0xe6, 0xdb, 0xd4, 0x9e,
-  0xb8, 0xb3, 0x49, 0x5c, 0xcb, 0x95, 0xef, 0x01, 0x07, 0x31, 0xbf, 0x4c,
-  0xc9, 0xdc, 0x01, 0xb2, 0x4a, 0xd8, 0x1d, 0x9e, 0x24, 0x0e, 0x5f, 0x62,
-  0xe2, 0xdc, 0xc2, 0x2f, 0x0a, 0xdf, 0x64, 0x78, 0x69, 0x79, 0xf1, 0x8a,
-  0x59, 0x6c, 0xfd, 0x95, 0x74, 0x1c, 0x9d, 0x9e, 0xa6, 0x2b, 0x83, 0x28,
-  0xf1, 0x4d, 0xfb, 0x2c, 0x33, 0xcc, 0xb6, 0xff, 0x4a, 0xe3, 0x91, 0xc5,
-  0x14, 0x4b, 0xf7, 0x47, 0x69, 0xe4, 0x90, 0x90, 0x41, 0xf7, 0x9c, 0x02,
-  0x29, 0xe6, 0x5d, 0xc9, 0x50, 0xa0, 0xd7, 0x46, 0x1c, 0x2e, 0xb7, 0xcc,
-  0xe0, 0x1e, 0x3c, 0x2f, 0x43, 0x87, 0x2e, 0xe3, 0x20, 0x3b, 0x67, 0xcb,
-  0x80, 0x45, 0xb8, 0x68, 0x06, 0x68, 0xd1, 0x1d, 0x7e, 0x95, 0xd2, 0x4b,
-  0x04, 0xb3, 0x79, 0xff, 0x1a, 0x41, 0x38, 0xdd, 0x17, 0x2c, 0x4c, 0x5d,
-  0x16, 0x40, 0x2a, 0xe7, 0x01, 0xb2, 0x18, 0xe3, 0x45, 0x01, 0x60, 0x98,
-  0x93, 0xfb, 0xd7, 0x38, 0x0e, 0xd3, 0x95, 0xfb, 0xd7, 0xd4, 0x75, 0xe3,
-  0xe8, 0x9a, 0x31, 0xd0, 0x28, 0x94, 0xfd, 0xf1, 0xb4, 0x8e, 0xb9, 0x66,
-  0xa3, 0x84, 0xf5, 0x83, 0x07, 0x0e, 0xe3, 0x79, 0xc9, 0x31, 0xa5, 0xa9,
-  0x06, 0x30, 0x83, 0x08, 0xb7, 0x86, 0x6c, 0x18, 0xae, 0x05, 0xee, 0x21,
-  0xe7, 0x42, 0x89, 0x38, 0xbc, 0x48, 0x44, 0x97, 0x0f, 0xa1, 0x92, 0x69,
-  0xee, 0xd4, 0x9d, 0x21, 0x10, 0x53, 0x4a, 0x4a, 0xdc, 0x73, 0xc8, 0xf2,
-  0xf7, 0xa1, 0x1a, 0x26, 0xe7, 0xba, 0xac, 0x95, 0x83, 0x4e, 0x49, 0x19,
-  0xc9, 0xd0, 0x93, 0x20, 0xa3, 0xfe, 0x24, 0xd4, 0xa8, 0x42, 0x43, 0xd3,
-  0xf1, 0xaf, 0x82, 0xc0, 0x33, 0x7b, 0x6a, 0x6f, 0x1d, 0x4c, 0x7d, 0x11,
-  0x44, 0xa3, 0xb7, 0x42, 0xf8, 0xa8, 0x41, 0x9f, 0x0d, 0x1b, 0xdc, 0x17,
-  0x2f, 0xd0, 0xdf, 0xc6, 0x7b, 0xe0, 0xad, 0x3d, 0x79, 0xd2, 0xaa, 0x55,
-  0xbc, 0xf3, 0x74, 0xa6, 0xe2, 0xcf, 0x67, 0x2a, 0xbd, 0x6a, 0x94, 0x3e,
-  0xd2, 0x7b, 0xc8, 0x36, 0x7a, 0x42, 0x2d, 0x54, 0xbb, 0xd8, 0x6e, 0xb7,
-  0x0b, 0x02, 0xb4, 0xf4, 0x4f, 0x3a, 0x05, 0x61, 0x55, 0x8a, 0x32, 0x4c,
-  0xa9, 0xc8, 0x4f, 0x5c, 0x89, 0x55, 0xfa, 0x6a, 0x88, 0x6d, 0xd3, 0x80,
-  0x32, 0x1b, 0xaf, 0x71, 0x7e, 0x03, 0x4c, 0xe1, 0xc9, 0x2d, 0x74, 0xdc,
-  0x70, 0x87, 0x59, 0x25, 0x1b, 0x5a, 0x06, 0xd8, 0xd3, 0x66, 0xb3, 0xe9,
-  0x9c, 0xa0, 0x46, 0xde, 0x52, 0x60, 0xc0, 0xc3, 0xa3, 0xa6, 0x95, 0x56,
-  0x42, 0x2c, 0xbd, 0x1a, 0xc6, 0x3d, 0x6a, 0x84, 0xfe, 0x38, 0xd4, 0x9a,
-  0x93, 0x68, 0xd9, 0x04, 0x40, 0xde, 0x09, 0x9d, 0xe8, 0x8a, 0xb0, 0x7e,
-  0x76, 0xc1, 0x99, 0x2a, 0xca, 0xd0, 0xba, 0x78, 0xe2, 0xdc, 0xd8, 0xcf,
-  0x24, 0xb2, 0x4e, 0x6c, 0xbe, 0x0b, 0xf9, 0x22, 0xe7, 0x5c, 0x5a, 0xaf,
-  0xe5, 0x64, 0x6e, 0xde, 0x54, 0xd7, 0xc7, 0x64, 0x57, 0x3e, 0xac, 0xcf,
-  0x24, 0x94, 0x99, 0x6b, 0x97, 0x2f, 0x87, 0xba, 0x58, 0x21, 0x8b, 0x32,
-  0x97, 0x28, 0xfc, 0x74, 0x8f, 0xb6, 0x13, 0x8d, 0xc7, 0x2d, 0xef, 0xa9,
-  0xa4, 0xdb, 0x4b, 0xa5, 0x0f, 0x57, 0x8f, 0xc8, 0xab, 0x6e, 0xf5, 0xdb,
-  0xb3, 0x1e, 0xee, 0x7d, 0xe4, 0x4f, 0x1d, 0xf1, 0x69, 0x4d, 0x71, 0x84,
-  0x97, 0x7a, 0xa0, 0x11, 0x49, 0xe4, 0xd3, 0xd7, 0x0d, 0x28, 0x40, 0xbc,
-  0x2d, 0x4c, 0xfb, 0xd5, 0xf0, 0x77, 0x47, 0xec, 0x8a, 0x43, 0xbe, 0x4a,
-  0x23, 0x3b, 0x6b, 0x19, 0x0a, 0xdc, 0x16, 0x79, 0xb9, 0x5d, 0x63, 0x03,
-  0x93, 0x37, 0xad, 0x3a, 0x99, 0x2c, 0x06, 0x8e, 0x86, 0xa1, 0xe2, 0x3e,
-  0x36, 0x2f, 0xe8, 0x8d, 0x4a, 0x87, 0xd0, 0xde, 0xaa, 0x32, 0xa4, 0x30,
-  0x62, 0x2d, 0xaf, 0xd7, 0x51, 0xdf, 0x75, 0xf0, 0xdd, 0x9a, 0xfa, 0x6e,
-  0x0d, 0xdf, 0x3d, 0x52, 0xdf, 0x3d, 0x3a, 0x32, 0xb9, 0x86, 0x8b, 0xe8,
-  0x06, 0xb4, 0xf3, 0xdb, 0x6f, 0x24, 0x50, 0x97, 0xe0, 0x47, 0x07, 0x7f,
-  0xa0, 0xb8, 0xc4, 0x1f, 0x6b, 0xf8, 0xe3, 0x39, 0xfe, 0xdd, 0x7b, 0x64,
-  0x01, 0x40, 0xab, 0x03, 0x80, 0x90, 0x44, 0x83, 0x8d, 0x05, 0xa5, 0xe6,
-  0x96, 0xbc, 0xc7, 0xb2, 0xa2, 0x24, 0x89, 0x30, 0x5b, 0xd6, 0xda, 0xbe,
-  0x5c, 0x56, 0xa4, 0x92, 0x35, 0xf1, 0xb0, 0x6d, 0xfd, 0x65, 0x0c, 0x9b,
-  0xfa, 0xf4, 0x42, 0x05, 0x8a, 0x55, 0x6a, 0xc3, 0x4e, 0x3e, 0x6d, 0xc8,
-  0x60, 0x9a, 0x85, 0x4a, 0xc8, 0x12, 0x60, 0xab, 0xd8, 0x9b, 0x0a, 0xa3,
-  0xa9, 0xad, 0x99, 0x0a, 0xa6, 0x53, 0x77, 0xc3, 0x3f, 0x73, 0xaf, 0xd8,
-  0x86, 0x55, 0x73, 0xc0, 0x22, 0x3c, 0xa1, 0x5d, 0x6a, 0x9b, 0xe3, 0x80,
-  0x65, 0x8b, 0x50, 0x5d, 0x52, 0xc8, 0x71, 0x28, 0x40, 0x1f, 0x19, 0x4b,
-  0x35, 0xde, 0xae, 0xce, 0x03, 0xca, 0x49, 0xd3, 0xe7, 0x3f, 0x65, 0x85,
-  0x48, 0x14, 0x69, 0x07, 0xe3, 0x71, 0x38, 0x1a, 0x34, 0xd8, 0x4d, 0x92,
-  0x2d, 0xaf, 0x10, 0xca, 0x32, 0x5a, 0xc0, 0x70, 0xd7, 0x22, 0xf5, 0x27,
-  0x54, 0x00, 0xb4, 0x68, 0xcb, 0xbb, 0x12, 0xf7, 0xb3, 0x30, 0x5b, 0x06,
-  0x25, 0x22, 0x0c, 0x2e, 0x7c, 0xe0, 0xf9, 0x96, 0x27, 0x90, 0xe2, 0xce,
-  0xb3, 0x8d, 0x4e, 0xd3, 0xd4, 0xb4, 0x34, 0xd5, 0x9b, 0xdd, 0x76, 0x09,
-  0x6d, 0xab, 0x53, 0xee, 0x82, 0x82, 0x90, 0xa0, 0xc1, 0xfd, 0xbd, 0xee,
-  0x81, 0x96, 0x23, 0x14, 0xcd, 0xad, 0xeb, 0x79, 0x1f, 0xa4, 0x44, 0xa1,
-  0x35, 0x54, 0x5a, 0xfb, 0xda, 0xc0, 0xe5, 0xfb, 0x9c, 0xfa, 0xac, 0x4d,
-  0x97, 0xe5, 0x19, 0xaa, 0xed, 0x43, 0x67, 0x55, 0xe7, 0x8a, 0xfd, 0x9d,
-  0xb1, 0x0d, 0xe7, 0xff, 0x2b, 0xba, 0xaa, 0x5d, 0xb0, 0xce, 0xd3, 0x4d,
-  0xb9, 0x5b, 0x85, 0x7b, 0x6c, 0x50, 0xe6, 0xc4, 0x5c, 0xac, 0x04, 0x3c,
-  0xc0, 0x00, 0x05, 0x87, 0x84, 0xc3, 0x3f, 0x47, 0xfb, 0xc3, 0x10, 0x8f,
-  0xcf, 0x2f, 0x83, 0x28, 0xf3, 0x26, 0xa3, 0x2c, 0x1a, 0xd2, 0x91, 0x2d,
-  0x74, 0x96, 0x47, 0xca, 0xa4, 0x78, 0x13, 0x2e, 0xde, 0x8e, 0x11, 0xc1,
-  0x52, 0xb7, 0xf7, 0x87, 0x25, 0xbf, 0x4d, 0xb9, 0xfb, 0x25, 0x37, 0x1d,
-  0x88, 0x1b, 0x2f, 0x41, 0x4c, 0x23, 0xea, 0xe6, 0x26, 0xc0, 0x04, 0x6b,
-  0x7a, 0x0d, 0xdb, 0xe8, 0x2e, 0x29, 0x03, 0x85, 0x12, 0x43, 0xe2, 0x15,
-  0xfe, 0x6f, 0x91, 0x2f, 0x3d, 0x1a, 0x4f, 0x70, 0x68, 0xdb, 0xd9, 0xb7,
-  0xcc, 0x57, 0xfd, 0x1b, 0x81, 0x0e, 0x5f, 0x81, 0x3c, 0xde, 0x55, 0x3c,
-  0x49, 0x3c, 0xac, 0x01, 0xba, 0x59, 0x16, 0x7b, 0x01, 0x4d, 0x36, 0xef,
-  0xd3, 0xc7, 0x77, 0x5e, 0x23, 0xf0, 0xd2, 0x71, 0xd8, 0xc7, 0x43, 0xd9,
-  0x49, 0x82, 0x51, 0x58, 0x01, 0x0a, 0xa8, 0x08, 0x85, 0x02, 0x16, 0x1c,
-  0x79, 0x31, 0x93, 0x82, 0xd1, 0x88, 0xae, 0x0c, 0xee, 0x25, 0xf1, 0x25,
-  0x0c, 0xcb, 0xc3, 0x14, 0x26, 0xca, 0x45, 0x2c, 0x0e, 0x85, 0xf9, 0xc2,
-  0x02, 0x30, 0x3f, 0x25, 0x28, 0xbb, 0x00, 0x70, 0x9b, 0x1d, 0x4e, 0x33,
-  0xce, 0x83, 0xdf, 0x84, 0x2f, 0xef, 0x17, 0x22, 0x46, 0x5f, 0x01, 0x11,
-  0x8a, 0x3c, 0xe1, 0x36, 0x40, 0x09, 0x16, 0x0b, 0x48, 0x29, 0x0c, 0x3b,
-  0x0c, 0x1a, 0x37, 0xeb, 0x10, 0x53, 0xe4, 0xa0, 0xba, 0x21, 0x2b, 0x0e,
-  0x38, 0x9d, 0x27, 0xe1, 0x29, 0xa2, 0x4d, 0x1d, 0xc0, 0x3f, 0x10, 0x65,
-  0xd1, 0x55, 0x26, 0x43, 0xa1, 0x60, 0x9b, 0x8a, 0x6d, 0x0a, 0x7c, 0x37,
-  0x8a, 0x0f, 0x82, 0xc6, 0x28, 0xc1, 0x80, 0xb0, 0x79, 0x13, 0x5b, 0x24,
-  0xad, 0x18, 0x52, 0x1c, 0x2a, 0xca, 0x82, 0x7b, 0xe6, 0x61, 0x0c, 0x93,
-  0x6b, 0xdb, 0xe7, 0xd1, 0x70, 0xc0, 0xc2, 0x6e, 0x72, 0x18, 0x3b, 0x51,
-  0x3a, 0xc6, 0x11, 0xe7, 0xac, 0x46, 0x46, 0x0d, 0x2f, 0x66, 0x54, 0xc5,
-  0x92, 0xa2, 0xdc, 0xc1, 0x79, 0x94, 0xe2, 0xdd, 0xcd, 0xc0, 0x9c, 0xe8,
-  0x6c, 0x98, 0x5c, 0x79, 0x41, 0xca, 0xb0, 0xa3, 0x8a, 0xc0, 0x2f, 0x83,
-  0x18, 0x56, 0x9a, 0x51, 0x9c, 0x79, 0x78, 0xeb, 0x5d, 0x0e, 0x02, 0xc8,
-  0x43, 0x52, 0x1d, 0xfa, 0x16, 0x7f, 0x93, 0xba, 0xc4, 0x9b, 0x25, 0xdb,
-  0x0a, 0x29, 0xbf, 0xef, 0xe3, 0x49, 0x1a, 0xb2, 0x9f, 0x3e, 0x81, 0x54,
-  0x64, 0x60, 0x6f, 0xd2, 0x03, 0xa5, 0x22, 0x5d, 0xa7, 0xc3, 0x15, 0x29,
-  0x31, 0x30, 0xa5, 0x45, 0x65, 0xd9, 0x63, 0xd5, 0x2f, 0x68, 0x4d, 0x5b,
-  0xe7, 0xd3, 0x80, 0xe7, 0x21, 0x6d, 0x16, 0xbd, 0xfe, 0x48, 0x5a, 0x0b,
-  0xa3, 0x1c, 0xae, 0xc1, 0x2e, 0xba, 0x31, 0xed, 0x46, 0xa1, 0x1b, 0x37,
-  0xce, 0x7c, 0xde, 0x7d, 0xb3, 0x6b, 0x0d, 0xb9, 0x51, 0x5c, 0x2f, 0xca,
-  0xfd, 0xe3, 0xb0, 0xe8, 0x0a, 0xb3, 0x6f, 0x55, 0x7b, 0xc7, 0x95, 0x5b,
-  0x5f, 0x78, 0xda, 0x5a, 0x80, 0xe4, 0x96, 0x7c, 0x24, 0x61, 0x36, 0xbd,
-  0xa2, 0xa8, 0x3b, 0xec, 0x0f, 0x8a, 0xb4, 0x29, 0xb3, 0x0e, 0x65, 0xe5,
-  0x09, 0xc6, 0x65, 0xf9, 0xd8, 0xd0, 0x4e, 0x2d, 0x65, 0xdb, 0xad, 0x9d,
-  0xc3, 0xa6, 0x04, 0x84, 0xe5, 0xec, 0xd0, 0xbc, 0x44, 0xaa, 0x12, 0x5c,
-  0x9e, 0xe3, 0xd7, 0x79, 0x10, 0x50, 0x0b, 0xab, 0x02, 0x8c, 0xfd, 0x18,
-  0xf6, 0x66, 0x98, 0x61, 0x82, 0x61, 0x6e, 0xd9, 0x65, 0x2e, 0xe0, 0x7e,
-  0xf7, 0x60, 0xcb, 0xfb, 0xb7, 0xd7, 0x05, 0x96, 0xf6, 0x3e, 0xb0, 0xab,
-  0x23, 0xfd, 0x9a, 0xa1, 0xa3, 0x25, 0x94, 0x9c, 0xab, 0xe7, 0x96, 0xf1,
-  0x98, 0xbf, 0xe3, 0x73, 0x73, 0x89, 0x6d, 0x3c, 0xe6, 0x64, 0x13, 0x63,
-  0x30, 0x4e, 0x94, 0xe8, 0x3c, 0x9a, 0x0e, 0x98, 0xd4, 0x78, 0x7a, 0x52,
-  0x1a, 0x57, 0x22, 0xe5, 0xc1, 0xb6, 0xfa, 0x8d, 0x20, 0x08, 0xe3, 0x6c,
-  0x42, 0xce, 0x62, 0xdd, 0x96, 0xce, 0x18, 0x79, 0x1a, 0x3e, 0x9e, 0x00,
-  0xdb, 0x5a, 0x4d, 0xc9, 0x8e, 0x2d, 0xd7, 0x25, 0x2b, 0xbc, 0xa8, 0xca,
-  0x95, 0x75, 0xf7, 0xa9, 0xb3, 0x09, 0xca, 0x42, 0x58, 0xe9, 0x92, 0xd9,
-  0xe5, 0xe5, 0x10, 0xed, 0xf7, 0x7e, 0x8d, 0x4d, 0x5d, 0x85, 0xee, 0x6d,
-  0xe8, 0xdd, 0xe8, 0x94, 0x80, 0x54, 0x72, 0x7d, 0x47, 0xef, 0x24, 0xd1,
-  0xaf, 0xa6, 0x6a, 0xba, 0x26, 0x61, 0x2a, 0xae, 0x50, 0x96, 0x97, 0x0e,
-  0x97, 0xea, 0x6c, 0x53, 0x9b, 0xa7, 0x0e, 0xa5, 0x2e, 0x57, 0xe8, 0x4e,
-  0xa4, 0xfb, 0x29, 0x2e, 0x31, 0xb2, 0x39, 0x61, 0x0a, 0x1e, 0xa8, 0x24,
-  0x03, 0xf6, 0xa2, 0x5f, 0xdc, 0x9c, 0x7c, 0xff, 0x9a, 0x98, 0xa6, 0xed,
-  0xc9, 0xda, 0x5e, 0x1a, 0x83, 0x6a, 0xc4, 0xd8, 0x93, 0x2b, 0x79, 0x63,
-  0xba, 0x6b, 0x7e, 0xef, 0x8f, 0x93, 0xba, 0x26, 0x02, 0x5d, 0xb9, 0xe3,
-  0x8a, 0x83, 0xcf, 0x23, 0x4b, 0x01, 0x59, 0x61, 0x1f, 0xa2, 0x23, 0xe1,
-  0x15, 0xbf, 0xe6, 0x26, 0xdf, 0xae, 0xe1, 0x11, 0x83, 0xf2, 0x5b, 0x01,
-  0x4a, 0x4f, 0x98, 0xca, 0x26, 0xb8, 0xcd, 0x66, 0x62, 0xd6, 0xce, 0x73,
-  0xc1, 0xab, 0x92, 0xd1, 0xdf, 0xb0, 0x26, 0xe3, 0x96, 0xaf, 0x2a, 0x90,
-  0xb9, 0x5b, 0x59, 0x5e, 0xf1, 0x64, 0xf9, 0x65, 0xfd, 0x48, 0x45, 0x07,
-  0x78, 0x23, 0x71, 0xaa, 0xe6, 0xc3, 0x28, 0xd3, 0xa8, 0xe5, 0x3d, 0xb2,
-  0x3b, 0x31, 0xda, 0x27, 0x4a, 0x35, 0xb6, 0xfa, 0x5a, 0xcf, 0xf6, 0x71,
-  0xa0, 0x57, 0x87, 0xdf, 0x32, 0x8b, 0x2a, 0x20, 0x79, 0x22, 0x5a, 0x67,
-  0xbc, 0xd6, 0x2f, 0x2d, 0x68, 0xba, 0xd8, 0x75, 0x01, 0x10, 0x2e, 0x3a,
-  0x94, 0x5e, 0xbf, 0xe4, 0xdf, 0xcc, 0x9d, 0x03, 0xb7, 0xd5, 0xfe, 0x73,
-  0x64, 0xdb, 0xad, 0xd0, 0xfe, 0x1f, 0xd3, 0x8f, 0x11, 0x62, 0xf8, 0x87,
-  0x28, 0xdf, 0xf2, 0x9b, 0xae, 0xf2, 0x78, 0x7d, 0x0d, 0x61, 0xd0, 0xf2,
-  0xc2, 0x11, 0x99, 0xe2, 0xc3, 0x01, 0x13, 0x10, 0x47, 0xe5, 0x37, 0x5a,
-  0x5d, 0x7b, 0xce, 0x9a, 0xba, 0xab, 0xbc, 0x36, 0x23, 0xd6, 0xbd, 0xc3,
-  0x23, 0xd7, 0x79, 0x07, 0x56, 0x4f, 0xed, 0xc1, 0x3e, 0xf4, 0x49, 0xbb,
-  0x3a, 0x2b, 0xe5, 0xfe, 0x0a, 0xd6, 0x23, 0x2a, 0x58, 0x61, 0xa0, 0xd4,
-  0xf4, 0xb7, 0x2c, 0x61, 0x31, 0x3f, 0x29, 0x0b, 0x14, 0xc1, 0xff, 0xd9,
-  0x52, 0x23, 0xdd, 0x58, 0xf8, 0x5b, 0x36, 0x30, 0xae, 0x76, 0xf4, 0xe8,
-  0xe8, 0x76, 0xd3, 0x8f, 0xc7, 0x41, 0x3f, 0xca, 0xae, 0xd6, 0xf1, 0x54,
-  0x8b, 0x87, 0x77, 0x30, 0x18, 0x79, 0xff, 0x31, 0xbb, 0xce, 0x0a, 0x3a,
-  0xd6, 0x02, 0x48, 0x64, 0xb2, 0xdf, 0x56, 0xb2, 0x81, 0x02, 0xfb, 0x85,
-  0xdc, 0xac, 0xf1, 0xd5, 0xbc, 0x54, 0x92, 0x17, 0xcf, 0xe9, 0x8a, 0xee,
-  0x06, 0xe4, 0x6d, 0xe0, 0xad, 0xb3, 0x3f, 0x8e, 0x29, 0xad, 0xb5, 0x02,
-  0x0a, 0xfe, 0x4e, 0x5e, 0x9c, 0x28, 0x46, 0xcb, 0xc2, 0x47, 0xc2, 0x20,
-  0xf4, 0x79, 0x76, 0x31, 0x2c, 0xdd, 0xc1, 0x57, 0xa8, 0x77, 0x36, 0x1b,
-  0x24, 0x59, 0x84, 0x01, 0xae, 0x65, 0x39, 0x9c, 0x45, 0x18, 0x21, 0x88,
-  0x8d, 0x1a, 0x35, 0xeb, 0xb8, 0x09, 0xda, 0x6b, 0x73, 0x0d, 0xa2, 0x96,
-  0xcf, 0x9e, 0x43, 0x09, 0x61, 0x6e, 0x59, 0x42, 0x60, 0xeb, 0x07, 0xd5,
-  0x4a, 0x93, 0x05, 0xe9, 0x4d, 0x45, 0x04, 0x2a, 0x53, 0xdd, 0x36, 0xac,
-  0x70, 0x67, 0x61, 0xa6, 0xe6, 0xba, 0xb4, 0x45, 0xda, 0xa7, 0x45, 0x98,
-  0x7d, 0x7d, 0x15, 0x43, 0x56, 0x29, 0xdd, 0x5a, 0x86, 0x83, 0xca, 0x55,
-  0x44, 0x72, 0x93, 0xb7, 0x64, 0x7c, 0x34, 0x5a, 0x66, 0x5b, 0xfb, 0x16,
-  0xd7, 0xe6, 0x99, 0xb6, 0x4c, 0x8b, 0xd4, 0x8f, 0xfc, 0xc1, 0xe4, 0xe2,
-  0x22, 0xd7, 0x6b, 0xbf, 0xaf, 0xfa, 0xe3, 0x33, 0x97, 0x4c, 0x34, 0x67,
-  0x81, 0x7e, 0xb3, 0xb5, 0x4f, 0x6e, 0x47, 0xb9, 0x7e, 0x23, 0xa9, 0x3e,
-  0x85, 0x0e, 0xe2, 0x11, 0x1b, 0xa2, 0x7a, 0x54, 0x66, 0xd1, 0xba, 0xb1,
-  0xb2, 0xd3, 0xf9, 0xc7, 0x5a, 0xbb, 0xf3, 0xf4, 0x79, 0xfb, 0x71, 0xbb,
-  0x73, 0x53, 0x35, 0x87, 0x7c, 0x2d, 0xc4, 0x6d, 0xb4, 0x88, 0x9d, 0x6d,
-  0x5b, 0xcf, 0x7b, 0xb3, 0x4d, 0x05, 0xd0, 0x3b, 0x94, 0xfd, 0x36, 0x2c,
-  0xd9, 0x4a, 0xe9, 0x3f, 0x58, 0x92, 0x0b, 0xce, 0x22, 0xe6, 0x84, 0xe1,
-  0x5f, 0x96, 0xbf, 0x84, 0x57, 0xaa, 0xa5, 0x9f, 0x4d, 0x38, 0x55, 0xe9,
-  0x37, 0xee, 0xf1, 0x3a, 0x2c, 0xfb, 0x88, 0x1c, 0xcb, 0x17, 0xb2, 0x3c,
-  0x97, 0x29, 0x9b, 0xc5, 0xfa, 0x5d, 0x86, 0x2c, 0x4f, 0x96, 0xb8, 0x59,
-  0x4b, 0x0d, 0xc9, 0xe1, 0x6f, 0x79, 0xd5, 0xc3, 0xa2, 0x15, 0xfd, 0x2a,
-  0x3d, 0x2d, 0xb5, 0x55, 0x01, 0x93, 0xee, 0xc5, 0x32, 0x81, 0x92, 0x11,
-  0x75, 0x16, 0xa8, 0x72, 0x1e, 0x1e, 0x56, 0x9e, 0x0c, 0x46, 0x78, 0xb9,
-  0x5a, 0xe9, 0x70, 0x60, 0x8c, 0x7d, 0x91, 0x78, 0x87, 0x95, 0x3a, 0xf4,
-  0x51, 0xc6, 0xb0, 0x77, 0xf9, 0x1d, 0x0e, 0x1c, 0x36, 0x1f, 0x5f, 0x79,
-  0xb8, 0x73, 0xe0, 0xbc, 0x20, 0xb3, 0x77, 0x6d, 0xc8, 0x97, 0xab, 0xa9,
-  0x10, 0xf5, 0x74, 0x3f, 0x58, 0x81, 0xb4, 0x42, 0xc5, 0xb1, 0x4a, 0xea,
-  0xc5, 0xa7, 0xf1, 0xfc, 0x7d, 0xe0, 0x8c, 0x8c, 0x01, 0x3d, 0x52, 0xb4,
-  0x08, 0xfe, 0x7c, 0x1f, 0x8e, 0x26, 0x6c, 0xa5, 0xb4, 0x87, 0x33, 0x5c,
-  0x28, 0xdf, 0xf5, 0x54, 0xd1, 0x0e, 0x3f, 0x7a, 0xe6, 0xf0, 0x8b, 0x55,
-  0xfd, 0xa6, 0xfa, 0x69, 0x6b, 0x38, 0x6c, 0xf0, 0xbb, 0xeb, 0xfc, 0xa6,
-  0x42, 0x5c, 0xee, 0x75, 0x5f, 0xbf, 0x15, 0x02, 0xc5, 0x6b, 0xe9, 0xb0,
-  0xc8, 0x93, 0xcf, 0xed, 0xe7, 0xcf, 0xf0, 0x63, 0xa5, 0xc4, 0xdc, 0x92,
-  0x3a, 0x6a, 0x4d, 0x4c, 0xcc, 0x7d, 0x3a, 0x4d, 0x97, 0x2f, 0x61, 0x8f,
-  0xb4, 0x1f, 0x59, 0x71, 0x04, 0xcb, 0x12, 0x16, 0xe7, 0x7d, 0xd8, 0x90,
-  0x92, 0x43, 0x30, 0x62, 0x14, 0x98, 0xf0, 0x37, 0xd4, 0x06, 0xff, 0xbb,
-  0x64, 0x7d, 0xb3, 0x38, 0xde, 0xab, 0x32, 0x4f, 0x0b, 0x49, 0xe6, 0x10,
-  0x0f, 0x59, 0x88, 0x36, 0xe8, 0x70, 0xec, 0x37, 0x05, 0x26, 0xab, 0x15,
-  0x6b, 0x68, 0x2e, 0x76, 0x4a, 0x66, 0x9c, 0x8c, 0x59, 0x89, 0xeb, 0x6d,
-  0x73, 0x63, 0x56, 0x17, 0x5a, 0x22, 0x16, 0x8d, 0x63, 0xee, 0xe1, 0x89,
-  0x29, 0x68, 0x3a, 0xb9, 0x10, 0x97, 0x67, 0x15, 0xf2, 0x3b, 0x88, 0xc5,
-  0x32, 0x76, 0x0f, 0x72, 0x26, 0x2c, 0x06, 0x12, 0xe6, 0x60, 0xb2, 0x9e,
-  0x0b, 0x26, 0xe9, 0x1a, 0x2f, 0x2a, 0xbb, 0x2e, 0xe4, 0x60, 0x4b, 0x4e,
-  0xed, 0x81, 0xee, 0xd4, 0x2d, 0xf9, 0x2e, 0x10, 0x7e, 0xdc, 0x30, 0xe3,
-  0x4c, 0x22, 0x1e, 0x3f, 0xcc, 0xc3, 0xf4, 0x8f, 0x72, 0x12, 0xf5, 0x4a,
-  0x38, 0xd5, 0xb8, 0x09, 0x14, 0xab, 0x72, 0x25, 0xc5, 0xc9, 0x84, 0x8c,
-  0x8b, 0x8d, 0xf3, 0xd1, 0xe2, 0xca, 0x12, 0x67, 0x4d, 0x5e, 0xc4, 0x59,
-  0xf7, 0x00, 0x96, 0x94, 0x1a, 0xf5, 0x29, 0x3f, 0x81, 0x09, 0x24, 0x10,
-  0xd3, 0x87, 0x8f, 0xcc, 0xa1, 0x04, 0xf5, 0x48, 0xbb, 0x6a, 0xb9, 0xe8,
-  0x27, 0x6a, 0x59, 0x3c, 0xa3, 0x81, 0xae, 0xcb, 0xcf, 0x3c, 0x8f, 0xd5,
-  0xe1, 0xce, 0x6f, 0x6e, 0xa9, 0x73, 0xd3, 0xb0, 0x05, 0xab, 0x24, 0x1c,
-  0x87, 0x41, 0xe6, 0xdb, 0x6f, 0x82, 0x46, 0x97, 0x77, 0xf4, 0x9f, 0xb0,
-  0x5c, 0x62, 0x53, 0x0f, 0x8b, 0x8d, 0x5a, 0x5d, 0xfd, 0xa5, 0xe1, 0xc3,
-  0x3a, 0x11, 0x4f, 0xfa, 0xe7, 0x64, 0x9e, 0xf2, 0xf1, 0xa0, 0x8c, 0x69,
-  0x52, 0x4d, 0xdc, 0xae, 0x5d, 0xe0, 0xaa, 0x83, 0xc7, 0x4a, 0x3c, 0x08,
-  0x23, 0x2f, 0xe7, 0xa6, 0x8d, 0x40, 0xdc, 0x96, 0x3a, 0x45, 0x5d, 0xa1,
-  0x18, 0x4e, 0xd6, 0x45, 0xd6, 0x44, 0xbd, 0x7c, 0xe5, 0xe4, 0x6d, 0x8a,
-  0xc5, 0xb3, 0x2c, 0x21, 0xcb, 0x3c, 0x94, 0x98, 0x8c, 0x0b, 0x3a, 0x80,
-  0x9e, 0x5d, 0x46, 0x85, 0x59, 0x7b, 0x3a, 0x2d, 0xdf, 0xad, 0xa1, 0xbc,
-  0xa2, 0x1b, 0x28, 0xf3, 0x7b, 0x3f, 0xdc, 0xf6, 0x35, 0xe9, 0xbe, 0xca,
-  0x19, 0x78, 0xbb, 0xe6, 0xb5, 0x34, 0x26, 0x56, 0x42, 0x3f, 0x41, 0x6d,
-  0x12, 0xf5, 0x4a, 0x7b, 0x28, 0x24, 0x2b, 0x95, 0x3a, 0x17, 0x62, 0x49,
-  0xbc, 0x71, 0x65, 0x97, 0x69, 0x7d, 0x47, 0x5a, 0x46, 0x37, 0x0e, 0x87,
-  0x37, 0x54, 0x17, 0x16, 0x46, 0xa6, 0xf8, 0xaa, 0x2a, 0x26, 0x09, 0x4c,
-  0x59, 0xa1, 0x52, 0x24, 0x26, 0x51, 0x63, 0x36, 0xf1, 0x50, 0xa5, 0x6b,
-  0xd7, 0xd2, 0xf3, 0x59, 0xd7, 0x7d, 0xf3, 0xde, 0x18, 0x1d, 0xf1, 0x24,
-  0x1b, 0xba, 0x18, 0x10, 0x3e, 0xd5, 0xbd, 0xba, 0x61, 0x6a, 0x6f, 0xa8,
-  0xd6, 0x8a, 0xab, 0x3b, 0x59, 0xc8, 0x03, 0x74, 0x63, 0x0a, 0xdf, 0x5c,
-  0x2a, 0xe9, 0x3a, 0x7f, 0xde, 0xb2, 0xba, 0x9a, 0xdc, 0xbc, 0x59, 0x53,
-  0x04, 0xa8, 0x0a, 0xba, 0xde, 0xa0, 0x31, 0x5f, 0xde, 0x85, 0x67, 0x50,
-  0xef, 0x2d, 0x0f, 0xd7, 0x56, 0xe7, 0xca, 0x0c, 0x9a, 0x00, 0xa9, 0xad,
-  0xa7, 0x51, 0x38, 0x1c, 0xc0, 0x28, 0x1d, 0x1f, 0x0f, 0x09, 0xea, 0xf2,
-  0x32, 0x0b, 0xe0, 0x6e, 0x16, 0x94, 0xd7, 0x9d, 0x79, 0xc2, 0x12, 0x7e,
-  0x2e, 0x42, 0xc6, 0x5d, 0xc8, 0x7f, 0x22, 0xff, 0x02, 0x51, 0x53, 0xc3,
-  0x9e, 0xef, 0xc0, 0x4d, 0xf8, 0x93, 0x91, 0x88, 0x85, 0xb0, 0x5d, 0x72,
-  0x96, 0x4b, 0x49, 0x47, 0x52, 0xd4, 0xe6, 0x46, 0xfd, 0x0b, 0x34, 0x2b,
-  0xd3, 0xde, 0xa2, 0x53, 0x67, 0x59, 0x81, 0x4e, 0xc5, 0xad, 0x47, 0xae,
-  0xa4, 0xb3, 0xd3, 0x2a, 0xe1, 0x5d, 0xdc, 0xab, 0x94, 0x96, 0x0a, 0x6f,
-  0xe5, 0x5a, 0x5f, 0xc5, 0xa2, 0x28, 0xa7, 0x02, 0x6b, 0x58, 0xcd, 0x56,
-  0xea, 0x7d, 0x4c, 0x33, 0x69, 0x96, 0x66, 0xf2, 0xce, 0x87, 0x86, 0xbe,
-  0x5c, 0xa4, 0x90, 0x28, 0xeb, 0x81, 0xa2, 0x2f, 0x17, 0xf7, 0x10, 0xe7,
-  0x4d, 0x9f, 0x85, 0xc2, 0x32, 0xf8, 0xea, 0x6a, 0x77, 0x00, 0x33, 0x8e,
-  0x56, 0x2b, 0x8c, 0xdb, 0xd9, 0x82, 0xa1, 0x90, 0xf3, 0xd5, 0x94, 0xdd,
-  0x39, 0xec, 0x04, 0x97, 0x5f, 0xe4, 0xca, 0x8b, 0xca, 0x00, 0x2d, 0xb7,
-  0x35, 0xcf, 0xa8, 0x7a, 0x13, 0x81, 0x1e, 0x32, 0x38, 0x0f, 0x51, 0x05,
-  0x2f, 0xb9, 0xad, 0x79, 0x3e, 0xda, 0xdb, 0xef, 0x6c, 0xae, 0xc2, 0x8f,
-  0x95, 0x3d, 0xf2, 0x9b, 0x25, 0x17, 0x3b, 0xd7, 0x83, 0xc1, 0xef, 0xbd,
-  0x51, 0x40, 0x15, 0xd7, 0x33, 0xbb, 0x36, 0xd3, 0x87, 0xc2, 0x38, 0xbb,
-  0x8c, 0x5d, 0xb7, 0x56, 0xe6, 0x77, 0x38, 0x97, 0x6e, 0xc7, 0x99, 0x79,
-  0x17, 0x41, 0xe8, 0x10, 0xf2, 0x9b, 0xa5, 0xdd, 0xf5, 0xd3, 0x1e, 0xaf,
-  0x2f, 0xac, 0x9c, 0xcd, 0xd2, 0x1b, 0xa8, 0xab, 0xbb, 0xc2, 0xe1, 0x70,
-  0x9f, 0x01, 0xa3, 0x53, 0xc5, 0xd5, 0xd2, 0xa5, 0xa9, 0x04, 0xc8, 0x58,
-  0x0d, 0x03, 0x8c, 0xb6, 0x6f, 0x18, 0xe0, 0xd2, 0xfb, 0xab, 0xeb, 0x00,
-  0x12, 0xc7, 0xdb, 0x26, 0xb0, 0xe2, 0x3e, 0xeb, 0xea, 0xbe, 0x05, 0x63,
-  0xb3, 0x3f, 0xc5, 0x95, 0xd7, 0xd5, 0xf5, 0xd1, 0x2b, 0x29, 0xb2, 0x11,
-  0x45, 0x5c, 0x8d, 0x5d, 0x1b, 0x04, 0x9d, 0x0a, 0x28, 0x70, 0xc4, 0x6d,
-  0xec, 0xa5, 0xac, 0xc2, 0x0a, 0xa9, 0xb3, 0x5c, 0xbd, 0x73, 0xbd, 0x14,
-  0x03, 0x51, 0x78, 0x99, 0xf9, 0xaa, 0x1f, 0xd9, 0x00, 0xe5, 0xd7, 0xb3,
-  0xd7, 0x83, 0xc4, 0xa3, 0xf0, 0x14, 0x50, 0xca, 0x15, 0xf2, 0xa5, 0x60,
-  0x78, 0xee, 0x03, 0x5a, 0x19, 0x15, 0x10, 0xda, 0x7d, 0xef, 0xa5, 0x40,
-  0x28, 0xa3, 0x1c, 0x9e, 0x40, 0x29, 0x10, 0x58, 0x17, 0xab, 0xc6, 0x96,
-  0xa8, 0xca, 0xe3, 0x45, 0x84, 0x75, 0xae, 0x65, 0x8b, 0x76, 0xa8, 0x07,
-  0x82, 0xb8, 0x55, 0x86, 0xa0, 0x65, 0x6d, 0xa8, 0xe8, 0x09, 0x94, 0xb6,
-  0x49, 0x22, 0x23, 0xcd, 0x40, 0x1d, 0x82, 0xb0, 0x4a, 0x22, 0x3f, 0xac,
-  0x02, 0x8f, 0x5f, 0xd9, 0xee, 0x9a, 0x77, 0xaa, 0x4d, 0x8c, 0x0a, 0xab,
-  0xd3, 0x2e, 0xbf, 0xdd, 0xbd, 0x14, 0x0b, 0x2a, 0xb5, 0x1c, 0x7f, 0x31,
-  0x9b, 0xce, 0xaf, 0x66, 0xaf, 0x51, 0xbf, 0xcf, 0xca, 0xea, 0xac, 0x4a,
-  0x57, 0xc5, 0xd7, 0xeb, 0x00, 0x2b, 0xad, 0xf6, 0xa0, 0xb8, 0x56, 0xbe,
-  0x8a, 0xcb, 0xa1, 0x98, 0xde, 0x07, 0xf5, 0xee, 0xf9, 0x3a, 0x00, 0x98,
-  0x43, 0xa6, 0x0d, 0x48, 0x2d, 0x4a, 0x08, 0x28, 0x4e, 0x52, 0xcc, 0x22,
-  0x48, 0x19, 0x2c, 0xc6, 0xa8, 0x39, 0x4d, 0xa6, 0xba, 0xb1, 0x90, 0xee,
-  0x02, 0x19, 0x0a, 0xa5, 0x36, 0xad, 0xab, 0xfb, 0x82, 0x34, 0x88, 0xfe,
-  0x0e, 0x2d, 0xba, 0xaf, 0x1a, 0x11, 0xde, 0xd0, 0xb6, 0x51, 0xaa, 0x62,
-  0x27, 0x07, 0xd2, 0x58, 0xd4, 0xf7, 0xf3, 0x60, 0x74, 0x16, 0xba, 0x42,
-  0x8d, 0x8b, 0x70, 0x09, 0xae, 0x14, 0xca, 0x47, 0xb5, 0x87, 0xe4, 0x79,
-  0x9d, 0xfa, 0x47, 0xb2, 0x63, 0x87, 0x14, 0x14, 0xdd, 0x10, 0xf5, 0x0e,
-  0x57, 0x8f, 0x9c, 0x91, 0x62, 0x32, 0x76, 0x36, 0x73, 0x81, 0xab, 0xc6,
-  0xab, 0x2a, 0xf3, 0x9b, 0x08, 0x5f, 0xae, 0xe1, 0x07, 0xe4, 0x06, 0xa2,
-  0x9e, 0x73, 0x57, 0x1d, 0xf7, 0x56, 0xe2, 0x24, 0x95, 0x75, 0xc2, 0xda,
-  0x1a, 0xd7, 0x02, 0x93, 0x9f, 0x18, 0x3b, 0x01, 0x15, 0xae, 0x0b, 0x15,
-  0x90, 0xb8, 0xab, 0x8e, 0x15, 0x90, 0x9e, 0x26, 0xa7, 0x6a, 0xff, 0xb7,
-  0x63, 0xc9, 0x91, 0x55, 0x95, 0xe4, 0xa5, 0x0a, 0xe6, 0xb6, 0x23, 0x49,
-  0x95, 0x0a, 0x97, 0x4b, 0xd1, 0x1b, 0x1b, 0xad, 0xa8, 0x7e, 0x2d, 0x7f,
-  0x08, 0x71, 0x50, 0xad, 0xe7, 0x53, 0x2b, 0x9d, 0x85, 0x42, 0x44, 0xde,
-  0x18, 0x3f, 0x06, 0xa0, 0x16, 0x82, 0x6c, 0xd6, 0x8a, 0xd9, 0x64, 0x03,
-  0x63, 0x38, 0x73, 0x8a, 0xfd, 0x2f, 0xab, 0x84, 0xa1, 0x8a, 0x93, 0xd1,
-  0x20, 0x3c, 0x05, 0x75, 0x61, 0x80, 0xbb, 0x5e, 0x7a, 0xed, 0xc8, 0xca,
-  0xa1, 0xdc, 0x77, 0xa0, 0xd3, 0xa4, 0xa2, 0xf1, 0x66, 0x4d, 0xe7, 0x63,
-  0x0b, 0x7c, 0x8c, 0xad, 0x68, 0x58, 0xed, 0x9e, 0x2e, 0xda, 0xb1, 0x25,
-  0xe6, 0x7b, 0x0c, 0x40, 0x05, 0xba, 0x65, 0x48, 0xba, 0xe4, 0xf4, 0x97,
-  0xf0, 0x8a, 0x8c, 0x56, 0x0e, 0x41, 0x8d, 0x63, 0xc7, 0x64, 0x33, 0x14,
-  0xdc, 0x16, 0xa7, 0x04, 0x9d, 0x47, 0xcd, 0xaa, 0x50, 0xac, 0xba, 0x5d,
-  0x9a, 0x83, 0xaf, 0xe6, 0xe4, 0xad, 0x05, 0xf1, 0x97, 0x99, 0x75, 0xdd,
-  0x71, 0x83, 0x6d, 0x0d, 0x5e, 0xb3, 0x19, 0x6d, 0xdc, 0xa3, 0xb0, 0xf6,
-  0xac, 0x39, 0x0f, 0x3b, 0x2b, 0x9a, 0x44, 0xad, 0x3c, 0x88, 0x35, 0x33,
-  0x20, 0x2a, 0x99, 0xe8, 0xf2, 0x93, 0xa5, 0x7c, 0x6c, 0x1c, 0x69, 0xa1,
-  0x1c, 0xd9, 0x11, 0xc9, 0xc3, 0x53, 0xc2, 0xdf, 0x96, 0x18, 0x51, 0x2e,
-  0x63, 0xcd, 0x29, 0x66, 0xab, 0xc4, 0x71, 0x33, 0xb3, 0xe2, 0x20, 0x39,
-  0x6e, 0x94, 0xa1, 0x72, 0x43, 0xc9, 0x47, 0xe8, 0xee, 0x34, 0x87, 0x62,
-  0x5e, 0xf8, 0x63, 0x4f, 0x68, 0x29, 0xe5, 0xb3, 0x9c, 0xea, 0x59, 0x2d,
-  0xf5, 0xa4, 0x96, 0xda, 0x12, 0x92, 0x9b, 0xbd, 0x38, 0x5b, 0xaf, 0xd3,
-  0x25, 0x63, 0x22, 0x4b, 0x17, 0xcb, 0x48, 0xc6, 0xde, 0xe4, 0x10, 0x68,
-  0xb9, 0xfa, 0x23, 0xbc, 0x92, 0xcd, 0xa9, 0xba, 0x60, 0xa8, 0x23, 0x14,
-  0xaa, 0x16, 0xb3, 0x7b, 0x75, 0xf9, 0xda, 0x04, 0xa4, 0x88, 0x3c, 0xb3,
-  0xef, 0x88, 0x31, 0x7a, 0x17, 0x3b, 0xad, 0x99, 0xf2, 0xe6, 0x86, 0xfc,
-  0x90, 0xf9, 0xdf, 0xe8, 0x27, 0x9d, 0xa7, 0x6b, 0xb2, 0x2d, 0xe2, 0x15,
-  0xbe, 0x05, 0xb9, 0x5e, 0x6f, 0x95, 0xb2, 0x13, 0x1c, 0x4b, 0x9d, 0xba,
-  0x79, 0x4e, 0x1d, 0x72, 0xab, 0x45, 0x2f, 0x3a, 0xde, 0x4d, 0xf2, 0x84,
-  0x46, 0x82, 0xb5, 0xf8, 0x40, 0x39, 0x9c, 0xda, 0x34, 0xf2, 0xd2, 0x68,
-  0x59, 0x0e, 0x5f, 0x72, 0xd4, 0x58, 0x17, 0x66, 0xc3, 0x6e, 0x5e, 0xbd,
-  0x46, 0xf5, 0xcc, 0x26, 0x2e, 0x50, 0x16, 0xe8, 0x8d, 0x8a, 0xb1, 0x76,
-  0x9c, 0x36, 0xdf, 0x9d, 0x3e, 0x19, 0x32, 0xd6, 0x96, 0x96, 0x5c, 0x13,
-  0xcd, 0x37, 0x98, 0x9a, 0x39, 0x08, 0xc1, 0xe1, 0x2d, 0x91, 0x8a, 0xfa,
-  0xcf, 0x7c, 0x83, 0xe3, 0x64, 0x7a, 0x65, 0x23, 0x5b, 0x93, 0xeb, 0xf9,
-  0x32, 0x5e, 0xc1, 0xf6, 0x15, 0x4b, 0x25, 0x25, 0xb7, 0x2c, 0xb0, 0x9c,
-  0x83, 0xe1, 0xad, 0x2b, 0x35, 0x80, 0xe7, 0x7f, 0x55, 0xaa, 0x49, 0x54,
-  0x14, 0xff, 0xd8, 0x28, 0xd5, 0xc4, 0x18, 0xee, 0xa7, 0xc0, 0x5d, 0x69,
-  0xc3, 0x79, 0xe4, 0xb4, 0xab, 0x31, 0xa5, 0x2b, 0xb1, 0xad, 0x58, 0x14,
-  0x2c, 0x9b, 0xf5, 0x86, 0x92, 0x13, 0x57, 0xdf, 0x73, 0x6b, 0xc7, 0x33,
-  0xf2, 0x6b, 0xe5, 0xb0, 0x4e, 0xfe, 0x20, 0xf9, 0xca, 0x29, 0x0d, 0xe7,
-  0x2e, 0x45, 0xf2, 0x5b, 0xe9, 0xe0, 0x5e, 0x79, 0xad, 0x9f, 0x9c, 0xcb,
-  0x1f, 0xd5, 0x93, 0x36, 0xf9, 0x8b, 0xba, 0xb6, 0x4a, 0x1f, 0x68, 0x99,
-  0x92, 0xc9, 0x87, 0xf9, 0x73, 0xac, 0x0a, 0x46, 0x84, 0x8b, 0x62, 0xe1,
-  0x29, 0x1b, 0xa7, 0x59, 0x11, 0x2f, 0x6c, 0xb9, 0x6d, 0x0e, 0x0a, 0x47,
-  0x63, 0xe3, 0xeb, 0xa5, 0x7a, 0x31, 0x21, 0x0b, 0x9d, 0x3e, 0xb9, 0x4c,
-  0xe9, 0xce, 0xba, 0x68, 0x3c, 0x5d, 0x7f, 0xde, 0x59, 0x39, 0x51, 0xc5,
-  0xf5, 0x3d, 0x87, 0xd3, 0x99, 0x6c, 0xca, 0xf5, 0xa2, 0x8b, 0x33, 0x39,
-  0xa9, 0x98, 0x96, 0x88, 0x2e, 0xe9, 0x93, 0x61, 0x80, 0xcb, 0x23, 0xcc,
-  0x0f, 0xe0, 0x02, 0xfa, 0xf0, 0x30, 0x09, 0x87, 0x9b, 0x94, 0x79, 0x21,
-  0x5c, 0xa6, 0xf3, 0x5a, 0x16, 0x97, 0x70, 0xf4, 0x50, 0x82, 0xae, 0x9e,
-  0xc1, 0x9f, 0x53, 0x16, 0x47, 0xd9, 0x63, 0x5a, 0xcf, 0xf6, 0xce, 0xe9,
-  0x8b, 0x94, 0xc5, 0x3f, 0xef, 0xb1, 0x98, 0x05, 0x96, 0xfe, 0x09, 0x63,
-  0x18, 0x7e, 0x5b, 0x41, 0x7f, 0xe9, 0x17, 0xf7, 0x7e, 0x5b, 0x41, 0xf3,
-  0xeb, 0x8b, 0x7b, 0xff, 0x17, 0xef, 0x2d, 0xeb, 0x23, 0x14, 0xe3, 0x04,
-  0x00
+  0xc5, 0xd3, 0xac, 0xf9, 0x73, 0xef, 0x79, 0x92, 0xeb, 0x61, 0xf7, 0x84,
+  0xbb, 0x13, 0x15, 0x11, 0xf0, 0x53, 0x88, 0x25, 0x3d, 0x46, 0xc7, 0xfb,
+  0x32, 0xc1, 0x87, 0x3f, 0x0b, 0xbf, 0x76, 0x83, 0x7e, 0x77, 0xd2, 0x0f,
+  0xd2, 0xe2, 0xe8, 0xf6, 0xbd, 0x3d, 0x0f, 0xfe, 0x07, 0x65, 0x75, 0x7c,
+  0x17, 0x93, 0xfb, 0xe5, 0xcf, 0xb3, 0xf1, 0x41, 0xe7, 0x9b, 0x13, 0xf2,
+  0x77, 0x4b, 0x8a, 0x08, 0xb6, 0x4b, 0x05, 0xbd, 0x36, 0x30, 0xe6, 0x7d,
+  0xe1, 0xc8, 0xc1, 0xcf, 0x42, 0xe4, 0x5e, 0xf8, 0x35, 0x42, 0xb7, 0x09,
+  0xf2, 0x96, 0x2d, 0x22, 0x32, 0x52, 0xf7, 0x0b, 0x05, 0x8f, 0x96, 0xa9,
+  0x97, 0x77, 0xa6, 0x5f, 0xde, 0x63, 0xe9, 0x39, 0x7b, 0x5e, 0x00, 0xa4,
+  0xe7, 0xc1, 0x38, 0x06, 0xda, 0x27, 0xf1, 0xf8, 0xbe, 0xb0, 0x6d, 0xfc,
+  0xf3, 0xc8, 0x86, 0x04, 0x2d, 0x6e, 0x85, 0x62, 0x61, 0x1f, 0xa4, 0x42,
+  0x12, 0x0c, 0x46, 0x7d, 0x57, 0x06, 0xcc, 0xbb, 0xcf, 0xb8, 0x72, 0x1f,
+  0x48, 0x25, 0x79, 0x93, 0x0e, 0xc7, 0x4e, 0x2e, 0x7a, 0x83, 0xa8, 0x88,
+  0x6a, 0xcf, 0x57, 0x57, 0xc8, 0x37, 0x1e, 0xe3, 0xb0, 0xee, 0x60, 0xa2,
+  0xbf, 0xfd, 0x39, 0x36, 0x92, 0xd5, 0xb6, 0x3a, 0xbb, 0xef, 0xbc, 0xad,
+  0x49, 0x1a, 0x7b, 0xfb, 0xe4, 0xce, 0x7d, 0x5f, 0x26, 0xf1, 0xdf, 0x3f,
+  0x07, 0x89, 0x59, 0xb8, 0xd3, 0x09, 0xf9, 0x05, 0x9f, 0xfc, 0x35, 0x49,
+  0xd2, 0xe8, 0xac, 0x70, 0xe7, 0xde, 0xde, 0xff, 0xdd, 0xdb, 0xc3, 0x03,
+  0xdc, 0x52, 0xed, 0xfd, 0x36, 0x44, 0xfb, 0xd7, 0xcf, 0xbd, 0x00, 0x61,
+  0xc4, 0x63, 0xff, 0x24, 0xc5, 0x74, 0xb4, 0x05, 0xf9, 0x7e, 0xb9, 0x02,
+  0x1f, 0xa6, 0xde, 0xf6, 0x45, 0x34, 0x9a, 0x87, 0x5f, 0x6f, 0xe9, 0x32,
+  0x90, 0x5c, 0x27, 0x69, 0x38, 0xb8, 0x3f, 0xfe, 0x02, 0xce, 0xac, 0xee,
+  0x7c, 0x89, 0x46, 0x6c, 0x7f, 0x40, 0x5a, 0xd5, 0xee, 0x0f, 0x65, 0xc6,
+  0x79, 0x73, 0x24, 0x11, 0xd5, 0x4e, 0x26, 0xa3, 0x1e, 0xec, 0x73, 0x60,
+  0x7a, 0x17, 0x4a, 0x50, 0xe6, 0x42, 0xe5, 0xed, 0x1f, 0x6e, 0x2d, 0x7e,
+  0x85, 0x0e, 0x7e, 0x80, 0x61, 0xfd, 0xc7, 0xe5, 0x99, 0x82, 0x79, 0x8d,
+  0x91, 0x44, 0x3f, 0xe8, 0x4c, 0xfc, 0x6e, 0xc9, 0xf8, 0x5d, 0x94, 0x75,
+  0x0c, 0xca, 0x42, 0xf3, 0xd1, 0x49, 0xc1, 0x55, 0x0f, 0x8a, 0x04, 0xe5,
+  0x79, 0xbd, 0x92, 0x45, 0x4b, 0xd1, 0xef, 0x9a, 0xcb, 0xaa, 0xa2, 0x98,
+  0x4c, 0x7a, 0x27, 0xdd, 0x60, 0xdc, 0x73, 0x4b, 0xca, 0x37, 0x44, 0x49,
+  0xef, 0x88, 0xee, 0xc0, 0x40, 0x6f, 0x72, 0x74, 0xba, 0x4e, 0x30, 0xd0,
+  0x98, 0xed, 0x2f, 0x8f, 0xab, 0x0b, 0xd1, 0x2a, 0x9e, 0x81, 0x95, 0xd2,
+  0xa1, 0xa1, 0x1b, 0x3c, 0x43, 0x6b, 0x05, 0x13, 0x93, 0xf0, 0x21, 0x96,
+  0x3e, 0xe2, 0x14, 0x07, 0x86, 0x6e, 0x7a, 0x76, 0x57, 0x76, 0xa5, 0x7a,
+  0x84, 0xfe, 0x9b, 0xfd, 0x88, 0x75, 0x4a, 0xf8, 0xf7, 0xb1, 0x7e, 0x51,
+  0xc2, 0x1c, 0x6b, 0x75, 0xec, 0x86, 0x0d, 0x46, 0x27, 0x4c, 0xaf, 0x30,
+  0x3d, 0x0f, 0xdf, 0x77, 0x33, 0xa7, 0x7a, 0xf2, 0x56, 0x47, 0x6a, 0x5d,
+  0x00, 0x95, 0xaf, 0x30, 0x78, 0x69, 0x0c, 0x9f, 0x13, 0xca, 0xe9, 0x0d,
+  0x30, 0xf2, 0xfd, 0xcf, 0x39, 0x0d, 0xce, 0xb5, 0xf6, 0xcc, 0x31, 0x07,
+  0xd9, 0x5b, 0xea, 0xe3, 0xbc, 0xa6, 0xb1, 0x7e, 0x3c, 0xe9, 0xd1, 0xdd,
+  0x53, 0xfd, 0x38, 0xe8, 0x15, 0xcc, 0x3f, 0x8f, 0x45, 0x7c, 0x30, 0x87,
+  0x7e, 0xed, 0x07, 0x47, 0x84, 0xd3, 0x7c, 0x21, 0x92, 0xf0, 0x07, 0x88,
+  0x27, 0x46, 0x88, 0xc9, 0xa8, 0x88, 0x0c, 0x2c, 0xca, 0x8e, 0x89, 0x5e,
+  0x64, 0x61, 0x2d, 0x1a, 0x86, 0x0f, 0x07, 0x95, 0xc1, 0x3b, 0x1e, 0xbb,
+  0xe1, 0x28, 0xdd, 0xf4, 0x9b, 0x9d, 0x68, 0xe8, 0xaf, 0xcc, 0x4c, 0x52,
+  0x2e, 0x1c, 0x5f, 0x7d, 0x2a, 0x58, 0x81, 0xee, 0x93, 0xb4, 0xab, 0x9a,
+  0x5e, 0x3f, 0x3a, 0x8b, 0xdc, 0xe2, 0xec, 0x4b, 0xb4, 0xfc, 0x2e, 0x2a,
+  0x14, 0x59, 0x77, 0xef, 0x24, 0x6a, 0x55, 0x27, 0xe8, 0x25, 0xe2, 0xbe,
+  0x1c, 0x8c, 0x2a, 0xbb, 0xd9, 0xc4, 0x5d, 0x92, 0x75, 0xae, 0xeb, 0xbf,
+  0xc4, 0xe9, 0x71, 0x17, 0x4d, 0x51, 0xde, 0x01, 0x86, 0x7a, 0xdd, 0x66,
+  0xea, 0xcc, 0xdc, 0x03, 0x50, 0x57, 0xf4, 0x8c, 0x8f, 0x25, 0x47, 0x3d,
+  0x41, 0x2f, 0x8a, 0xcb, 0xc4, 0x82, 0x0a, 0x78, 0x39, 0x49, 0xa2, 0xde,
+  0xab, 0x36, 0xfb, 0x31, 0xe7, 0xde, 0xbc, 0x90, 0x47, 0xb3, 0x96, 0xd1,
+  0xa3, 0xc9, 0xb2, 0xb7, 0xb9, 0x2d, 0xeb, 0x3a, 0x49, 0x11, 0x4f, 0xd2,
+  0x12, 0x63, 0x2d, 0xe5, 0xbb, 0xf1, 0xda, 0xed, 0xdd, 0x1d, 0x47, 0xcf,
+  0x6d, 0x6b, 0xaf, 0x2d, 0xcd, 0x24, 0xf6, 0x0b, 0x10, 0x84, 0x8e, 0xf9,
+  0xaf, 0x2c, 0xae, 0xe3, 0xae, 0x59, 0x5d, 0x76, 0xb3, 0xc6, 0x79, 0xd2,
+  0xe1, 0xa0, 0xa1, 0x47, 0x43, 0xc0, 0xd5, 0xff, 0x0e, 0x74, 0xeb, 0xc7,
+  0xe7, 0xd1, 0xb0, 0x24, 0xb9, 0x3b, 0xe2, 0x82, 0x79, 0x21, 0x66, 0x27,
+  0x5d, 0xc5, 0x5b, 0x8e, 0x48, 0x2c, 0x57, 0xbe, 0xc1, 0x86, 0xd1, 0x88,
+  0x89, 0x72, 0x4b, 0xa5, 0x11, 0x06, 0x0f, 0x5e, 0xc4, 0xfd, 0x5e, 0x38,
+  0xde, 0xf4, 0x11, 0x65, 0x5b, 0x21, 0xb6, 0x4c, 0xa4, 0xe1, 0x37, 0x2b,
+  0x88, 0x71, 0x18, 0xf4, 0x50, 0x8b, 0x71, 0x84, 0x07, 0x51, 0xd3, 0xb0,
+  0x71, 0x87, 0xb9, 0x94, 0xaf, 0xbd, 0x52, 0xed, 0xc2, 0x9a, 0x1f, 0x4e,
+  0x19, 0xcc, 0x13, 0x77, 0x15, 0x8f, 0x7b, 0x6e, 0xea, 0x14, 0x95, 0x50,
+  0xc8, 0xe0, 0x2e, 0xb6, 0x58, 0x52, 0x14, 0x5e, 0xbf, 0x44, 0xa2, 0x86,
+  0x4f, 0x9b, 0x65, 0x67, 0xc9, 0x1f, 0x74, 0x23, 0xd2, 0x10, 0xf4, 0xdb,
+  0x78, 0x7c, 0x79, 0xd2, 0xbd, 0x08, 0x31, 0x2e, 0xbd, 0xe8, 0x66, 0x24,
+  0x3e, 0xdb, 0xe6, 0xbf, 0x13, 0xc9, 0xa1, 0x58, 0xdc, 0x32, 0xcf, 0x70,
+  0x3c, 0x18, 0xa5, 0xf7, 0xc7, 0x42, 0x25, 0x7c, 0x91, 0xdd, 0xec, 0xc4,
+  0xd5, 0x35, 0xc0, 0x7a, 0x99, 0x07, 0x11, 0xbf, 0x3a, 0xa0, 0x9f, 0xdf,
+  0x27, 0xc8, 0xc5, 0x3e, 0x6b, 0x4b, 0xad, 0xc4, 0xc5, 0x62, 0x49, 0x9d,
+  0x72, 0xac, 0x6b, 0x8e, 0x89, 0x3e, 0x08, 0xbe, 0xf5, 0xc3, 0xe1, 0x79,
+  0x7a, 0xb1, 0xe9, 0xaf, 0xe5, 0x32, 0x15, 0xac, 0x2c, 0xd4, 0xe8, 0xae,
+  0x11, 0x3a, 0x18, 0x76, 0xc3, 0x7e, 0x45, 0x95, 0x67, 0x06, 0xc5, 0x3f,
+  0x29, 0xbe, 0x7b, 0x64, 0xeb, 0xe3, 0xf6, 0xdb, 0xbd, 0x85, 0x59, 0x78,
+  0x78, 0x5f, 0xe2, 0xcb, 0xfb, 0xb0, 0xeb, 0x81, 0x35, 0xa8, 0xb0, 0xef,
+  0xfb, 0x7f, 0xdc, 0xa1, 0xb9, 0xda, 0x21, 0x0b, 0x82, 0x7e, 0x38, 0xbe,
+  0x47, 0xa2, 0xe0, 0x2a, 0x18, 0x3b, 0x8d, 0xfb, 0x4c, 0x85, 0xdf, 0x7b,
+  0xfb, 0xe9, 0x70, 0xa6, 0x59, 0xff, 0xc0, 0x39, 0xee, 0x52, 0x06, 0xc8,
+  0xc0, 0xe7, 0x8b, 0x78, 0x0c, 0x02, 0x80, 0xc9, 0x85, 0xb8, 0x17, 0xf4,
+  0x4f, 0x4e, 0xb8, 0x09, 0xd0, 0x1c, 0x72, 0x2c, 0x41, 0xa4, 0x13, 0xf2,
+  0x48, 0xfb, 0xfe, 0x6a, 0xde, 0x69, 0x58, 0x71, 0x9f, 0x21, 0xaf, 0x9b,
+  0xbe, 0xcd, 0xd4, 0x60, 0xe8, 0xff, 0xff, 0x99, 0xf1, 0xc0, 0x85, 0x1a,
+  0x0b, 0x5e, 0xf4, 0xab, 0x5f, 0xa5, 0xa7, 0xfe, 0xb0, 0xd5, 0x5e, 0xe4,
+  0x44, 0x71, 0x06, 0x49, 0x32, 0x7a, 0x51, 0xe3, 0x77, 0xb2, 0x38, 0xaa,
+  0x71, 0x9d, 0xdd, 0x7e, 0x18, 0x8c, 0x67, 0xe3, 0x61, 0xe1, 0x91, 0xd3,
+  0x0f, 0x53, 0xc5, 0x99, 0x71, 0xa1, 0xe7, 0xc7, 0xb8, 0xdc, 0x06, 0xa0,
+  0xf2, 0xe7, 0x58, 0x29, 0xea, 0x6d, 0xfa, 0x0c, 0xf3, 0x43, 0x28, 0xb2,
+  0x05, 0x45, 0x0a, 0x6d, 0xf5, 0xac, 0xe8, 0xc9, 0x89, 0x80, 0x97, 0x63,
+  0x6e, 0xd8, 0x2b, 0xf2, 0x4f, 0xb7, 0x62, 0x40, 0xa5, 0x90, 0xfe, 0xc3,
+  0xe8, 0x25, 0x1a, 0xc9, 0xc2, 0x31, 0x6c, 0x4d, 0xa3, 0xc1, 0x39, 0xac,
+  0xf7, 0x4a, 0x59, 0xf5, 0x4f, 0xa3, 0x12, 0x29, 0xd0, 0x5c, 0x9a, 0xfa,
+  0xd4, 0xf3, 0xab, 0xb0, 0x93, 0xc4, 0xdd, 0xcb, 0x30, 0xfd, 0xc2, 0xdf,
+  0xba, 0xda, 0xc3, 0x21, 0xf2, 0x30, 0xc7, 0xda, 0x25, 0x48, 0x3f, 0xff,
+  0x55, 0x12, 0x9d, 0x0f, 0x41, 0x12, 0xd2, 0x5e, 0x84, 0x22, 0xb0, 0xad,
+  0xcd, 0x27, 0xdd, 0x71, 0x34, 0x92, 0xdd, 0x03, 0x08, 0x09, 0x6c, 0xcd,
+  0xd3, 0xf1, 0x04, 0xd3, 0x9d, 0x6c, 0x7a, 0x37, 0xf4, 0x9e, 0xc2, 0xc8,
+  0xd7, 0xbd, 0x23, 0x49, 0x83, 0x1b, 0x5a, 0x84, 0xd6, 0x3d, 0x1f, 0xff,
+  0xf3, 0x1b, 0xa4, 0x2e, 0xc1, 0xaf, 0x24, 0xc5, 0xd8, 0x7a, 0xf8, 0x9d,
+  0x44, 0x7f, 0xc3, 0xef, 0xb5, 0x67, 0xde, 0xb4, 0x91, 0xaf, 0xc3, 0x92,
+  0x86, 0xc2, 0x76, 0x50, 0xd6, 0xeb, 0x5c, 0xa7, 0xa1, 0xac, 0xd5, 0xb2,
+  0x56, 0xca, 0xae, 0x32, 0xbf, 0x55, 0x2d, 0xe8, 0x11, 0x69, 0x62, 0xb3,
+  0xd5, 0x86, 0x6e, 0xcf, 0x54, 0x01, 0xd3, 0xd3, 0xfe, 0xa9, 0x5d, 0x4c,
+  0x3d, 0x6b, 0x6d, 0xbc, 0x80, 0x54, 0xdc, 0x3f, 0x3a, 0x73, 0x65, 0x7e,
+  0x53, 0x6a, 0x59, 0xbd, 0xe3, 0xc6, 0x83, 0xe9, 0xc6, 0x03, 0x75, 0xa4,
+  0x0f, 0x82, 0x71, 0x12, 0x8e, 0xe5, 0x70, 0x8f, 0x62, 0x18, 0xec, 0x55,
+  0x56, 0x78, 0x84, 0x9f, 0x58, 0xa9, 0xad, 0xf1, 0x38, 0xb8, 0xae, 0x75,
+  0x26, 0x67, 0x67, 0x00, 0x92, 0x71, 0xc8, 0x4e, 0xc8, 0xd8, 0x27, 0xc6,
+  0x94, 0x3c, 0xec, 0x5d, 0x9d, 0x03, 0xc9, 0xb8, 0x89, 0x9f, 0x4a, 0x30,
+  0x20, 0xd0, 0x48, 0xbe, 0xee, 0x11, 0x7b, 0x75, 0xbc, 0x21, 0x6b, 0x62,
+  0x8e, 0xc0, 0x26, 0xe0, 0x01, 0xc5, 0x57, 0xb3, 0xb7, 0xd8, 0x36, 0xbc,
+  0x19, 0x86, 0x57, 0xde, 0xe7, 0x68, 0x98, 0xbe, 0xcc, 0x30, 0xaa, 0x67,
+  0x85, 0xa2, 0x33, 0xaf, 0xa6, 0x35, 0xa9, 0x62, 0x94, 0x61, 0xc5, 0x9a,
+  0x6c, 0x03, 0x69, 0x00, 0xa2, 0x4a, 0x86, 0xe6, 0x79, 0x48, 0xaf, 0x6b,
+  0x05, 0x7d, 0xdc, 0x78, 0xa0, 0x5b, 0x29, 0xd2, 0xc9, 0x78, 0xe8, 0x1d,
+  0x35, 0x9b, 0xcd, 0x0c, 0xa3, 0x26, 0x12, 0x7f, 0x8f, 0x98, 0x0e, 0x53,
+  0xb5, 0xcb, 0xd6, 0xea, 0xc7, 0xcd, 0x41, 0x30, 0xaa, 0xd5, 0xea, 0xde,
+  0xe6, 0x2b, 0x03, 0x31, 0x05, 0x96, 0xd6, 0x81, 0xe6, 0x38, 0xec, 0x4d,
+  0xba, 0x61, 0xad, 0x16, 0x74, 0xbb, 0x02, 0x85, 0xdd, 0x34, 0x1c, 0x38,
+  0x40, 0xe0, 0x3f, 0x28, 0x79, 0x94, 0x15, 0x6c, 0x22, 0x93, 0x1c, 0x43,
+  0x3f, 0x89, 0xac, 0xd0, 0xbf, 0x3f, 0x83, 0xfe, 0x24, 0xd4, 0x86, 0x92,
+  0xe0, 0x6d, 0x58, 0x61, 0x71, 0x94, 0x00, 0x64, 0xfe, 0xfb, 0xb4, 0xe1,
+  0xdd, 0x4c, 0x8d, 0x7a, 0xea, 0xef, 0xe9, 0x03, 0x03, 0xca, 0x70, 0xd2,
+  0xef, 0xb3, 0xcf, 0x9c, 0x1b, 0xdd, 0xd8, 0x28, 0x5d, 0x63, 0x59, 0x57,
+  0xbc, 0x9a, 0xd2, 0x25, 0x64, 0xf1, 0xdc, 0xc8, 0x62, 0x16, 0x4a, 0xc6,
+  0xf5, 0xeb, 0x2e, 0xca, 0x62, 0x33, 0x47, 0x82, 0xbd, 0x96, 0x96, 0x8e,
+  0x37, 0x2c, 0x10, 0xb8, 0x1c, 0xcb, 0xc3, 0xd0, 0x18, 0xfa, 0x80, 0xd8,
+  0x53, 0x80, 0xca, 0xd3, 0x46, 0xf2, 0xf0, 0xd2, 0xa6, 0xd2, 0xad, 0x26,
+  0xce, 0xc6, 0x0d, 0x17, 0x76, 0x19, 0x0f, 0x19, 0x35, 0xea, 0xc7, 0xd6,
+  0xb1, 0x51, 0x78, 0xc9, 0xf7, 0xfc, 0x7a, 0x41, 0x99, 0x93, 0xee, 0x45,
+  0x30, 0x6e, 0x78, 0xd1, 0xb0, 0x17, 0x7e, 0x2b, 0x60, 0x1c, 0x9c, 0x3d,
+  0x44, 0x22, 0xa5, 0x93, 0x4b, 0xac, 0xd6, 0xb1, 0xf7, 0xca, 0x7b, 0xd2,
+  0xaa, 0x3b, 0x2a, 0x2a, 0x9d, 0x68, 0x13, 0xf9, 0x9a, 0x67, 0xb0, 0x85,
+  0xdb, 0x86, 0x46, 0xb7, 0x41, 0xe3, 0x71, 0xc2, 0x74, 0xf0, 0xdc, 0xb4,
+  0x88, 0x13, 0x7d, 0xdf, 0xc2, 0x88, 0x8e, 0xbe, 0xff, 0x15, 0x47, 0xc3,
+  0x9a, 0xef, 0xa2, 0x0c, 0x20, 0x3a, 0xa8, 0xe5, 0xd8, 0x35, 0xe3, 0xcc,
+  0x32, 0x39, 0xb0, 0x10, 0x59, 0x57, 0x3e, 0xe5, 0x61, 0x33, 0x3c, 0xb2,
+  0x8c, 0x19, 0x7c, 0x43, 0xde, 0xc2, 0xaf, 0x16, 0xae, 0xb2, 0x4d, 0x5b,
+  0x98, 0xae, 0xab, 0x75, 0x39, 0xfd, 0x60, 0x15, 0x58, 0xf9, 0xd5, 0xfb,
+  0xfd, 0x4d, 0x7b, 0x9b, 0x6f, 0x0d, 0x7e, 0xef, 0xc7, 0x9d, 0xa0, 0xef,
+  0xed, 0x77, 0xfe, 0x02, 0x15, 0xfb, 0xd7, 0x15, 0xbe, 0x46, 0x28, 0x05,
+  0xc4, 0x0a, 0xc1, 0xd4, 0xbe, 0x0f, 0xc1, 0x68, 0x04, 0x03, 0xbd, 0xae,
+  0xa0, 0xd5, 0xc2, 0x55, 0x87, 0x3e, 0x8a, 0x6b, 0x92, 0xfc, 0x6c, 0xb1,
+  0x5a, 0xd3, 0x3f, 0xe2, 0x55, 0x49, 0xca, 0xd7, 0x27, 0xfa, 0xd7, 0x17,
+  0x6b, 0x6a, 0xd5, 0xa7, 0xf2, 0x23, 0xbc, 0xc7, 0xdb, 0x20, 0x94, 0x6f,
+  0xcf, 0xb2, 0x8a, 0xff, 0x58, 0x43, 0xb0, 0xda, 0xd7, 0xe7, 0xd9, 0xd7,
+  0x67, 0x97, 0xef, 0xff, 0xc6, 0xab, 0x12, 0xc2, 0x9d, 0xf8, 0x6a, 0xa8,
+  0x14, 0x79, 0x29, 0x8b, 0xb4, 0x29, 0x2b, 0x1b, 0xde, 0x09, 0x72, 0xc8,
+  0xae, 0x04, 0x51, 0x4a, 0xfd, 0x43, 0x96, 0xda, 0x03, 0xbd, 0x6e, 0x9b,
+  0xb2, 0x10, 0xb1, 0x7b, 0xa9, 0x78, 0x21, 0xce, 0x36, 0x7c, 0x9f, 0xf5,
+  0x47, 0x78, 0x9d, 0x7c, 0x88, 0x3b, 0x51, 0x3f, 0xc4, 0xcc, 0x4f, 0x50,
+  0x17, 0x83, 0x81, 0x7c, 0x47, 0x11, 0x95, 0x84, 0x58, 0x6e, 0xdd, 0x18,
+  0x69, 0xbe, 0x9e, 0xa3, 0x42, 0xb9, 0x13, 0x77, 0x15, 0xa4, 0xf0, 0x1f,
+  0x66, 0x52, 0x80, 0x8f, 0x2f, 0x8c, 0xd7, 0x93, 0x11, 0xbc, 0xfc, 0xd5,
+  0x78, 0x49, 0xe9, 0x02, 0xe0, 0xfd, 0x73, 0xe3, 0x3d, 0x1e, 0x6d, 0xc3,
+  0xeb, 0x15, 0xe5, 0xb5, 0xa2, 0x65, 0xd0, 0x75, 0x25, 0xb7, 0xc1, 0xe9,
+  0xc2, 0x86, 0xd3, 0x53, 0x07, 0x4e, 0x7f, 0xdb, 0x71, 0x7a, 0x66, 0xc7,
+  0x89, 0xdd, 0x82, 0x92, 0x14, 0x60, 0xf5, 0x19, 0xdd, 0x7e, 0xac, 0x68,
+  0xbd, 0xb1, 0xa1, 0xb5, 0xed, 0x40, 0x6b, 0xcb, 0x8e, 0xd6, 0x4e, 0x1e,
+  0x2d, 0xfe, 0x5f, 0x2f, 0x48, 0x83, 0xff, 0x9a, 0x84, 0x93, 0xb0, 0x27,
+  0xb5, 0xa8, 0x28, 0xf9, 0x92, 0xb0, 0x9c, 0xb8, 0xeb, 0xde, 0x59, 0xd0,
+  0x4f, 0x42, 0xf6, 0x7a, 0x10, 0x7c, 0x6b, 0x33, 0xd5, 0xfa, 0xc5, 0x1a,
+  0x7b, 0xf3, 0x2f, 0xaa, 0x87, 0xbb, 0x1c, 0x68, 0x82, 0xb7, 0x80, 0x4a,
+  0x2c, 0x1e, 0x9f, 0xec, 0xc0, 0x5e, 0x5b, 0xab, 0x0e, 0xfd, 0xfb, 0x1a,
+  0x8e, 0x77, 0x0f, 0x94, 0xa2, 0x4c, 0xdc, 0xac, 0xd3, 0x32, 0xcb, 0x5e,
+  0x61, 0x76, 0x5a, 0xd8, 0x55, 0x7e, 0xc9, 0x54, 0xba, 0x49, 0xa4, 0x12,
+  0x8d, 0x1d, 0xc8, 0xbf, 0x21, 0xc6, 0x56, 0xeb, 0x65, 0xdf, 0x76, 0xd9,
+  0x4d, 0x39, 0xfa, 0x27, 0x96, 0x85, 0x0b, 0xb1, 0x67, 0x9a, 0x6e, 0x62,
+  0x16, 0x90, 0x09, 0x98, 0x58, 0x02, 0x52, 0xf3, 0x33, 0xdb, 0x1b, 0x99,
+  0x6f, 0xd9, 0xce, 0x6d, 0x1b, 0x77, 0xa7, 0xe6, 0x27, 0xb6, 0x6b, 0x60,
+  0x78, 0x62, 0xf2, 0x85, 0xfc, 0x77, 0xe6, 0x14, 0xc0, 0xfc, 0x2b, 0x5c,
+  0x5f, 0xb9, 0xa7, 0x80, 0xf9, 0x19, 0x35, 0x7d, 0x37, 0x68, 0xfc, 0xba,
+  0xcd, 0xb2, 0xa5, 0xe5, 0x51, 0x86, 0xbe, 0x0f, 0x22, 0xd8, 0x67, 0xe5,
+  0xde, 0x53, 0xb2, 0x23, 0x1b, 0x38, 0xf6, 0x05, 0xc8, 0xd2, 0xbd, 0xb0,
+  0x7d, 0x86, 0xed, 0x5e, 0x9b, 0xb6, 0x7b, 0xfc, 0x08, 0x22, 0x8a, 0x87,
+  0x7c, 0xe3, 0x97, 0x2b, 0x09, 0x3b, 0x3b, 0x5e, 0xa8, 0xe0, 0x93, 0x7d,
+  0x68, 0xb1, 0x80, 0xb5, 0x75, 0xfe, 0xfe, 0x10, 0xed, 0x53, 0xb6, 0x8f,
+  0x07, 0xfc, 0x94, 0xc9, 0xca, 0x15, 0x58, 0xa0, 0xdd, 0xde, 0x71, 0x7e,
+  0xdb, 0x1a, 0xb9, 0xb1, 0x69, 0xa7, 0x41, 0xe1, 0x47, 0x9c, 0x02, 0xe6,
+  0x27, 0x32, 0x85, 0x59, 0x5f, 0xee, 0x5f, 0x5a, 0x5f, 0x6f, 0x33, 0xa3,
+  0x9f, 0x85, 0x3d, 0x06, 0x23, 0xc7, 0xdb, 0x3c, 0x24, 0xf6, 0x7e, 0x9b,
+  0xcc, 0xec, 0x8e, 0x6f, 0x45, 0xcd, 0xe4, 0xa8, 0xc3, 0xe5, 0x06, 0x73,
+  0x4a, 0x3d, 0xe4, 0xfc, 0x84, 0xe9, 0x85, 0xc7, 0x72, 0xce, 0x4a, 0xa6,
+  0x68, 0xd3, 0x9c, 0xff, 0x3c, 0xee, 0x67, 0x93, 0x1e, 0xe9, 0xa3, 0x2f,
+  0x20, 0xb4, 0xde, 0x04, 0x23, 0x45, 0x42, 0xe1, 0x11, 0x69, 0x56, 0x83,
+  0x37, 0x78, 0xa5, 0x4d, 0xda, 0xab, 0x64, 0x1b, 0x8f, 0xc5, 0x8c, 0x76,
+  0x13, 0xce, 0x45, 0xdb, 0xf1, 0x04, 0x33, 0xb3, 0x2a, 0x1f, 0x3e, 0xc6,
+  0xed, 0x09, 0xb9, 0x65, 0x08, 0x3e, 0x1d, 0x9e, 0xe7, 0x0b, 0x21, 0xb4,
+  0x18, 0x7b, 0xbb, 0xca, 0xd5, 0x8d, 0x5f, 0x3d, 0x69, 0xce, 0x20, 0xf9,
+  0x45, 0x7e, 0x66, 0x52, 0xd5, 0xa0, 0x83, 0xb9, 0x2f, 0x7a, 0x5f, 0x41,
+  0xe9, 0x50, 0x37, 0x4b, 0xa8, 0xa0, 0x3e, 0xcc, 0x54, 0x92, 0x66, 0x26,
+  0x5a, 0x55, 0x6d, 0x0c, 0x4b, 0x29, 0x85, 0xae, 0x12, 0x53, 0x6d, 0x5d,
+  0xf9, 0xd5, 0xa9, 0xc5, 0xb2, 0x7f, 0xab, 0xf4, 0xdc, 0xde, 0xff, 0xf8,
+  0xf1, 0xed, 0xf6, 0xe1, 0xee, 0xc7, 0xdf, 0x4b, 0x8a, 0xb7, 0xe8, 0xb9,
+  0x7f, 0xf0, 0xf6, 0x63, 0x49, 0xc1, 0x35, 0x06, 0x77, 0x6f, 0xbf, 0x5d,
+  0x0e, 0xf4, 0x89, 0x2c, 0xfb, 0x76, 0xa7, 0xa4, 0x28, 0x90, 0x50, 0xfd,
+  0x29, 0x36, 0x4c, 0x1a, 0x0d, 0x9a, 0x78, 0x9c, 0x7e, 0x8d, 0x4e, 0x27,
+  0xa1, 0x4d, 0x8b, 0xa7, 0xbd, 0x4f, 0x6b, 0xdd, 0xfe, 0x7e, 0x6d, 0xdd,
+  0x8a, 0x80, 0x0e, 0x9f, 0x0e, 0x89, 0x6a, 0x0e, 0x95, 0xbe, 0x03, 0xad,
+  0x5f, 0x6e, 0xd8, 0xa1, 0x3f, 0xa9, 0x00, 0x1d, 0x37, 0xfe, 0x72, 0xf3,
+  0x58, 0x01, 0xf8, 0xd4, 0xb2, 0x09, 0x35, 0x99, 0x27, 0xcf, 0x17, 0x5d,
+  0x00, 0x94, 0x86, 0x92, 0x05, 0x2d, 0x9b, 0x83, 0xcc, 0x78, 0x22, 0x97,
+  0x56, 0x83, 0x45, 0xbb, 0x2c, 0xc1, 0x5d, 0xb3, 0x1f, 0x9f, 0xd7, 0x7c,
+  0x59, 0xc8, 0xe7, 0xa0, 0x0a, 0x59, 0xb3, 0x80, 0x9e, 0xac, 0x79, 0x2b,
+  0xe7, 0x43, 0xfb, 0xa4, 0x16, 0xb0, 0x82, 0x3c, 0x65, 0xfc, 0x17, 0x10,
+  0x0b, 0x7c, 0xe1, 0xa8, 0x81, 0x5a, 0x10, 0x02, 0x18, 0x89, 0xb9, 0xd1,
+  0x4b, 0xcb, 0x14, 0xd3, 0x49, 0xff, 0xcb, 0x2f, 0x6c, 0x6a, 0x7e, 0x92,
+  0x0c, 0x54, 0xab, 0xab, 0x68, 0xb3, 0xbd, 0x86, 0x03, 0xcf, 0x22, 0x51,
+  0x91, 0xd9, 0x77, 0x72, 0x63, 0x1d, 0x5e, 0x79, 0xd9, 0x30, 0xa8, 0x5f,
+  0x73, 0xa2, 0xb0, 0xe1, 0x1d, 0xf9, 0xc1, 0xb8, 0x37, 0x89, 0x86, 0xb1,
+  0x2f, 0x36, 0x94, 0x3a, 0x21, 0xe3, 0x21, 0x68, 0x22, 0x43, 0xa3, 0x9b,
+  0xb9, 0xa1, 0xba, 0xc2, 0x3b, 0x2f, 0xb0, 0xa0, 0xaf, 0x8c, 0xba, 0x85,
+  0x9a, 0x44, 0x6b, 0xa5, 0x88, 0xd6, 0x96, 0x2e, 0x2f, 0x97, 0x96, 0xb2,
+  0x62, 0x64, 0x74, 0xe7, 0x02, 0x51, 0xa7, 0x2f, 0x7f, 0xe9, 0x02, 0xc9,
+  0x3f, 0xe3, 0x76, 0x32, 0x4c, 0x05, 0x00, 0xc9, 0x57, 0x0d, 0xef, 0xf9,
+  0xea, 0xea, 0xaa, 0xbd, 0xae, 0xc6, 0x22, 0xc8, 0x04, 0x8e, 0x16, 0xaa,
+  0x0c, 0xd0, 0xd4, 0x4e, 0x58, 0xe2, 0xd1, 0x72, 0xca, 0x8a, 0x92, 0x2a,
+  0x69, 0x6f, 0x49, 0x10, 0x17, 0xdf, 0x3b, 0x10, 0xe4, 0x07, 0x81, 0x88,
+  0x22, 0xff, 0xd3, 0xc4, 0xf4, 0xae, 0xc6, 0x65, 0xed, 0xc5, 0x2d, 0xc6,
+  0x85, 0x4d, 0xd0, 0x23, 0x8e, 0xea, 0x0e, 0xec, 0x25, 0xb6, 0xd2, 0xd5,
+  0x86, 0xa7, 0xfd, 0x6e, 0x19, 0xbf, 0xd7, 0x8c, 0xdf, 0x4f, 0x8c, 0xdf,
+  0x4f, 0x8d, 0xdf, 0xcf, 0x1a, 0x68, 0x0c, 0xe4, 0xaf, 0x9a, 0xb8, 0x5f,
+  0xd1, 0xcd, 0xa7, 0x7a, 0xe3, 0xde, 0xc3, 0x4d, 0xcf, 0xff, 0x0f, 0xdf,
+  0x94, 0x94, 0x4a, 0x77, 0xb2, 0x5d, 0x0b, 0xda, 0x23, 0xec, 0x70, 0x8d,
+  0x2a, 0xd9, 0x26, 0xc9, 0xac, 0xd2, 0x64, 0x3e, 0x13, 0x7a, 0x4d, 0x43,
+  0x24, 0x29, 0xb5, 0x5f, 0x6d, 0x7a, 0x40, 0x66, 0x20, 0xb4, 0x65, 0x45,
+  0x53, 0x6a, 0x4c, 0xa2, 0xa6, 0xd0, 0xd4, 0x9b, 0x5f, 0xd1, 0xde, 0x08,
+  0x04, 0xb0, 0xd9, 0x91, 0xec, 0x8d, 0x68, 0x56, 0x68, 0xd7, 0xe2, 0x12,
+  0x02, 0x27, 0x5a, 0x4d, 0xcd, 0xfc, 0xc0, 0x03, 0xc1, 0x28, 0xe0, 0x35,
+  0x1b, 0x8a, 0x3e, 0xde, 0x2d, 0xd3, 0x2a, 0xa9, 0x80, 0x79, 0x8b, 0x56,
+  0x98, 0x5e, 0xdc, 0x9d, 0xe0, 0xa5, 0x82, 0x48, 0xf9, 0xf1, 0x35, 0x73,
+  0xa8, 0x8c, 0xc7, 0xb5, 0xd3, 0x23, 0x3c, 0x06, 0x82, 0x5f, 0xf8, 0x6d,
+  0x79, 0x1c, 0x9e, 0x6d, 0xfa, 0x8f, 0x6e, 0x44, 0xeb, 0x53, 0xff, 0xf8,
+  0xb4, 0x6e, 0x83, 0xcb, 0xae, 0xd4, 0x3c, 0x50, 0xf6, 0x57, 0xde, 0xa6,
+  0x6c, 0x2c, 0x47, 0xa0, 0xd7, 0xf2, 0x13, 0x1a, 0x92, 0xb7, 0xd2, 0x74,
+  0x1c, 0x41, 0x4f, 0xc2, 0x9a, 0x6f, 0x34, 0x6d, 0x31, 0xb9, 0xe1, 0x79,
+  0x11, 0xec, 0x61, 0x7d, 0x27, 0x53, 0xc0, 0x20, 0x99, 0xdb, 0xbc, 0xe6,
+  0x59, 0x3c, 0x7e, 0x1b, 0x74, 0x2f, 0x6a, 0x6c, 0xd7, 0xc4, 0x3e, 0xb0,
+  0xa9, 0x53, 0xcb, 0x23, 0x5e, 0xb7, 0x76, 0x10, 0xf7, 0x6f, 0x44, 0x7d,
+  0x3a, 0xd1, 0x59, 0xf6, 0xbd, 0x25, 0x63, 0xfa, 0xb8, 0xa9, 0xd2, 0x96,
+  0x1b, 0xc3, 0x19, 0xa9, 0xce, 0xda, 0xb4, 0xd0, 0x1c, 0x39, 0xd9, 0x84,
+  0x5d, 0xce, 0xbb, 0xfa, 0x06, 0xb5, 0x88, 0x28, 0xac, 0x61, 0x93, 0x10,
+  0xd3, 0x1c, 0x0e, 0xba, 0xc0, 0xc0, 0x15, 0x5e, 0x17, 0x19, 0xb9, 0x37,
+  0xcf, 0xac, 0x3a, 0x23, 0xd1, 0x8a, 0x5d, 0xb4, 0xf3, 0xe6, 0x3a, 0x0d,
+  0x57, 0x33, 0xb9, 0xc2, 0x21, 0x37, 0xbb, 0xdc, 0x04, 0xbc, 0x95, 0xd6,
+  0x56, 0x2d, 0xaa, 0xa1, 0x09, 0xa1, 0x65, 0x42, 0x78, 0x3a, 0x2b, 0x84,
+  0x35, 0x13, 0xc2, 0xb3, 0x99, 0x20, 0x48, 0x2a, 0x03, 0x98, 0x23, 0xbb,
+  0xd9, 0xb8, 0xd9, 0x1c, 0x62, 0x48, 0x2b, 0x6e, 0x93, 0x63, 0x66, 0xad,
+  0x37, 0x24, 0x8d, 0xdc, 0xfb, 0xd7, 0x1b, 0xf3, 0x40, 0x90, 0x36, 0x02,
+  0x0b, 0x98, 0x63, 0x57, 0x37, 0x58, 0x55, 0x76, 0xc1, 0x06, 0x2e, 0x7a,
+  0x4c, 0xce, 0x34, 0x68, 0x5b, 0x58, 0x6a, 0xf8, 0xc7, 0xa2, 0xcd, 0x34,
+  0x38, 0xff, 0x88, 0x01, 0x3f, 0x9b, 0x9b, 0x30, 0x65, 0x0e, 0x77, 0xfc,
+  0x22, 0x93, 0x3f, 0xaf, 0x12, 0x81, 0xda, 0x30, 0xa6, 0x05, 0x60, 0x93,
+  0x5d, 0x70, 0xfa, 0xda, 0xf3, 0x45, 0xf2, 0xef, 0xa1, 0x8f, 0x33, 0x3f,
+  0x4b, 0x05, 0xee, 0xcf, 0x62, 0xf2, 0xef, 0x88, 0xc9, 0x67, 0xe0, 0xf6,
+  0x90, 0xe3, 0x06, 0x0d, 0xf1, 0x22, 0xeb, 0xa2, 0xc8, 0x28, 0x40, 0x3b,
+  0xfa, 0x5b, 0x36, 0x1f, 0x37, 0x9c, 0x9d, 0x65, 0xf4, 0x28, 0xed, 0x59,
+  0xa2, 0x09, 0x39, 0x36, 0x73, 0xfd, 0x06, 0xac, 0x1d, 0x33, 0x9d, 0x5c,
+  0x58, 0xd6, 0x06, 0x4b, 0x5b, 0x2c, 0x63, 0x54, 0xbe, 0xb9, 0xca, 0x4d,
+  0x4d, 0xf3, 0x05, 0x4d, 0xae, 0x96, 0xb2, 0x83, 0x8f, 0x76, 0x01, 0x4b,
+  0xa8, 0xfc, 0x84, 0x33, 0x29, 0x1b, 0x85, 0xbc, 0xe4, 0x67, 0xa5, 0x80,
+  0x55, 0xfe, 0xfd, 0xef, 0xb2, 0x5e, 0xba, 0x2a, 0xf3, 0xbb, 0x15, 0x5c,
+  0xbd, 0x15, 0x5b, 0xda, 0x0c, 0x9f, 0xa2, 0xd1, 0x63, 0x07, 0x79, 0x41,
+  0xaf, 0x8b, 0x39, 0x10, 0x7e, 0x0f, 0xa2, 0xa1, 0xbf, 0x5e, 0xb8, 0x83,
+  0x56, 0x67, 0x8d, 0x9c, 0x32, 0x35, 0x55, 0xb0, 0xfd, 0xe2, 0xad, 0x7e,
+  0x5b, 0x6d, 0x01, 0xb9, 0x36, 0xd9, 0x1f, 0x1b, 0x85, 0xf0, 0x1c, 0xbb,
+  0x5d, 0xe3, 0x9c, 0x51, 0x3a, 0x35, 0x2c, 0x04, 0xb9, 0x35, 0x81, 0xdc,
+  0xda, 0x22, 0x90, 0xfb, 0xaa, 0x39, 0x32, 0x2c, 0x04, 0xc1, 0xa7, 0x02,
+  0xc1, 0xa7, 0x8b, 0x40, 0x70, 0xc4, 0xdd, 0x1d, 0x16, 0x82, 0xda, 0x4b,
+  0x81, 0xda, 0xcb, 0x85, 0xa0, 0x96, 0x5d, 0xca, 0xba, 0x08, 0xec, 0x5a,
+  0xab, 0x1c, 0xbb, 0xd6, 0xea, 0x22, 0xb0, 0xb3, 0xdd, 0xa2, 0xbc, 0x08,
+  0x34, 0xd7, 0x04, 0x9a, 0x6b, 0x73, 0xa2, 0x89, 0x66, 0xc2, 0x96, 0x69,
+  0xd2, 0xca, 0xf7, 0x63, 0x40, 0x19, 0x9f, 0x7a, 0x73, 0xe2, 0xde, 0xba,
+  0x8b, 0x99, 0xad, 0xdf, 0x10, 0xb7, 0x10, 0x04, 0x17, 0x3b, 0xbb, 0x8d,
+  0xab, 0x74, 0x16, 0x82, 0xe1, 0x62, 0xa7, 0x37, 0x5e, 0xb2, 0xb4, 0x28,
+  0xb4, 0x1e, 0x2e, 0x02, 0xad, 0x95, 0x15, 0x8e, 0x59, 0x1a, 0x8c, 0x9e,
+  0x17, 0xa0, 0x06, 0xe5, 0x2a, 0xe3, 0xf6, 0xb2, 0x0a, 0x6e, 0x04, 0xb0,
+  0xda, 0x82, 0x92, 0x86, 0xa3, 0x85, 0x10, 0x6d, 0xc1, 0x12, 0xe7, 0x6c,
+  0xd2, 0xef, 0xbf, 0x0f, 0xf1, 0x40, 0x75, 0x21, 0xd8, 0x2d, 0x54, 0xd0,
+  0xac, 0x95, 0x0b, 0x1a, 0xeb, 0x15, 0xad, 0xf3, 0x75, 0x64, 0xed, 0x2e,
+  0xa4, 0x0e, 0xbb, 0x2d, 0x08, 0x5d, 0x1c, 0x60, 0x5d, 0xfc, 0x74, 0xde,
+  0xb9, 0xf8, 0xba, 0x18, 0x2c, 0x17, 0x2b, 0x7a, 0x8a, 0xaf, 0x6a, 0x5e,
+  0x08, 0xc2, 0x8b, 0x90, 0x44, 0x16, 0xed, 0xba, 0x5e, 0x6c, 0x04, 0x9a,
+  0xaa, 0x16, 0x76, 0xdd, 0x5c, 0x5e, 0x66, 0x61, 0x57, 0x8e, 0x66, 0x10,
+  0xf3, 0x35, 0xe7, 0x99, 0x80, 0xdb, 0x52, 0xab, 0x9a, 0x9a, 0x73, 0xf0,
+  0x0b, 0x0c, 0xbc, 0x68, 0x40, 0xb3, 0xb9, 0x48, 0xaa, 0x66, 0xf1, 0x24,
+  0x8d, 0xfa, 0x74, 0x4f, 0x7a, 0x42, 0xf7, 0x32, 0x9e, 0xd1, 0x4d, 0xe5,
+  0x39, 0x7b, 0x6e, 0xb5, 0x23, 0x9b, 0x99, 0x0d, 0xcf, 0xd9, 0x64, 0x45,
+  0x6b, 0x6f, 0xdf, 0x4b, 0x99, 0x6b, 0x8e, 0x39, 0x6d, 0x0b, 0x4e, 0x6e,
+  0x14, 0x77, 0x28, 0xc5, 0x5e, 0x5c, 0x6a, 0xbd, 0xe3, 0x55, 0x74, 0xfb,
+  0xec, 0x54, 0x39, 0xe4, 0xa0, 0x3a, 0x65, 0x63, 0xb9, 0xfa, 0x7d, 0xc7,
+  0xb2, 0xf5, 0xb4, 0xe2, 0x60, 0xca, 0xca, 0x0d, 0xec, 0xe8, 0xf8, 0xba,
+  0x70, 0x24, 0xed, 0x47, 0x7b, 0xb7, 0x1a, 0xca, 0x9c, 0x4b, 0x68, 0x46,
+  0x5f, 0x85, 0xaa, 0x37, 0x45, 0xa5, 0x8c, 0x73, 0xac, 0x5d, 0x6c, 0xe4,
+  0x2b, 0x48, 0x12, 0x9c, 0x73, 0xe6, 0x61, 0x9c, 0x7e, 0x38, 0x23, 0x4f,
+  0xb8, 0x99, 0xd1, 0x5e, 0xd4, 0xac, 0xd9, 0x0e, 0x9e, 0x1b, 0xde, 0x33,
+  0x69, 0xbf, 0x57, 0xad, 0x33, 0xf9, 0x63, 0x7a, 0x03, 0x98, 0x5e, 0x02,
+  0xc1, 0xb0, 0xb3, 0x37, 0x60, 0xe0, 0xad, 0x83, 0x5d, 0xcb, 0xb1, 0x37,
+  0xf7, 0xa1, 0x42, 0xcc, 0xd1, 0x7b, 0x5f, 0xc1, 0x5e, 0x70, 0x6d, 0x08,
+  0x9a, 0x6e, 0xed, 0xf4, 0x22, 0x4d, 0x47, 0xeb, 0x2b, 0x2b, 0x8f, 0x6e,
+  0x14, 0x74, 0x84, 0x13, 0xd0, 0x74, 0x25, 0xe9, 0xbe, 0x7e, 0x74, 0x83,
+  0xf5, 0xa7, 0xbf, 0x0c, 0xe3, 0x2e, 0x6c, 0xf1, 0xc3, 0xcd, 0x47, 0x37,
+  0x78, 0x8c, 0xb6, 0x43, 0xe7, 0x75, 0xb8, 0xef, 0x46, 0x6c, 0x6b, 0xf5,
+  0xe9, 0xa9, 0x7a, 0x16, 0x28, 0x5c, 0xa5, 0x2c, 0xad, 0x23, 0xeb, 0xe1,
+  0x2b, 0x64, 0x63, 0x3f, 0xf0, 0x61, 0x6f, 0xef, 0xc9, 0x9f, 0x2d, 0xdf,
+  0xc1, 0xd7, 0xae, 0xe3, 0x99, 0x52, 0x83, 0xfc, 0x12, 0x40, 0xfd, 0xe7,
+  0x90, 0xa7, 0x8a, 0xfa, 0xe7, 0xd0, 0x2f, 0xad, 0x96, 0x74, 0xe1, 0x4d,
+  0xff, 0x30, 0x1e, 0xe9, 0x86, 0xf5, 0x7c, 0x11, 0xa6, 0x7a, 0xa8, 0x3c,
+  0x36, 0x0b, 0x5d, 0x27, 0xb3, 0xd2, 0x15, 0xb5, 0x8a, 0xf6, 0xde, 0xfe,
+  0xa1, 0x37, 0x08, 0x86, 0xc1, 0x39, 0x99, 0xa1, 0xb2, 0xb1, 0xc6, 0x8b,
+  0xf9, 0x98, 0xc9, 0xda, 0x72, 0x6a, 0x9c, 0x39, 0x90, 0xf6, 0xe3, 0xd4,
+  0x6d, 0x71, 0x7e, 0x4c, 0x16, 0x67, 0xc0, 0x12, 0xb3, 0xd6, 0x61, 0x90,
+  0xc2, 0xf1, 0x11, 0xb3, 0x14, 0x1d, 0x3f, 0x56, 0x0e, 0x99, 0x1f, 0x2a,
+  0xb0, 0x8a, 0x0f, 0x6b, 0x59, 0xd3, 0x97, 0xe1, 0x35, 0x34, 0xa9, 0x54,
+  0x2a, 0x33, 0xf0, 0x6f, 0xe4, 0xf1, 0xde, 0x45, 0xa7, 0xde, 0x52, 0x28,
+  0x64, 0x86, 0x8f, 0x7a, 0x02, 0x02, 0xbc, 0x62, 0x41, 0xc1, 0x35, 0x7f,
+  0x2b, 0xc1, 0xa8, 0x15, 0x2f, 0x20, 0x9b, 0xbd, 0xc7, 0xa3, 0x4b, 0xd4,
+  0x51, 0x61, 0x0e, 0x6e, 0x64, 0x0f, 0x4f, 0x8e, 0xd4, 0x46, 0x8f, 0xc9,
+  0xc9, 0x1d, 0x59, 0x14, 0xfa, 0x91, 0x9d, 0x3d, 0x34, 0xd3, 0x8b, 0x70,
+  0x58, 0x13, 0x01, 0x01, 0x68, 0x3a, 0x34, 0x0c, 0x5e, 0x4a, 0xb8, 0x00,
+  0x19, 0x16, 0xf1, 0xa8, 0x3b, 0xfb, 0xc9, 0x3d, 0x84, 0x99, 0xb9, 0xf1,
+  0x2d, 0xa0, 0x78, 0x9d, 0xb3, 0x86, 0xaa, 0x5d, 0x4d, 0x72, 0x5d, 0xe5,
+  0x5d, 0x50, 0xdb, 0xd7, 0x65, 0x28, 0x67, 0xc1, 0x15, 0xec, 0xd1, 0x0a,
+  0x32, 0xc7, 0x6b, 0x72, 0x8c, 0x06, 0x16, 0x53, 0x7b, 0x07, 0xac, 0x87,
+  0x51, 0x9f, 0xf2, 0x25, 0xe1, 0x96, 0x4c, 0x3a, 0xcc, 0x53, 0xbd, 0xb6,
+  0xda, 0xf0, 0xd6, 0x9e, 0xd6, 0xa7, 0xbf, 0x3c, 0xba, 0x59, 0xca, 0x18,
+  0x13, 0xd8, 0x91, 0xf7, 0xde, 0x61, 0xe3, 0x13, 0x33, 0xbf, 0xe6, 0x3f,
+  0xf5, 0x4b, 0x8a, 0x32, 0x77, 0x43, 0x79, 0xc8, 0x59, 0x54, 0x4c, 0x76,
+  0x0a, 0x29, 0x82, 0x78, 0x26, 0x35, 0x01, 0x3c, 0x61, 0x0b, 0x44, 0x49,
+  0x65, 0x31, 0x2a, 0xb2, 0xf4, 0x4d, 0x89, 0xef, 0x8b, 0x70, 0x9d, 0x52,
+  0x1a, 0x2c, 0xd6, 0xfa, 0xa6, 0xce, 0xaf, 0x53, 0x97, 0xa9, 0x55, 0x5d,
+  0x0c, 0x0a, 0x75, 0xc2, 0xbc, 0xc3, 0x88, 0xc2, 0x8c, 0x5d, 0xb4, 0x58,
+  0x08, 0xea, 0x51, 0x59, 0x4d, 0x0c, 0x5b, 0xe5, 0x42, 0x36, 0x4a, 0x4f,
+  0x5c, 0xa3, 0xc4, 0x55, 0x84, 0x36, 0xc8, 0x06, 0x3c, 0x45, 0x45, 0xfd,
+  0xa3, 0xe6, 0xe7, 0x3c, 0x34, 0xfd, 0x3a, 0x59, 0xf4, 0xc9, 0x17, 0xc4,
+  0xa0, 0x69, 0x85, 0xa1, 0x15, 0x7c, 0x0a, 0x4c, 0xbd, 0xc2, 0xf3, 0x2e,
+  0x89, 0x3b, 0x58, 0x5f, 0x9b, 0x6c, 0x67, 0x90, 0x04, 0x98, 0xf3, 0xd9,
+  0xaa, 0x85, 0x2e, 0x4a, 0xef, 0x99, 0xe5, 0xdb, 0xda, 0x7f, 0x6d, 0x82,
+  0xb0, 0x72, 0xaf, 0x57, 0xcb, 0x25, 0xb1, 0x9d, 0x52, 0x25, 0x1d, 0x9d,
+  0xc5, 0x15, 0x80, 0xef, 0xcc, 0x6f, 0xe1, 0xa9, 0x01, 0xd5, 0x0e, 0xf7,
+  0x77, 0xf6, 0xd7, 0x3d, 0xcc, 0xb8, 0x4f, 0x5e, 0x44, 0xb1, 0x91, 0xa5,
+  0xc0, 0xd6, 0xe7, 0xd6, 0x6d, 0xfb, 0x3c, 0xe3, 0xfc, 0x9d, 0x6b, 0xee,
+  0xce, 0x30, 0x6f, 0x67, 0x98, 0xb3, 0xf6, 0xf9, 0x6a, 0x9b, 0xab, 0xd6,
+  0x79, 0xaa, 0xcd, 0x49, 0x60, 0x46, 0x59, 0x40, 0x63, 0x41, 0x0c, 0xf7,
+  0xc0, 0x55, 0xe5, 0xfd, 0xe1, 0x87, 0x3d, 0x83, 0x05, 0x61, 0x98, 0x8d,
+  0xac, 0x7f, 0xaa, 0x12, 0x91, 0x1d, 0x12, 0x3e, 0xde, 0x7a, 0xdc, 0xf0,
+  0x1e, 0xbf, 0xc1, 0xc7, 0x36, 0x3e, 0x76, 0xf0, 0xf1, 0x16, 0x1f, 0xef,
+  0xf0, 0xf1, 0x3b, 0x3e, 0xde, 0xe3, 0x63, 0x17, 0x1f, 0xff, 0x89, 0x8f,
+  0x3f, 0xf0, 0xb1, 0x87, 0x8f, 0x0f, 0xf8, 0xf8, 0x88, 0x8f, 0x7d, 0x7c,
+  0x1c, 0xe0, 0xe3, 0xbf, 0xf0, 0xf1, 0x09, 0x1f, 0x6d, 0x7c, 0x1c, 0xe2,
+  0xe3, 0x33, 0x3e, 0xfe, 0xc4, 0xc7, 0x17, 0x7c, 0xfc, 0x2f, 0x7c, 0xfc,
+  0x37, 0x3e, 0xfe, 0xf7, 0xe3, 0xec, 0x94, 0xf0, 0x71, 0x80, 0x6f, 0x3a,
+  0xf8, 0xe8, 0xe2, 0xa3, 0x87, 0x8f, 0x10, 0x1f, 0x67, 0xf8, 0x38, 0xc7,
+  0xc7, 0x05, 0x3e, 0x22, 0x7c, 0xfc, 0x85, 0x8f, 0x4b, 0x7c, 0xf4, 0xf1,
+  0x31, 0xc0, 0xc7, 0x10, 0x1f, 0x31, 0x3e, 0x46, 0xf8, 0xf8, 0x17, 0x3e,
+  0xc6, 0xf8, 0x48, 0xf0, 0x91, 0xe2, 0x63, 0x82, 0x8f, 0xaf, 0xf8, 0xb8,
+  0xc2, 0xc7, 0x37, 0x7c, 0x5c, 0xe3, 0xe3, 0x6f, 0x15, 0x93, 0x55, 0x7c,
+  0xd3, 0xc2, 0xc7, 0x1a, 0x3e, 0x9e, 0xe0, 0xe3, 0x29, 0x3e, 0x9e, 0xe1,
+  0xe3, 0x39, 0x3e, 0x5e, 0xe0, 0xe3, 0x25, 0x3e, 0xfe, 0x81, 0x8f, 0x65,
+  0x7c, 0x34, 0xf1, 0x71, 0x82, 0x8f, 0xff, 0x83, 0x8f, 0x1a, 0x3e, 0xea,
+  0xf8, 0x78, 0x88, 0x8f, 0x5f, 0xf1, 0xb1, 0x8e, 0x8f, 0xc6, 0x63, 0x16,
+  0xd4, 0xc8, 0xa2, 0x9c, 0xba, 0x17, 0x18, 0xe3, 0xd4, 0x33, 0x23, 0x9c,
+  0xf8, 0x48, 0x9d, 0xaa, 0x61, 0xf5, 0x25, 0x49, 0x8f, 0x51, 0xad, 0x12,
+  0xda, 0x89, 0x50, 0x58, 0xf0, 0x60, 0x1f, 0x80, 0x4f, 0xb3, 0x0f, 0x32,
+  0x11, 0x29, 0xac, 0xcc, 0x17, 0xe3, 0xfc, 0x07, 0x9e, 0x81, 0x34, 0x61,
+  0xbc, 0x95, 0x7d, 0xb6, 0x24, 0x1e, 0xcd, 0x39, 0x11, 0x50, 0xa3, 0x79,
+  0xb8, 0x69, 0xb0, 0xe9, 0x63, 0xe8, 0xcc, 0x2f, 0xff, 0xf1, 0x2d, 0xd8,
+  0xf8, 0xf6, 0xe2, 0xf9, 0xcb, 0xec, 0xa3, 0xa2, 0x11, 0xca, 0x77, 0x3c,
+  0xb7, 0x31, 0x83, 0x25, 0x90, 0xcf, 0xf2, 0x0e, 0x9c, 0x8a, 0x99, 0xc0,
+  0x22, 0xa5, 0x1e, 0x3f, 0x56, 0xa7, 0x04, 0x47, 0x1b, 0x67, 0x43, 0x42,
+  0x4a, 0xa4, 0x5d, 0x28, 0x43, 0xb1, 0xd7, 0xf8, 0xc7, 0x26, 0x73, 0x7b,
+  0xc8, 0xab, 0x21, 0x0a, 0x48, 0x63, 0xd6, 0x9b, 0xb2, 0x3e, 0x1e, 0xc3,
+  0x8e, 0x03, 0x96, 0x80, 0x88, 0xf6, 0x8c, 0xf0, 0xdf, 0x6f, 0xaa, 0x80,
+  0x15, 0xf1, 0x12, 0xf0, 0x61, 0x69, 0x29, 0x1f, 0x7c, 0x15, 0x96, 0xba,
+  0xc6, 0xa8, 0xe3, 0x68, 0xf8, 0x66, 0x84, 0x7d, 0xb7, 0xf6, 0xe6, 0x54,
+  0x40, 0x23, 0xa6, 0x75, 0x96, 0x81, 0xc1, 0x41, 0x03, 0x30, 0x5c, 0xc2,
+  0xb0, 0x55, 0x0e, 0xbb, 0x5f, 0xa3, 0xe8, 0x5a, 0xd8, 0x37, 0xd6, 0x8a,
+  0x5a, 0x10, 0xf1, 0xd2, 0x0d, 0xaf, 0xb5, 0x5a, 0xaf, 0xd7, 0x73, 0x9b,
+  0x60, 0x5d, 0x60, 0x1b, 0x14, 0xd5, 0x37, 0x3a, 0x2b, 0x9d, 0x68, 0x48,
+  0x63, 0x96, 0x60, 0xc6, 0xc5, 0xdc, 0xba, 0x6d, 0x6a, 0xcd, 0x63, 0x1e,
+  0x89, 0x4c, 0xf0, 0xc4, 0x8f, 0x66, 0x80, 0xfe, 0x0a, 0x6f, 0x26, 0x67,
+  0x67, 0xa0, 0x93, 0xd4, 0x73, 0x75, 0x94, 0xaf, 0x16, 0x2d, 0x45, 0xf9,
+  0xaa, 0x06, 0xc8, 0x82, 0x5e, 0xa2, 0x49, 0x6c, 0x6b, 0x3c, 0x2e, 0x8f,
+  0x4a, 0x6f, 0x30, 0x37, 0x1e, 0x54, 0x67, 0x7e, 0xb5, 0x31, 0x47, 0x81,
+  0x9f, 0x5a, 0x62, 0xc4, 0xb5, 0x6b, 0xab, 0x23, 0x0b, 0xc4, 0xd1, 0x5a,
+  0xce, 0x05, 0x3f, 0x2b, 0xe8, 0x37, 0xbc, 0x1c, 0x3e, 0xba, 0x93, 0xc6,
+  0x74, 0xa3, 0xaa, 0x31, 0xc9, 0x6e, 0x9e, 0xb2, 0x2d, 0x4e, 0x19, 0xeb,
+  0xe0, 0x30, 0x0b, 0xc6, 0x50, 0xe8, 0x2c, 0x0e, 0xc9, 0xb3, 0x4f, 0xca,
+  0x24, 0x41, 0xeb, 0x2b, 0x9a, 0x9a, 0xd7, 0xf3, 0xaf, 0x0c, 0xb7, 0x6f,
+  0x11, 0x68, 0x29, 0x83, 0xf8, 0x36, 0x72, 0x55, 0xd6, 0x2c, 0x50, 0xd6,
+  0x0a, 0xa0, 0x50, 0xb4, 0x5f, 0x1e, 0xcc, 0x13, 0x0b, 0x98, 0x27, 0x05,
+  0x60, 0x30, 0x2c, 0x30, 0x0f, 0xe5, 0x99, 0x05, 0xca, 0x33, 0x07, 0x14,
+  0x19, 0x23, 0x98, 0x07, 0xf3, 0xdc, 0x02, 0xe6, 0xb9, 0x1d, 0xcc, 0xce,
+  0xfe, 0x97, 0x8f, 0xed, 0xed, 0xad, 0xbd, 0xb7, 0x16, 0x30, 0x4f, 0xed,
+  0x55, 0x44, 0xe4, 0x62, 0xae, 0x42, 0xcb, 0x55, 0xe1, 0xf9, 0xcb, 0x6f,
+  0xcf, 0x5e, 0x3c, 0xcf, 0x57, 0x58, 0x6b, 0xad, 0xa3, 0x4e, 0xd2, 0xb9,
+  0xc6, 0x94, 0x6f, 0x5e, 0x2b, 0xf7, 0x79, 0x4d, 0xfd, 0xbc, 0x66, 0x85,
+  0xfd, 0xe6, 0xbf, 0x0f, 0xb6, 0xda, 0x6d, 0x05, 0x74, 0x8f, 0xa5, 0x8c,
+  0xb6, 0x63, 0xb2, 0xfd, 0xb9, 0x7d, 0xb8, 0xff, 0xc1, 0x2f, 0x11, 0x3d,
+  0x6f, 0xc7, 0xe3, 0x78, 0xfc, 0x09, 0x6d, 0x89, 0x86, 0x10, 0x52, 0x34,
+  0x4f, 0xbd, 0xc6, 0xd6, 0xb0, 0xb7, 0x3b, 0x8c, 0x52, 0x94, 0x6c, 0xab,
+  0xab, 0x2a, 0xbf, 0x5b, 0x8b, 0xd9, 0x36, 0x06, 0x8a, 0xfe, 0x68, 0x4a,
+  0x22, 0xbb, 0xc6, 0x4a, 0x96, 0x11, 0x87, 0x8a, 0xea, 0xea, 0x8e, 0xdd,
+  0x96, 0x6c, 0x9b, 0xc6, 0x11, 0xa0, 0xf9, 0x79, 0x97, 0xfb, 0x1e, 0x69,
+  0x3a, 0x2d, 0x46, 0xe9, 0xfc, 0x0e, 0xb3, 0x38, 0x0d, 0xd2, 0x49, 0xa6,
+  0x55, 0x5b, 0xd4, 0x69, 0x06, 0xc2, 0x6c, 0xb2, 0x44, 0x5b, 0x2e, 0x31,
+  0x7e, 0xdb, 0xec, 0xa4, 0x66, 0x19, 0x65, 0x90, 0x2e, 0xa2, 0x5e, 0x88,
+  0x41, 0xae, 0x64, 0x1c, 0x6e, 0xe9, 0xde, 0xe5, 0x53, 0x19, 0x3f, 0xec,
+  0x24, 0x57, 0x6e, 0xc3, 0xeb, 0x2c, 0x28, 0xcd, 0x65, 0x68, 0xff, 0x89,
+  0x12, 0xd5, 0x26, 0x0a, 0xf2, 0x37, 0x0a, 0x70, 0x41, 0xaf, 0x9d, 0x4d,
+  0x86, 0x5d, 0x36, 0x8a, 0xf4, 0x97, 0x0c, 0x8d, 0x1e, 0xb1, 0x3a, 0x0d,
+  0x7a, 0x4d, 0xdf, 0xf9, 0x9b, 0x6c, 0xf5, 0x02, 0x86, 0x96, 0x15, 0x05,
+  0xcd, 0x49, 0x92, 0xc3, 0xa2, 0x1a, 0xa7, 0x31, 0x2a, 0x67, 0x4d, 0x68,
+  0x0e, 0xb0, 0xc4, 0xf5, 0xb0, 0x27, 0xaa, 0xd4, 0xeb, 0x0d, 0x81, 0x11,
+  0xb4, 0x96, 0xc4, 0xfd, 0xaf, 0x61, 0xed, 0xe8, 0x18, 0x97, 0x5e, 0xc4,
+  0x15, 0x33, 0x7a, 0xc3, 0xae, 0x37, 0x43, 0x95, 0x1d, 0x4a, 0xbd, 0x87,
+  0xd7, 0xe6, 0xd6, 0x1d, 0x34, 0x99, 0x0b, 0xf6, 0x3a, 0xb7, 0x3d, 0xa7,
+  0xbc, 0xe0, 0xe8, 0x2e, 0xa5, 0xca, 0x7c, 0xa5, 0xd4, 0xd5, 0x38, 0x42,
+  0xf5, 0x81, 0x8a, 0x35, 0xbc, 0x87, 0xf8, 0x3f, 0xa7, 0x3c, 0x63, 0x05,
+  0x6c, 0xae, 0x26, 0x5e, 0x67, 0x21, 0x29, 0xcc, 0x39, 0x4a, 0xc4, 0x5e,
+  0x62, 0xe8, 0xb1, 0xd5, 0xcc, 0xd8, 0x33, 0x4a, 0xe4, 0xd0, 0xd3, 0x0a,
+  0x54, 0xc0, 0x53, 0x2f, 0x0f, 0x08, 0x6b, 0x2f, 0x34, 0xcc, 0x35, 0xec,
+  0x6a, 0xb9, 0x82, 0x46, 0x5f, 0xb6, 0x4d, 0x33, 0x86, 0xc3, 0x6c, 0x9a,
+  0x2f, 0x55, 0xc5, 0x22, 0xe2, 0xea, 0x4e, 0xbe, 0x28, 0x74, 0x29, 0xf7,
+  0x52, 0xeb, 0x56, 0x0e, 0xd1, 0x9a, 0xb5, 0x82, 0xa1, 0x09, 0x0b, 0xae,
+  0xa1, 0x81, 0xd4, 0x2d, 0xef, 0xec, 0x55, 0x26, 0x1c, 0xa4, 0x66, 0xdb,
+  0x89, 0x7b, 0xd7, 0x4d, 0xda, 0xbe, 0x90, 0x43, 0x1f, 0xb3, 0x0f, 0xd4,
+  0x64, 0xb6, 0xf9, 0x65, 0x9c, 0xbe, 0x7e, 0xbd, 0xe0, 0x48, 0xc5, 0x05,
+  0x29, 0xe8, 0xf5, 0x9c, 0x60, 0x0c, 0xbc, 0x73, 0x2c, 0xa6, 0x0f, 0xa3,
+  0x39, 0x3e, 0x45, 0xaa, 0x39, 0xb3, 0x66, 0xf3, 0xac, 0x5e, 0x9b, 0x19,
+  0x27, 0xf9, 0x9a, 0x35, 0xdb, 0x80, 0x7f, 0xa3, 0x6a, 0xdc, 0x39, 0xbf,
+  0x49, 0x96, 0x15, 0xcf, 0xaf, 0xbb, 0x8e, 0x10, 0x8c, 0xe0, 0xe4, 0x4a,
+  0x4e, 0x9e, 0x55, 0xc8, 0xcf, 0xd3, 0x6b, 0x95, 0x0e, 0x40, 0x6e, 0x97,
+  0xc0, 0x11, 0x36, 0x9a, 0x2c, 0x46, 0xba, 0x82, 0xb7, 0x68, 0xe9, 0x40,
+  0x3b, 0x11, 0x2e, 0x6e, 0x5a, 0x1f, 0x40, 0xbf, 0x29, 0x13, 0x84, 0xd5,
+  0x35, 0x4f, 0x60, 0x5d, 0xca, 0x14, 0xbb, 0x04, 0x1b, 0xfc, 0x65, 0x9d,
+  0xf6, 0x6c, 0x3e, 0xcd, 0x36, 0xc3, 0x15, 0x9b, 0xa7, 0x36, 0xbb, 0x34,
+  0x58, 0x8e, 0xa3, 0x2c, 0xe8, 0x79, 0x0e, 0x62, 0x29, 0xaf, 0x58, 0x07,
+  0xbc, 0x0c, 0x68, 0xc9, 0x58, 0xda, 0xc6, 0x24, 0x0f, 0xa4, 0xe2, 0xa8,
+  0xe8, 0x54, 0xac, 0x38, 0x2a, 0x19, 0xa9, 0xe5, 0xee, 0xa9, 0x9f, 0xb0,
+  0x44, 0x21, 0xeb, 0xde, 0x8d, 0x08, 0x28, 0x26, 0xe1, 0x79, 0x19, 0x5e,
+  0x37, 0x3c, 0x3a, 0xd2, 0x33, 0xc8, 0x2a, 0xc6, 0x4a, 0x54, 0xd4, 0x47,
+  0x50, 0xbe, 0x85, 0xa5, 0xe6, 0x66, 0xba, 0x51, 0x54, 0xf1, 0x08, 0x9a,
+  0xc0, 0x08, 0x26, 0x6a, 0x64, 0x43, 0xc9, 0x29, 0xd0, 0x0d, 0xfa, 0xa2,
+  0x2c, 0x6e, 0x7f, 0xd2, 0x70, 0x50, 0xf3, 0x33, 0xaa, 0x49, 0x0d, 0x04,
+  0x86, 0xeb, 0x3f, 0xdb, 0xfb, 0x1f, 0x9b, 0xec, 0xf4, 0x24, 0x3a, 0xbb,
+  0xae, 0x59, 0x1a, 0xa9, 0xd7, 0xb5, 0x3c, 0x45, 0xc4, 0x60, 0x78, 0xb4,
+  0x54, 0xda, 0x27, 0x02, 0x4d, 0x5b, 0xc7, 0x9a, 0x86, 0xd1, 0x79, 0x11,
+  0x46, 0xb4, 0xc2, 0xfa, 0x37, 0x53, 0x75, 0xf6, 0x72, 0xed, 0xdb, 0x45,
+  0x00, 0x35, 0x8f, 0x0b, 0x1b, 0x24, 0x23, 0xa6, 0x00, 0xa7, 0x8c, 0x78,
+  0x95, 0x37, 0x09, 0x98, 0x7a, 0x50, 0xd2, 0x8f, 0xba, 0xa0, 0x0d, 0x05,
+  0xfd, 0x7e, 0x56, 0x29, 0xb7, 0x1a, 0xab, 0xa1, 0x26, 0x08, 0x3e, 0xea,
+  0x11, 0x60, 0xe9, 0x8a, 0x73, 0x42, 0x87, 0x57, 0xf0, 0x3f, 0xed, 0x94,
+  0x95, 0x46, 0xab, 0x79, 0xb8, 0x2b, 0x41, 0x08, 0x25, 0x67, 0x8f, 0x34,
+  0xad, 0xb1, 0x75, 0x25, 0x93, 0x45, 0x35, 0x87, 0x7d, 0x65, 0x29, 0xcb,
+  0xc7, 0x76, 0x52, 0x94, 0xa0, 0xbe, 0x80, 0xe9, 0xb3, 0xce, 0x9d, 0x9d,
+  0x01, 0xb8, 0xe9, 0xba, 0x1f, 0x36, 0x39, 0x4c, 0x1e, 0x07, 0xf1, 0x20,
+  0x0b, 0x9b, 0xf2, 0x3b, 0xe8, 0xe8, 0x94, 0xe5, 0x22, 0xcc, 0xa2, 0xa1,
+  0x0c, 0xd1, 0x27, 0x1c, 0x07, 0x8a, 0x7d, 0x86, 0xb2, 0x98, 0x3b, 0x1e,
+  0x30, 0xe7, 0xbd, 0xd2, 0x5d, 0x4d, 0xc6, 0x21, 0x14, 0x49, 0xd2, 0xad,
+  0x61, 0x34, 0x20, 0x9f, 0xb5, 0x77, 0xe8, 0x92, 0x6a, 0xdd, 0x71, 0x94,
+  0x9d, 0xca, 0x5b, 0x5b, 0xdd, 0xa8, 0x02, 0xe2, 0x56, 0x27, 0xf4, 0xc5,
+  0x01, 0x86, 0x7a, 0xd8, 0xde, 0xd4, 0xa5, 0x9f, 0xe0, 0x15, 0xef, 0x07,
+  0xf1, 0xd8, 0xdc, 0x33, 0xca, 0x05, 0x51, 0xfc, 0xc1, 0xb7, 0x6a, 0x7c,
+  0xf0, 0x80, 0x77, 0x40, 0xef, 0x87, 0x05, 0x2b, 0xbd, 0xae, 0xf9, 0xcb,
+  0xcb, 0x5f, 0x01, 0x08, 0x5e, 0xb3, 0x08, 0xfa, 0x10, 0xf9, 0x2e, 0x36,
+  0x60, 0x17, 0x37, 0xec, 0xc5, 0x57, 0x4c, 0x9c, 0x32, 0x9c, 0xbd, 0x25,
+  0xcf, 0x1f, 0x7d, 0xf3, 0xd5, 0xa9, 0xa2, 0x6c, 0x9f, 0xdc, 0xce, 0x28,
+  0x40, 0x03, 0x96, 0x03, 0xc5, 0x60, 0x58, 0x42, 0x04, 0xf9, 0x95, 0x33,
+  0xd2, 0x3a, 0x31, 0x49, 0xdd, 0x74, 0x2d, 0x7b, 0x87, 0x5b, 0x2a, 0x91,
+  0x29, 0x90, 0x6d, 0x2a, 0xb1, 0x2d, 0xcd, 0x62, 0xa7, 0x24, 0x4c, 0x90,
+  0xc6, 0xbb, 0xf8, 0x52, 0xe5, 0x11, 0x74, 0xa5, 0xba, 0xa2, 0x50, 0x6b,
+  0xda, 0x94, 0xd5, 0x4e, 0xdf, 0x1f, 0x1e, 0x1e, 0x78, 0x8f, 0x6e, 0x64,
+  0xf1, 0x84, 0x20, 0x4f, 0xbd, 0xe5, 0xfc, 0x4b, 0x1c, 0x0d, 0x79, 0xd6,
+  0xa7, 0x79, 0x55, 0x88, 0x82, 0xda, 0xf9, 0x5e, 0xd0, 0xdb, 0x43, 0x61,
+  0x08, 0xcb, 0x0e, 0x09, 0x0e, 0xbc, 0x18, 0x26, 0xa7, 0x25, 0x62, 0x29,
+  0x72, 0x44, 0x41, 0x8c, 0xb0, 0xe4, 0x27, 0x7a, 0x21, 0x76, 0xaa, 0xec,
+  0x33, 0x2a, 0x2f, 0x6f, 0xbf, 0xc2, 0x98, 0xa1, 0x26, 0x83, 0x6e, 0x83,
+  0x35, 0xca, 0xf6, 0x03, 0x24, 0xab, 0x85, 0xf8, 0xda, 0x60, 0xf0, 0x5e,
+  0xcc, 0x73, 0xbe, 0xd4, 0x78, 0x75, 0xbe, 0xc7, 0xcb, 0x8c, 0x6c, 0x0a,
+  0x68, 0xfc, 0x6f, 0x2b, 0xd9, 0x52, 0x0c, 0x9c, 0x84, 0xa7, 0xdc, 0xa6,
+  0x76, 0xc4, 0x9d, 0x4d, 0xe2, 0x5a, 0x2e, 0xb9, 0x07, 0xec, 0xc5, 0xfc,
+  0x32, 0xa5, 0xa2, 0x01, 0xd7, 0x73, 0xd4, 0x58, 0x0c, 0xc5, 0xa2, 0x00,
+  0x74, 0xe6, 0xb4, 0xd9, 0x6c, 0x0a, 0xea, 0xaa, 0xd6, 0x5b, 0x86, 0xc2,
+  0xec, 0xe6, 0x5b, 0xc5, 0x0e, 0xe8, 0xe0, 0x9f, 0xac, 0xbc, 0xee, 0x7c,
+  0x26, 0xc7, 0xfd, 0x82, 0x88, 0x44, 0x09, 0x04, 0x6b, 0x3e, 0x4f, 0x71,
+  0xb2, 0x7c, 0x08, 0x6b, 0x87, 0xcf, 0x1d, 0x24, 0x82, 0xd1, 0x08, 0x16,
+  0x11, 0x92, 0x36, 0x2b, 0x71, 0x37, 0x0d, 0xd3, 0x65, 0x58, 0x61, 0xc3,
+  0x60, 0x90, 0xf3, 0x99, 0x30, 0xf9, 0xce, 0xe7, 0x84, 0x1d, 0xc6, 0xa9,
+  0x17, 0x7c, 0x0d, 0xa2, 0x3e, 0x3a, 0x88, 0xfa, 0x45, 0x79, 0x04, 0x25,
+  0x52, 0x20, 0x55, 0x3b, 0x32, 0x45, 0x42, 0x8e, 0x04, 0xf8, 0x35, 0xc7,
+  0x10, 0xec, 0x16, 0xa7, 0x37, 0x58, 0x11, 0xbf, 0x03, 0xad, 0xe9, 0x48,
+  0x46, 0xc4, 0xe5, 0xb2, 0x1b, 0x8a, 0x74, 0xe2, 0x22, 0xbd, 0x4f, 0x2d,
+  0xad, 0x68, 0x07, 0xfa, 0xf2, 0x35, 0x80, 0xdb, 0xc2, 0x6c, 0x33, 0x35,
+  0x9f, 0x33, 0xc5, 0x19, 0x74, 0x29, 0xec, 0x35, 0xbc, 0x51, 0x3f, 0x44,
+  0x13, 0x1d, 0x5a, 0xc8, 0x82, 0x73, 0x0c, 0x4a, 0xaa, 0x5b, 0x5c, 0x02,
+  0xec, 0x3d, 0x31, 0x9a, 0x98, 0x83, 0xb1, 0x4e, 0x6d, 0xa7, 0x9f, 0x63,
+  0xe6, 0x76, 0xb5, 0x75, 0x06, 0x82, 0x59, 0x5c, 0x48, 0xe6, 0xf2, 0x43,
+  0x08, 0x5c, 0x7e, 0x08, 0x59, 0xbf, 0xb9, 0x17, 0x17, 0x4a, 0x40, 0x05,
+  0xd3, 0x7f, 0x0e, 0x0f, 0x18, 0x01, 0xae, 0x82, 0x08, 0x04, 0xf5, 0x30,
+  0x8d, 0xfa, 0x64, 0x17, 0x83, 0xd6, 0xb9, 0x3b, 0x62, 0x82, 0xd7, 0x8d,
+  0x61, 0x0a, 0xe2, 0xa8, 0x7b, 0xe9, 0xed, 0xff, 0x61, 0x04, 0x11, 0xbb,
+  0x8d, 0x66, 0x5c, 0x2e, 0x8b, 0xeb, 0x84, 0x60, 0x22, 0x23, 0xba, 0x5a,
+  0xf6, 0x0e, 0x03, 0x94, 0x8b, 0xee, 0x0a, 0x4d, 0xa4, 0xe8, 0x70, 0x0a,
+  0xac, 0x1b, 0x35, 0x45, 0x96, 0x37, 0x35, 0x57, 0x39, 0xd5, 0x41, 0x0a,
+  0xeb, 0x33, 0x99, 0x92, 0xcf, 0x60, 0xca, 0x85, 0x4c, 0x56, 0x38, 0x1a,
+  0xd2, 0x85, 0x6c, 0x56, 0x91, 0x42, 0xaa, 0x4e, 0xd6, 0xaa, 0x31, 0xd8,
+  0x22, 0xb3, 0xb8, 0xb9, 0x95, 0xcc, 0x86, 0x66, 0x97, 0xc1, 0xf6, 0x38,
+  0x70, 0x14, 0xb3, 0x95, 0xc9, 0xac, 0xb6, 0x9b, 0x53, 0xe5, 0x64, 0xd3,
+  0xfa, 0x71, 0xfb, 0x62, 0xe0, 0x14, 0x8d, 0xde, 0xbc, 0xa0, 0xb5, 0xf4,
+  0x11, 0x2b, 0x2b, 0x1e, 0x2a, 0xe8, 0x6f, 0x80, 0x80, 0x01, 0xa8, 0x94,
+  0xc3, 0x1e, 0xac, 0x57, 0x98, 0xc9, 0xd2, 0x33, 0xa4, 0x6f, 0x83, 0x2e,
+  0xc6, 0xe3, 0x37, 0xed, 0x75, 0x99, 0xe7, 0x69, 0x30, 0xec, 0x79, 0x24,
+  0x03, 0xc3, 0xc4, 0x03, 0x06, 0x0f, 0xe0, 0x8d, 0x77, 0x75, 0x11, 0xf7,
+  0x43, 0xb9, 0x10, 0x67, 0x5c, 0x70, 0xb4, 0x7a, 0x4c, 0x3a, 0xec, 0xea,
+  0xb7, 0xa7, 0x2f, 0xbc, 0x5f, 0x7e, 0x91, 0xe8, 0x28, 0x25, 0x5a, 0xb2,
+  0xc4, 0x9a, 0xa3, 0xc4, 0x9a, 0x28, 0xf1, 0xec, 0x89, 0xa3, 0xc4, 0x93,
+  0x0c, 0x46, 0xfe, 0xc0, 0x14, 0x6f, 0x39, 0xe6, 0x81, 0x9d, 0xb4, 0xe2,
+  0xf2, 0x9f, 0xea, 0xb4, 0x11, 0x45, 0x9a, 0xd0, 0xaf, 0x70, 0x08, 0x5b,
+  0x6c, 0xba, 0xd1, 0xad, 0x41, 0xe5, 0x49, 0x82, 0x1e, 0x65, 0x8d, 0x1d,
+  0x37, 0x60, 0x42, 0xf0, 0x04, 0x7c, 0xce, 0xa5, 0x00, 0xe8, 0x0d, 0xac,
+  0x99, 0xd1, 0xd1, 0x6d, 0xef, 0x30, 0x72, 0xb6, 0x55, 0x5f, 0x2e, 0xb3,
+  0x25, 0xd3, 0xa7, 0x41, 0xe3, 0x8b, 0x35, 0x94, 0xd2, 0x59, 0x65, 0x40,
+  0x61, 0x04, 0x80, 0xec, 0xc1, 0x7e, 0xfb, 0xd0, 0xc8, 0xf2, 0x87, 0x06,
+  0x93, 0x75, 0xd9, 0xfb, 0x86, 0x93, 0x11, 0xf9, 0x4a, 0xcb, 0x4e, 0x48,
+  0x9b, 0x7f, 0x25, 0xf1, 0x50, 0x3d, 0x13, 0x55, 0xcf, 0x45, 0x89, 0x2f,
+  0x7a, 0xa5, 0xea, 0xf7, 0x6c, 0xbd, 0xb6, 0x66, 0x17, 0x10, 0x2d, 0xd9,
+  0xb2, 0x0b, 0xe7, 0xa4, 0x7c, 0xad, 0x30, 0x53, 0x80, 0x23, 0x6e, 0x59,
+  0x93, 0x4f, 0x6e, 0x08, 0xd3, 0xdc, 0x66, 0x56, 0xd5, 0x16, 0x61, 0xa6,
+  0xd1, 0x15, 0x48, 0x7c, 0xca, 0x26, 0x0d, 0x6f, 0x00, 0xfa, 0x05, 0x31,
+  0xaf, 0xd7, 0xb9, 0xa6, 0xff, 0x15, 0x91, 0xc8, 0x94, 0x0f, 0x3a, 0xba,
+  0x40, 0xbf, 0x62, 0xc9, 0x74, 0x6c, 0xdf, 0x5a, 0x7b, 0xda, 0xf0, 0x9e,
+  0x2b, 0x9b, 0x48, 0xa5, 0x34, 0x4e, 0xb4, 0x87, 0x34, 0x05, 0x5e, 0x74,
+  0x70, 0x93, 0xad, 0x7e, 0x6a, 0x89, 0x4f, 0x6b, 0xda, 0xec, 0x70, 0x76,
+  0xcf, 0xe5, 0x3a, 0xdb, 0x59, 0xd5, 0x70, 0x82, 0x26, 0x1b, 0x5e, 0xa7,
+  0xa5, 0xbf, 0x6b, 0xe1, 0xbb, 0x35, 0xfd, 0xdd, 0x1a, 0xbe, 0x7b, 0xa2,
+  0xbf, 0x7b, 0x72, 0xbc, 0x91, 0xeb, 0x36, 0x4f, 0x53, 0x5d, 0x83, 0x76,
+  0x7e, 0xfb, 0x0d, 0x5d, 0x3d, 0x61, 0xd7, 0x51, 0x83, 0x06, 0xe0, 0x47,
+  0xeb, 0x39, 0xfb, 0xb1, 0x86, 0x3f, 0x5e, 0xe2, 0xdf, 0x9d, 0x27, 0x16,
+  0x00, 0x64, 0xe9, 0x00, 0x10, 0x6c, 0xd7, 0x8f, 0x02, 0xad, 0x66, 0xa3,
+  0xa1, 0xd2, 0xdc, 0x92, 0xf7, 0x54, 0x3d, 0xdd, 0x67, 0xee, 0x35, 0xc4,
+  0xbe, 0xb6, 0xfc, 0xbe, 0x5d, 0xb5, 0xac, 0x48, 0xba, 0x9b, 0xc7, 0xc3,
+  0x66, 0x24, 0x51, 0x31, 0xac, 0x9b, 0x4b, 0x26, 0xee, 0x6a, 0x58, 0xa5,
+  0xe6, 0x65, 0x78, 0x9d, 0xd4, 0x54, 0x30, 0xbc, 0x30, 0x9e, 0xb2, 0xb0,
+  0x54, 0xe1, 0x3a, 0xf6, 0xd9, 0xd7, 0x34, 0x4e, 0x69, 0x3b, 0x4d, 0x00,
+  0xb5, 0xfc, 0x32, 0xf8, 0x15, 0xef, 0xb0, 0xc8, 0x42, 0x14, 0x78, 0xd3,
+  0x78, 0xd2, 0x24, 0x6b, 0x50, 0xdf, 0xf1, 0x4f, 0xe9, 0x3f, 0x6c, 0xcb,
+  0x76, 0xc4, 0x10, 0xe6, 0x7a, 0x71, 0x62, 0x63, 0x52, 0xc0, 0xb2, 0x41,
+  0xa8, 0x2e, 0x69, 0xe4, 0x38, 0x12, 0xa0, 0xd5, 0x6c, 0xc8, 0x0b, 0x96,
+  0xd0, 0x02, 0xad, 0xea, 0x32, 0x5a, 0x20, 0xc5, 0xdd, 0x8c, 0x6b, 0xad,
+  0x7a, 0xde, 0x34, 0x25, 0xa4, 0x6c, 0x32, 0x8a, 0xce, 0xce, 0x92, 0x15,
+  0x76, 0x2f, 0xe8, 0x82, 0xe4, 0x6c, 0xf1, 0x26, 0x66, 0x5e, 0xc1, 0xf9,
+  0xe8, 0x06, 0x87, 0x7d, 0xba, 0xf2, 0xe8, 0x86, 0x98, 0x23, 0xe7, 0xb4,
+  0x8a, 0x5f, 0xd5, 0x28, 0x1c, 0xfc, 0xc7, 0x73, 0x79, 0xdb, 0x87, 0xce,
+  0xea, 0xed, 0x91, 0xed, 0x84, 0x73, 0xda, 0x06, 0xff, 0x9f, 0x1d, 0x73,
+  0xf2, 0x33, 0xce, 0x59, 0x54, 0xfd, 0xd9, 0xd7, 0x87, 0x02, 0xe1, 0x6f,
+  0xa8, 0xbd, 0xd9, 0x06, 0x89, 0x84, 0x0e, 0xed, 0x91, 0x86, 0xcc, 0xe9,
+  0x84, 0xb8, 0xab, 0x99, 0x7e, 0x4b, 0x7d, 0xdd, 0x3f, 0x12, 0x30, 0xfc,
+  0x0a, 0xea, 0xa5, 0x77, 0x1d, 0x4f, 0x40, 0xa0, 0x63, 0x4d, 0x50, 0x6f,
+  0x63, 0xd0, 0x7f, 0x08, 0xca, 0xe7, 0x4f, 0x7b, 0xb0, 0x2e, 0x79, 0xc9,
+  0x28, 0xec, 0xe2, 0xa1, 0xee, 0x64, 0x8c, 0x51, 0x5c, 0x01, 0x4e, 0xdb,
+  0x08, 0xa7, 0x0a, 0x16, 0x1c, 0x7a, 0x31, 0x93, 0x0d, 0xd1, 0x90, 0x34,
+  0xab, 0x0e, 0xec, 0x10, 0x81, 0x38, 0x8f, 0x13, 0x60, 0x9f, 0x41, 0x2c,
+  0x0e, 0x95, 0xb9, 0xb8, 0x05, 0x98, 0x9f, 0xc7, 0x38, 0xa3, 0x01, 0x70,
+  0x93, 0x1d, 0x6e, 0xb3, 0xf1, 0x80, 0xdf, 0x6c, 0xcf, 0x27, 0x95, 0xb9,
+  0x6d, 0xfa, 0x0a, 0x88, 0x50, 0xe4, 0x0a, 0xb7, 0x21, 0x2a, 0xb0, 0x58,
+  0x40, 0x4b, 0x66, 0x18, 0x62, 0xd0, 0xb8, 0x59, 0x88, 0xf6, 0x3a, 0x12,
+  0x54, 0x3b, 0x64, 0xc5, 0x01, 0xa7, 0x8b, 0x71, 0x78, 0x86, 0x68, 0x53,
+  0x07, 0xf0, 0x0f, 0x44, 0x59, 0x74, 0x95, 0x49, 0x16, 0x28, 0xd8, 0xa4,
+  0x62, 0x9b, 0x02, 0xdf, 0x8d, 0xec, 0x83, 0xa0, 0x31, 0xce, 0x6b, 0x20,
+  0xac, 0x6c, 0x62, 0x8b, 0xe6, 0x30, 0x43, 0x8a, 0x43, 0xc5, 0x19, 0xf2,
+  0x20, 0x7f, 0x98, 0xc3, 0x66, 0xfb, 0xf6, 0x45, 0xd4, 0xef, 0xb1, 0xb0,
+  0x1d, 0x09, 0x63, 0x27, 0x4a, 0x46, 0xa8, 0x1e, 0xf3, 0x5d, 0x14, 0x19,
+  0x45, 0xbc, 0x98, 0x51, 0x15, 0x4b, 0x8a, 0x72, 0x87, 0x17, 0x51, 0x82,
+  0x77, 0x3f, 0xc3, 0xbe, 0x0b, 0x9d, 0x15, 0x71, 0x4f, 0x9a, 0x30, 0xec,
+  0xa8, 0x22, 0xb0, 0x61, 0x2f, 0x06, 0xf9, 0x8b, 0x7b, 0x72, 0xbc, 0x35,
+  0x4f, 0x82, 0x00, 0xf2, 0x90, 0xac, 0x83, 0xbe, 0xc5, 0xdf, 0x94, 0x2e,
+  0xf1, 0x66, 0xc9, 0x36, 0x53, 0x43, 0xe9, 0xf3, 0x21, 0x9e, 0x24, 0x21,
+  0xfb, 0xe9, 0x13, 0x48, 0x4d, 0x32, 0x74, 0x26, 0x1d, 0x50, 0xc5, 0x93,
+  0x75, 0x3a, 0x9c, 0x51, 0x12, 0x0b, 0x53, 0x5a, 0x55, 0x96, 0x7d, 0x56,
+  0xff, 0x82, 0xd6, 0xb8, 0x75, 0xbe, 0xd3, 0xe3, 0x79, 0x4c, 0xeb, 0x59,
+  0xaf, 0x3f, 0x91, 0xae, 0xcf, 0x28, 0x47, 0xfa, 0xba, 0x83, 0x6e, 0x6c,
+  0x4f, 0xa0, 0xd1, 0x8d, 0x1b, 0x77, 0xbe, 0xec, 0xbe, 0xdb, 0xb5, 0x86,
+  0xec, 0x68, 0xae, 0x1b, 0xc5, 0xfe, 0x75, 0x58, 0x74, 0x85, 0xd9, 0xc7,
+  0xca, 0xcd, 0x33, 0x0e, 0xa5, 0x91, 0x7f, 0xe6, 0x69, 0x6f, 0x01, 0x92,
+  0x5b, 0x1e, 0xd0, 0xe6, 0x79, 0xd3, 0xcb, 0x8a, 0xba, 0xc3, 0x06, 0xa1,
+  0x48, 0x93, 0x32, 0xf3, 0x6c, 0x32, 0x4b, 0x4d, 0x51, 0x3e, 0x37, 0xb4,
+  0x73, 0x2b, 0xd9, 0x7a, 0x2b, 0xe7, 0xc0, 0x29, 0x00, 0x61, 0x39, 0x7b,
+  0xcc, 0x5f, 0x42, 0x55, 0x0a, 0x4e, 0xe6, 0x08, 0x76, 0x1e, 0x24, 0x54,
+  0xc2, 0x2a, 0x03, 0x63, 0x3f, 0xc6, 0xbd, 0x1d, 0x66, 0x98, 0xa0, 0x98,
+  0x5b, 0x86, 0x99, 0x0b, 0xb9, 0xdf, 0x3e, 0xdc, 0xf2, 0xfe, 0xed, 0xb5,
+  0x81, 0xa5, 0xbd, 0x8f, 0xec, 0xea, 0x49, 0xbf, 0x62, 0xe8, 0x69, 0x01,
+  0x25, 0xe7, 0xea, 0xb9, 0x65, 0x3c, 0xe6, 0xef, 0xf8, 0xdc, 0x5c, 0x62,
+  0x1b, 0x8f, 0x39, 0xd9, 0x24, 0x37, 0x18, 0xa7, 0x5a, 0x74, 0x1f, 0x4d,
+  0x07, 0x4c, 0x8a, 0x3c, 0x3d, 0x2d, 0x8c, 0x4b, 0x51, 0xf2, 0x68, 0x5b,
+  0xfd, 0x4e, 0x10, 0x44, 0xee, 0x6c, 0x43, 0xcd, 0x82, 0xdd, 0x54, 0xce,
+  0x28, 0x79, 0x1a, 0x3f, 0x9e, 0x40, 0xdb, 0x5a, 0x4d, 0xcb, 0xae, 0xad,
+  0xd6, 0x25, 0x2b, 0xbe, 0xa8, 0xca, 0x55, 0x58, 0xf7, 0xa9, 0x75, 0x1e,
+  0x94, 0x85, 0xb0, 0xca, 0x25, 0xb5, 0xcb, 0xcb, 0x21, 0xda, 0x61, 0xfd,
+  0x0a, 0x5b, 0x9d, 0x12, 0x8d, 0x34, 0xa7, 0x8d, 0xa2, 0x53, 0x03, 0x52,
+  0xc9, 0xf5, 0x1d, 0xbd, 0x9b, 0x44, 0xbf, 0x34, 0x73, 0xb7, 0xcf, 0x84,
+  0xa9, 0xb8, 0x82, 0x59, 0x5d, 0x3a, 0x5c, 0x0a, 0xa5, 0x4d, 0x99, 0x9c,
+  0x96, 0xd9, 0x2a, 0x4f, 0x95, 0xfb, 0x2d, 0xae, 0x30, 0x32, 0x9a, 0xeb,
+  0x49, 0x64, 0xcd, 0xb9, 0x52, 0x42, 0xa5, 0x71, 0x41, 0x7e, 0x74, 0x43,
+  0x4c, 0xd3, 0xf4, 0x54, 0x43, 0x66, 0x12, 0x83, 0x6a, 0xc4, 0xd8, 0x93,
+  0xdb, 0x2f, 0x47, 0x74, 0x57, 0xfd, 0xfe, 0x1f, 0xa7, 0xb7, 0xb5, 0x5f,
+  0x72, 0xc5, 0xc1, 0xe7, 0x91, 0xa9, 0x80, 0xac, 0x30, 0x4f, 0xd3, 0x91,
+  0xf2, 0x8a, 0x3f, 0x97, 0x61, 0x93, 0x18, 0x94, 0xdf, 0x2a, 0x50, 0x78,
+  0x60, 0x51, 0x34, 0xc1, 0x6d, 0x96, 0xc6, 0x7c, 0x6d, 0x99, 0x4b, 0x5e,
+  0x97, 0x8c, 0xfe, 0x86, 0x35, 0x99, 0xb7, 0x7a, 0xd5, 0x81, 0xca, 0xdd,
+  0xda, 0xf2, 0x8a, 0x27, 0xd3, 0xaf, 0xab, 0x47, 0x3a, 0x3a, 0xc0, 0xe7,
+  0x12, 0xaf, 0x1a, 0x3e, 0x90, 0x2a, 0x8d, 0x1a, 0xde, 0x13, 0xbb, 0x13,
+  0xa4, 0x7d, 0xa2, 0x94, 0x63, 0x6b, 0xae, 0xf5, 0x6c, 0x77, 0x03, 0x7a,
+  0x75, 0xf8, 0x2d, 0xb5, 0xa8, 0x02, 0x8a, 0x27, 0xa3, 0x75, 0xc6, 0x1b,
+  0xfd, 0x32, 0x82, 0xae, 0xb3, 0xbd, 0x08, 0x00, 0xe1, 0xa2, 0x43, 0xeb,
+  0xf5, 0x6b, 0xfe, 0x2d, 0x67, 0xe6, 0x69, 0x26, 0xb0, 0x41, 0x04, 0xe5,
+  0xed, 0x9f, 0x43, 0x4b, 0x36, 0x4f, 0xb6, 0x2b, 0xc6, 0xf4, 0x65, 0x84,
+  0x18, 0xfe, 0x21, 0xca, 0x37, 0xfc, 0xba, 0xab, 0x3c, 0x5e, 0x7f, 0x43,
+  0x18, 0x34, 0xbc, 0x70, 0x48, 0x77, 0xe2, 0xe0, 0xb9, 0x08, 0x4e, 0xaa,
+  0xe3, 0xe2, 0x1b, 0xb1, 0x6e, 0x3c, 0x67, 0x4d, 0xd3, 0xd5, 0xde, 0x98,
+  0x11, 0xeb, 0xde, 0xd1, 0xb1, 0xeb, 0x54, 0x05, 0xab, 0x27, 0xf6, 0x60,
+  0x21, 0xfa, 0x64, 0x5c, 0xbd, 0x95, 0x44, 0x36, 0x03, 0x9e, 0x88, 0x2e,
+  0x7a, 0x74, 0x03, 0xa5, 0xa6, 0xbf, 0xa5, 0x63, 0x16, 0x33, 0x94, 0xb0,
+  0x40, 0x13, 0xfc, 0x9f, 0x2d, 0x35, 0xca, 0x8d, 0x87, 0xbf, 0xa5, 0xbd,
+  0xdc, 0xd5, 0x90, 0x1e, 0x1d, 0xfd, 0x6e, 0xfa, 0xf1, 0x28, 0xe8, 0x46,
+  0xe9, 0xf5, 0xfa, 0xa3, 0x1b, 0x19, 0x1e, 0xc2, 0x60, 0xc8, 0xfe, 0x63,
+  0x76, 0x9e, 0x15, 0x74, 0xcc, 0x05, 0x90, 0xc8, 0x64, 0xbf, 0xad, 0xa4,
+  0x3d, 0x0d, 0xf6, 0x2b, 0xb5, 0xd9, 0xdc, 0xd7, 0xfc, 0xa5, 0x94, 0xbc,
+  0xb8, 0xa4, 0x2b, 0xba, 0x2b, 0x90, 0xb7, 0x82, 0xb7, 0xce, 0xfe, 0x38,
+  0xa1, 0xb4, 0xd8, 0x1a, 0x28, 0xf8, 0x7b, 0xfc, 0xea, 0x54, 0x33, 0xf5,
+  0x67, 0x3e, 0x16, 0x39, 0x42, 0x5f, 0xa4, 0x83, 0x7e, 0xe1, 0xbe, 0xb6,
+  0x44, 0xbd, 0xb3, 0x59, 0xee, 0xc9, 0xd0, 0x07, 0x70, 0x2d, 0xcb, 0xe1,
+  0x2c, 0xc2, 0x08, 0x41, 0x6c, 0x54, 0xa8, 0x59, 0xc5, 0xcd, 0xd0, 0x5e,
+  0x9b, 0x6b, 0x10, 0x95, 0x7c, 0xfe, 0x1c, 0x4a, 0x08, 0x73, 0xeb, 0x12,
+  0x02, 0xdb, 0x3c, 0xe8, 0xd6, 0x9a, 0xcc, 0x48, 0x9f, 0x57, 0x44, 0xa0,
+  0x32, 0xd5, 0x6d, 0xc2, 0x0a, 0x77, 0x1e, 0xa6, 0x7a, 0xae, 0x4c, 0x5b,
+  0xa4, 0x7e, 0x92, 0x85, 0xe9, 0x57, 0x57, 0x31, 0x54, 0x95, 0xd2, 0xad,
+  0x65, 0x38, 0xa8, 0x5c, 0x46, 0x24, 0x37, 0x79, 0x0b, 0xc6, 0xc7, 0xa0,
+  0x65, 0xba, 0x75, 0x60, 0x71, 0x8d, 0x9e, 0x69, 0xcb, 0xb4, 0x48, 0xfd,
+  0xc8, 0xef, 0x4d, 0x06, 0x03, 0xa9, 0xd7, 0x7e, 0x5f, 0xf5, 0xc7, 0x67,
+  0x2e, 0x9d, 0x68, 0x1d, 0x06, 0xfd, 0x66, 0xeb, 0x80, 0xdc, 0x96, 0xa4,
+  0x7e, 0xa3, 0xa8, 0x3e, 0x99, 0x0e, 0xe2, 0x11, 0x1b, 0xa2, 0x7a, 0xb4,
+  0x98, 0xc3, 0x5a, 0x43, 0xd9, 0x69, 0xfd, 0x63, 0xad, 0xd9, 0x7a, 0xfe,
+  0xb2, 0xf9, 0xb4, 0xd9, 0xba, 0xad, 0x9a, 0x43, 0xbe, 0x1a, 0xe2, 0x36,
+  0x5b, 0xc4, 0xce, 0xb6, 0xad, 0xe7, 0xbd, 0xd9, 0xa6, 0x02, 0xe8, 0x5d,
+  0xca, 0x7e, 0xe7, 0xec, 0xbb, 0x5a, 0xe9, 0x3f, 0x58, 0x92, 0x0c, 0xce,
+  0x22, 0xf9, 0x09, 0xc3, 0xbf, 0x2c, 0x5f, 0x86, 0xd7, 0xba, 0xfd, 0x9b,
+  0x4d, 0x38, 0x5d, 0xe9, 0xcf, 0xdd, 0x03, 0x76, 0x54, 0xf4, 0x11, 0x39,
+  0x96, 0x2f, 0x64, 0x32, 0x17, 0x2a, 0x9b, 0xc5, 0xe6, 0x5d, 0x88, 0x2c,
+  0xcf, 0x96, 0xb8, 0x99, 0x4b, 0x0f, 0xe9, 0xe1, 0x6f, 0x79, 0xd5, 0xa3,
+  0xac, 0x15, 0xf3, 0x2a, 0x3e, 0x23, 0x35, 0x56, 0x06, 0x93, 0xee, 0xd5,
+  0xca, 0x03, 0x25, 0xdf, 0x80, 0x59, 0xa0, 0xaa, 0x79, 0x7c, 0x58, 0x79,
+  0x32, 0x18, 0xe1, 0xe5, 0x6c, 0x85, 0xc3, 0x81, 0x31, 0xfa, 0x59, 0xe2,
+  0x1e, 0x56, 0xea, 0xc8, 0x47, 0x19, 0xc3, 0xde, 0xc9, 0x3b, 0x20, 0x38,
+  0x6c, 0x3e, 0xbe, 0xea, 0x70, 0x4b, 0xe0, 0xbc, 0x20, 0xb3, 0x77, 0x6d,
+  0xa8, 0x97, 0xb3, 0xe9, 0x10, 0xcd, 0x74, 0x41, 0x58, 0x81, 0xb4, 0x42,
+  0xcd, 0x31, 0x4b, 0xe9, 0xc5, 0xe7, 0xd1, 0xfc, 0x7d, 0xe0, 0x8c, 0x8c,
+  0x01, 0x41, 0x4a, 0xb4, 0x09, 0xfe, 0xfc, 0x10, 0x0e, 0x27, 0x6c, 0xa5,
+  0xb4, 0x87, 0x43, 0x0c, 0xb4, 0xef, 0x66, 0xaa, 0x69, 0x87, 0x1f, 0x3e,
+  0x73, 0x18, 0xc6, 0xaa, 0x7e, 0x5d, 0xff, 0xb4, 0xd5, 0xef, 0xd7, 0xf8,
+  0xdd, 0x77, 0x7e, 0x5d, 0x23, 0x2e, 0xf7, 0xda, 0xaf, 0xde, 0x0a, 0x81,
+  0xe2, 0xb5, 0x4c, 0x58, 0xe4, 0x09, 0xe8, 0x8e, 0x13, 0x60, 0xf8, 0xb1,
+  0x52, 0x62, 0x6e, 0x29, 0x1d, 0xb5, 0x26, 0x36, 0xe6, 0x3e, 0xa1, 0x79,
+  0x97, 0x31, 0x61, 0x8f, 0xb4, 0x1f, 0xe4, 0x70, 0x04, 0x8b, 0x12, 0x1e,
+  0xcb, 0x3e, 0x6c, 0x28, 0xc9, 0x25, 0x18, 0x31, 0x32, 0x4c, 0xf8, 0x1b,
+  0x6a, 0x83, 0xff, 0x5d, 0xb0, 0xbe, 0x59, 0x1c, 0xf7, 0x75, 0x99, 0x67,
+  0x84, 0x34, 0x73, 0x88, 0x47, 0x2c, 0xc4, 0x1b, 0x74, 0x38, 0xf6, 0x9b,
+  0x02, 0x9b, 0xf5, 0x8a, 0x15, 0x34, 0x17, 0x3b, 0x25, 0x53, 0x4e, 0xc6,
+  0xb4, 0xc0, 0x75, 0xb7, 0xbe, 0x31, 0xab, 0x0b, 0x2e, 0x11, 0x8b, 0xc6,
+  0x51, 0x7a, 0x88, 0x62, 0x0a, 0x9b, 0x96, 0x14, 0xe2, 0xea, 0xac, 0x42,
+  0x7e, 0x47, 0x87, 0x8c, 0x02, 0x76, 0x0f, 0x24, 0x13, 0x66, 0x03, 0x09,
+  0x73, 0x70, 0xbc, 0x2e, 0x05, 0x93, 0x72, 0x0d, 0x18, 0x95, 0x5d, 0x17,
+  0x72, 0xb0, 0xa1, 0xa6, 0x06, 0x41, 0x77, 0xec, 0x86, 0xea, 0x0c, 0xc2,
+  0x8f, 0x1b, 0x66, 0x9c, 0x49, 0xc4, 0xe3, 0x47, 0x32, 0xcc, 0xff, 0x58,
+  0x92, 0xa8, 0x53, 0xc0, 0xa9, 0xb9, 0x9b, 0x44, 0xb1, 0x2a, 0x57, 0x52,
+  0x9c, 0x4c, 0xc8, 0xb8, 0x38, 0x77, 0x6a, 0x98, 0x5d, 0x79, 0xe2, 0xac,
+  0xc9, 0x8b, 0x38, 0xeb, 0xa2, 0x5b, 0x5f, 0x85, 0xfa, 0x94, 0xdf, 0x20,
+  0x0f, 0x24, 0x10, 0xd3, 0x87, 0x8f, 0xcc, 0x91, 0x02, 0xf5, 0xd8, 0xb8,
+  0xaa, 0x39, 0xeb, 0x27, 0x6a, 0x59, 0x3c, 0x23, 0x82, 0xa9, 0xcb, 0xcf,
+  0x3c, 0x8f, 0xf5, 0xe1, 0x96, 0x37, 0xbf, 0x54, 0xb9, 0xa9, 0xd8, 0x82,
+  0xd5, 0x38, 0x1c, 0x85, 0x41, 0xea, 0xdb, 0x6f, 0x92, 0x46, 0x97, 0x79,
+  0x74, 0x61, 0xb0, 0xf8, 0x69, 0x55, 0xc3, 0x62, 0xa3, 0x52, 0x57, 0x1f,
+  0xd6, 0x7c, 0x58, 0x27, 0xe2, 0x49, 0xf7, 0x82, 0xcc, 0x53, 0x3e, 0x1e,
+  0x94, 0x31, 0x4d, 0xaa, 0x8e, 0xdb, 0xb5, 0x01, 0xae, 0x3a, 0x78, 0xac,
+  0xc4, 0x83, 0x38, 0x64, 0x39, 0x37, 0x6d, 0x04, 0xe2, 0xb6, 0xd4, 0x2b,
+  0xfa, 0x0a, 0xc5, 0x70, 0xb2, 0x2e, 0xb2, 0x79, 0xd4, 0x8b, 0x57, 0x4e,
+  0xde, 0xa6, 0x58, 0x3c, 0x8b, 0x12, 0xba, 0xcc, 0x43, 0x89, 0xc9, 0x28,
+  0xa3, 0x03, 0xe8, 0xd9, 0x45, 0x54, 0x98, 0xb5, 0xa7, 0xd3, 0xe2, 0xdd,
+  0x1a, 0xca, 0x2b, 0xba, 0xc1, 0x52, 0xde, 0x1b, 0xe2, 0xb6, 0xaf, 0x29,
+  0xf7, 0x5d, 0xce, 0xc0, 0xdb, 0x15, 0xaf, 0xb5, 0xc9, 0x63, 0x25, 0xf4,
+  0x13, 0xd4, 0x26, 0x51, 0xaf, 0xb4, 0x87, 0x52, 0xb2, 0x52, 0x89, 0x73,
+  0x21, 0x56, 0xc4, 0x1b, 0x57, 0x76, 0x99, 0xd6, 0x77, 0x6c, 0x64, 0x84,
+  0xe3, 0x70, 0x78, 0x43, 0x55, 0x61, 0x61, 0x64, 0x8b, 0xaf, 0xab, 0x62,
+  0x8a, 0xc0, 0x54, 0x15, 0x2a, 0x4d, 0x62, 0x12, 0x35, 0x66, 0x13, 0x0f,
+  0x65, 0xba, 0x76, 0x25, 0x3d, 0x9f, 0x75, 0xdd, 0xcf, 0xdf, 0x3b, 0x63,
+  0x22, 0x3e, 0x4e, 0xfb, 0x2e, 0x06, 0x84, 0x4f, 0x55, 0xaf, 0x7e, 0x98,
+  0xda, 0x1b, 0xaa, 0xb4, 0xe2, 0x9a, 0xae, 0x07, 0xea, 0x00, 0xdd, 0x9a,
+  0xc2, 0xb7, 0x97, 0x4a, 0xa6, 0xce, 0x2f, 0x5b, 0xd6, 0x57, 0x93, 0xdb,
+  0x37, 0x9b, 0x17, 0x01, 0xba, 0x82, 0x6e, 0x36, 0x98, 0x9b, 0x2f, 0x7b,
+  0xe1, 0x39, 0xd4, 0x7b, 0xcf, 0xc3, 0xbd, 0xf5, 0xb9, 0x32, 0x83, 0x26,
+  0x40, 0x6a, 0xeb, 0x59, 0x14, 0xf6, 0x7b, 0x30, 0x4a, 0x27, 0x27, 0x7d,
+  0x82, 0xba, 0xbc, 0xcc, 0x02, 0xc0, 0xeb, 0x19, 0xe5, 0x4d, 0x17, 0x97,
+  0xb0, 0x80, 0x9f, 0xb3, 0x90, 0x73, 0x17, 0xf2, 0x9f, 0xc9, 0xbf, 0x40,
+  0xd4, 0x34, 0xb0, 0xe7, 0x3b, 0xf0, 0x3c, 0xfc, 0xc9, 0x50, 0xc4, 0x52,
+  0xd8, 0x2e, 0x49, 0x93, 0x52, 0xd2, 0x91, 0x54, 0xb5, 0xbe, 0x51, 0xfd,
+  0x02, 0xce, 0xd2, 0xb4, 0xb9, 0xe8, 0xab, 0x57, 0x54, 0xa0, 0x55, 0x72,
+  0x6b, 0x92, 0x2b, 0x69, 0xed, 0xb4, 0x4c, 0x78, 0x67, 0xf7, 0x32, 0x25,
+  0x85, 0xc2, 0x5b, 0xbb, 0x16, 0x58, 0xb3, 0x28, 0xaa, 0xa9, 0xc4, 0x6a,
+  0x56, 0xb3, 0x95, 0x7e, 0x9f, 0xd3, 0x4c, 0x9a, 0x65, 0x3e, 0xf9, 0xe7,
+  0xe3, 0x9c, 0xbe, 0x9c, 0xa5, 0xa0, 0x28, 0xea, 0x81, 0xa6, 0x2f, 0x67,
+  0xf7, 0x18, 0xcb, 0xa6, 0xcf, 0x43, 0x61, 0x19, 0x7c, 0x73, 0xbd, 0xdb,
+  0x83, 0x19, 0x47, 0xab, 0x15, 0xc6, 0xfd, 0x6c, 0xc1, 0x50, 0xa8, 0xf9,
+  0x6e, 0x8a, 0xee, 0x2c, 0x76, 0x82, 0x93, 0x17, 0xc1, 0xf2, 0xa2, 0x2a,
+  0x40, 0xcb, 0x6d, 0xcf, 0x33, 0xaa, 0xde, 0x44, 0xa0, 0xc7, 0x0c, 0xce,
+  0x63, 0x54, 0xc1, 0x0b, 0x6e, 0x7b, 0x9e, 0x8f, 0xf6, 0xf6, 0x3b, 0x9f,
+  0xcb, 0xf0, 0x63, 0x65, 0x8f, 0xfd, 0x7a, 0xc1, 0xc5, 0xd0, 0xd5, 0x60,
+  0xf0, 0x7b, 0x73, 0x34, 0x50, 0xd9, 0xf5, 0xce, 0xae, 0xcd, 0xf4, 0x91,
+  0x30, 0xce, 0x2e, 0x63, 0xd7, 0xad, 0x95, 0xf9, 0x1d, 0xd0, 0x85, 0xdb,
+  0x71, 0x66, 0xde, 0x45, 0x10, 0x26, 0x04, 0x79, 0x33, 0xb5, 0xbb, 0x7e,
+  0xd2, 0xe1, 0xf5, 0x85, 0x95, 0xb3, 0x5e, 0x78, 0x83, 0x75, 0x79, 0x57,
+  0x38, 0x1c, 0xee, 0x33, 0x90, 0xeb, 0x54, 0x76, 0x35, 0x75, 0x61, 0x2a,
+  0x02, 0x32, 0x56, 0xc3, 0x00, 0xa3, 0xed, 0x1b, 0x06, 0xb8, 0xf0, 0xfe,
+  0xeb, 0x2a, 0x80, 0xc4, 0xf1, 0x76, 0x1e, 0x58, 0x76, 0x1f, 0x76, 0x79,
+  0xdf, 0x82, 0x51, 0xbe, 0x3f, 0xd9, 0x95, 0xd9, 0xe5, 0xf5, 0xd1, 0x2b,
+  0x29, 0xb2, 0x11, 0x45, 0x5c, 0xad, 0x5d, 0x19, 0x04, 0x9d, 0x0a, 0x68,
+  0x70, 0xc4, 0x6d, 0xee, 0x85, 0xac, 0xc2, 0x0a, 0xe9, 0xb3, 0x5c, 0xbf,
+  0xb3, 0xbd, 0x10, 0x03, 0x51, 0x78, 0x99, 0xb9, 0x8b, 0x1f, 0xdb, 0x00,
+  0xc9, 0xeb, 0xdd, 0xab, 0x41, 0xe2, 0x81, 0x01, 0x1a, 0x28, 0xed, 0x0a,
+  0xfa, 0x42, 0x30, 0x3c, 0x77, 0x02, 0xad, 0x8c, 0x1a, 0x08, 0xe3, 0xbe,
+  0xf8, 0x42, 0x20, 0x94, 0x91, 0x0e, 0x4f, 0xa0, 0x34, 0x08, 0xac, 0x8b,
+  0x65, 0x63, 0x4b, 0x54, 0xe5, 0xe1, 0x6a, 0xc2, 0x3a, 0xd7, 0xb0, 0xc5,
+  0x08, 0x55, 0x03, 0x41, 0xdc, 0xaa, 0x42, 0x30, 0xb2, 0x3e, 0x94, 0xf4,
+  0x04, 0x4a, 0xdb, 0x24, 0x51, 0x2e, 0x4d, 0x41, 0x15, 0x82, 0xb0, 0x4a,
+  0x22, 0xbf, 0xac, 0x06, 0x8f, 0x5f, 0xf9, 0xee, 0x9a, 0x77, 0xba, 0x4d,
+  0x8c, 0x0a, 0xeb, 0xd3, 0x4e, 0xde, 0x0e, 0x5f, 0x88, 0x05, 0x95, 0x5a,
+  0x8e, 0x2f, 0xf3, 0x4d, 0xcb, 0xab, 0xdd, 0x2b, 0xd4, 0xef, 0xb2, 0xb2,
+  0x26, 0xab, 0xd2, 0x55, 0xf3, 0xd5, 0x3a, 0xc0, 0x4a, 0xeb, 0x3d, 0xc8,
+  0xae, 0xa5, 0x2f, 0xe3, 0x72, 0x28, 0x66, 0xf6, 0x41, 0xbf, 0xbb, 0xbe,
+  0x0a, 0x00, 0xe6, 0x90, 0x69, 0x03, 0x52, 0x89, 0x12, 0x02, 0x8a, 0x93,
+  0x14, 0xb3, 0x08, 0x52, 0x06, 0x8b, 0x31, 0xaa, 0xa4, 0xc9, 0xd4, 0x34,
+  0x16, 0xd2, 0x5d, 0x22, 0x7d, 0xa1, 0xd4, 0x26, 0x55, 0x75, 0x5f, 0x90,
+  0x06, 0xd1, 0xdf, 0xa1, 0x45, 0xf7, 0xd5, 0x23, 0xca, 0x6b, 0xc6, 0x36,
+  0x4a, 0x57, 0xec, 0xd4, 0xf0, 0x33, 0x8b, 0xfa, 0x7e, 0x11, 0x0c, 0xcf,
+  0x43, 0x57, 0xa8, 0x72, 0x16, 0x44, 0xc0, 0x95, 0x42, 0xf5, 0xa8, 0xf6,
+  0x88, 0x3c, 0xaf, 0x13, 0xff, 0x58, 0x75, 0xec, 0x50, 0x82, 0xaa, 0x6b,
+  0xa2, 0xde, 0xd1, 0xea, 0xb1, 0x33, 0xa4, 0x4a, 0xc5, 0xce, 0x66, 0x2e,
+  0x70, 0xd5, 0x78, 0x53, 0x66, 0x7e, 0x13, 0xe1, 0xcf, 0x15, 0xfc, 0x80,
+  0xdc, 0x40, 0xf4, 0x73, 0xee, 0xb2, 0xe3, 0xde, 0x52, 0x9c, 0x94, 0xb2,
+  0x4e, 0x58, 0x5b, 0xa3, 0x4a, 0x60, 0xe4, 0x89, 0xb1, 0x13, 0x50, 0xe6,
+  0xba, 0x50, 0x02, 0x89, 0xbb, 0xea, 0x58, 0x01, 0x99, 0x69, 0x76, 0xca,
+  0xf6, 0x7f, 0x3b, 0x96, 0x1c, 0x5b, 0x65, 0x49, 0x62, 0xca, 0x60, 0x6e,
+  0x3b, 0x92, 0x5c, 0xe9, 0x70, 0xb9, 0x14, 0xbd, 0xb5, 0xd1, 0x8a, 0xea,
+  0x57, 0xf2, 0x87, 0x10, 0x07, 0xd5, 0x66, 0x3e, 0xb6, 0xc2, 0x59, 0x28,
+  0x44, 0xe4, 0xad, 0xf1, 0x63, 0x00, 0x2a, 0x21, 0xc8, 0x66, 0xad, 0x98,
+  0x4d, 0x36, 0x30, 0x39, 0x67, 0x4e, 0xb1, 0xff, 0x65, 0x95, 0x30, 0x02,
+  0x6d, 0x32, 0xec, 0x85, 0x67, 0xa0, 0x2e, 0xf4, 0x70, 0xd7, 0x4b, 0xaf,
+  0x1d, 0x59, 0x3d, 0xb4, 0xfb, 0x12, 0x4c, 0x9a, 0x94, 0x34, 0x5e, 0xaf,
+  0xe8, 0x7c, 0x6c, 0x81, 0x8f, 0xb1, 0x15, 0x35, 0xab, 0xdd, 0xd3, 0x45,
+  0x3b, 0xb6, 0xc4, 0x7c, 0x8f, 0x01, 0x28, 0x41, 0xb7, 0x08, 0x49, 0x97,
+  0x9c, 0xbe, 0x0c, 0xaf, 0xc9, 0x68, 0xe5, 0x10, 0xd4, 0x38, 0x76, 0x4c,
+  0x36, 0x43, 0xc1, 0x6d, 0x71, 0x4a, 0xd0, 0x7a, 0x52, 0x2f, 0x0b, 0x50,
+  0xaa, 0xda, 0xa5, 0x39, 0xf8, 0x6a, 0x4e, 0xde, 0x5a, 0x10, 0x7f, 0x55,
+  0x8e, 0x24, 0xad, 0xc0, 0x6b, 0x36, 0xa3, 0x8d, 0x7b, 0x14, 0xd6, 0x5e,
+  0xd4, 0xe7, 0x61, 0x67, 0x4d, 0x93, 0xa8, 0x94, 0x47, 0xb1, 0x62, 0x06,
+  0x45, 0x2d, 0x93, 0x9d, 0x3c, 0x59, 0x92, 0x63, 0xe3, 0x48, 0x2b, 0xe5,
+  0xc8, 0xae, 0x48, 0x1e, 0x9e, 0x0a, 0xfe, 0xb6, 0xc4, 0x8a, 0x6a, 0x19,
+  0x6b, 0x4e, 0x32, 0x5b, 0x25, 0x8e, 0x5b, 0x3e, 0xab, 0x0e, 0x92, 0xe3,
+  0x56, 0x19, 0x2e, 0x37, 0xb4, 0x7c, 0x86, 0xee, 0x4e, 0x73, 0x28, 0xf9,
+  0x0b, 0x83, 0xec, 0x09, 0x31, 0x95, 0x7c, 0x98, 0x53, 0x33, 0x2b, 0xa6,
+  0x99, 0x14, 0xd3, 0x58, 0x42, 0xa4, 0xd9, 0x8b, 0xb3, 0xf5, 0x3a, 0x5d,
+  0x52, 0x26, 0xb2, 0x7c, 0xb1, 0x8c, 0x66, 0xec, 0x8d, 0x84, 0x40, 0xcb,
+  0xd5, 0x1f, 0xe1, 0xb5, 0x6a, 0x4e, 0x35, 0x05, 0x43, 0x15, 0xa1, 0x50,
+  0xb6, 0x98, 0x3d, 0xa8, 0xca, 0xd7, 0x79, 0x40, 0x9a, 0xc8, 0xcb, 0xf7,
+  0x1d, 0x31, 0x46, 0xef, 0x62, 0xa7, 0x35, 0x53, 0xdd, 0xdc, 0x90, 0x1f,
+  0x32, 0xff, 0x1b, 0xfd, 0xa4, 0x65, 0xba, 0x27, 0xdb, 0x22, 0x5e, 0xe2,
+  0x5b, 0x20, 0xf5, 0x7a, 0xab, 0x94, 0x9d, 0xe0, 0x58, 0x9a, 0xd4, 0x95,
+  0x39, 0x79, 0xc8, 0xad, 0x16, 0xbd, 0xe8, 0x78, 0x37, 0xc9, 0x13, 0x1a,
+  0x09, 0xd6, 0xe0, 0x03, 0xe5, 0x70, 0x6a, 0x33, 0xc8, 0x4b, 0xa3, 0x65,
+  0x39, 0x7c, 0x91, 0xa8, 0xb1, 0x2e, 0xcc, 0x86, 0xdd, 0xbc, 0x7a, 0x8d,
+  0xee, 0x99, 0x4d, 0x5c, 0xa0, 0x2d, 0xd0, 0x1b, 0x25, 0x63, 0xed, 0x38,
+  0x6d, 0xbe, 0x3f, 0x7d, 0xca, 0xc9, 0x58, 0x5b, 0x5a, 0x73, 0x43, 0x34,
+  0xdf, 0x62, 0x6a, 0x4a, 0x10, 0x82, 0xc3, 0x1b, 0x22, 0x95, 0xf5, 0x9f,
+  0x72, 0x83, 0x53, 0x94, 0x90, 0x29, 0xdb, 0xc8, 0x56, 0xe4, 0x7a, 0xbe,
+  0x8c, 0x97, 0xb0, 0x7d, 0xc9, 0x52, 0x49, 0xc9, 0x31, 0x33, 0x2c, 0xe7,
+  0x60, 0x78, 0xeb, 0x4a, 0x0d, 0xe0, 0xf9, 0x5f, 0xa5, 0x6a, 0x12, 0x15,
+  0xc5, 0x3f, 0x36, 0x0a, 0x35, 0x31, 0x86, 0xfb, 0x19, 0x70, 0x57, 0x52,
+  0x73, 0x1e, 0x39, 0xed, 0x1a, 0x4c, 0xe9, 0x4a, 0x8c, 0x2b, 0x16, 0x05,
+  0xcb, 0x66, 0xbd, 0xa6, 0xe5, 0xd4, 0x35, 0xf7, 0xdc, 0xc6, 0xf1, 0x8c,
+  0xfa, 0x5a, 0x3b, 0xac, 0x53, 0x3f, 0x28, 0xbe, 0x72, 0x5a, 0xc3, 0xd2,
+  0xa5, 0x48, 0x7d, 0xab, 0x1c, 0xdc, 0x6b, 0xaf, 0xcd, 0x93, 0x73, 0xf5,
+  0xa3, 0x7e, 0xd2, 0xa6, 0x7e, 0xd1, 0xd7, 0x56, 0xe5, 0x03, 0x2d, 0x53,
+  0x2a, 0xf9, 0x06, 0x41, 0x34, 0xb4, 0x2a, 0x18, 0x11, 0x2e, 0x8a, 0x99,
+  0xa7, 0x6c, 0x9c, 0xa4, 0x59, 0xbc, 0xb0, 0xe5, 0xb6, 0x3a, 0x28, 0x1c,
+  0x8d, 0x72, 0x5f, 0xaf, 0xf4, 0x8b, 0x0d, 0x59, 0xe8, 0xf4, 0xe9, 0x55,
+  0x42, 0x77, 0xde, 0x45, 0xa3, 0xe9, 0xfa, 0xcb, 0xd6, 0xca, 0xa9, 0x2e,
+  0xae, 0x1f, 0x38, 0x9c, 0xce, 0x54, 0x53, 0xae, 0x17, 0x0d, 0xce, 0x15,
+  0xa7, 0x5f, 0x33, 0x91, 0xdd, 0xb8, 0x4b, 0x86, 0x01, 0x2e, 0x8f, 0x30,
+  0x6a, 0xde, 0x05, 0xf4, 0xf1, 0xd1, 0x38, 0xec, 0x6f, 0x52, 0x3e, 0x82,
+  0x70, 0x99, 0xce, 0x6b, 0x59, 0x5c, 0xc2, 0xf1, 0x63, 0x05, 0xba, 0x7e,
+  0x06, 0x7f, 0x41, 0x59, 0x20, 0x55, 0x8f, 0x69, 0x33, 0x5b, 0x3c, 0xa7,
+  0x2f, 0x52, 0x16, 0xff, 0x7c, 0xc0, 0x62, 0x16, 0x12, 0x8a, 0x70, 0xc0,
+  0x18, 0x86, 0xdf, 0x56, 0xd0, 0x5f, 0xfa, 0xd5, 0x83, 0xdf, 0x56, 0xd0,
+  0xfc, 0xfa, 0xea, 0xc1, 0xff, 0x05, 0x4a, 0xaa, 0x4c, 0x6f, 0x54, 0xe3,
+  0x04, 0x00
 };
-const unsigned int webui_html_len = 170341;
+const unsigned int webui_html_len = 170366;